@@ -89,6 +89,56 @@ describe('Transaction log', () => {
 			})
 		);
 	});
+
+	// The commit pipeline mode is fixed per process by ROCKSDB_JS_COMMIT_THREAD,
+	// so compare modes by running this file once per value: unset (single
+	// lane), `2` (two lanes) and `auto` (adaptive). `auto` should track single
+	// lane on small commits and two lanes on large ones.
+	const commitThread = process.env.ROCKSDB_JS_COMMIT_THREAD ?? 'unset';
+	describe(`commit pipeline (ROCKSDB_JS_COMMIT_THREAD=${commitThread})`, () => {
+		const largeValue = Buffer.alloc(4096, 'b');
+
+		benchmark(
+			'rocksdb',
+			concurrent({
+				name: 'small commits: 1 put + 1 100 byte log entry',
+				async setup(ctx: BenchmarkContext<RocksDatabase>) {
+					ctx.log = ctx.db.useLog('0');
+					ctx.index = 0;
+				},
+				async bench(ctx: BenchmarkContext<RocksDatabase>) {
+					const { db, log } = ctx;
+					const key = `small-${ctx.index++}`;
+					await db.transaction((txn) => {
+						txn.putSync(key, data);
+						log.addEntry(data, txn.id);
+					});
+				},
+			})
+		);
+
+		benchmark(
+			'rocksdb',
+			concurrent({
+				name: 'large commits: 64 puts + 64 4 KB log entries',
+				async setup(ctx: BenchmarkContext<RocksDatabase>) {
+					ctx.log = ctx.db.useLog('0');
+					ctx.index = 0;
+				},
+				async bench(ctx: BenchmarkContext<RocksDatabase>) {
+					const { db, log } = ctx;
+					const base = ctx.index++;
+					await db.transaction((txn) => {
+						for (let i = 0; i < 64; i++) {
+							txn.putSync(`large-${base}-${i}`, largeValue);
+							log.addEntry(largeValue, txn.id);
+						}
+					});
+				},
+			})
+		);
+	});
+
 	describe('read one entry from random position from log with 1000 100 byte records', () => {
 		benchmark('rocksdb', {
 			mode: 'essential',
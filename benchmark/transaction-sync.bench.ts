@@ -5,6 +5,8 @@ import { describe } from 'vitest';
 describe('transaction sync', () => {
 	const SMALL_DATASET = 100;
 	const smallDataset = generateTestData(SMALL_DATASET, 20, 100);
+	const LARGE_DATASET = 1000;
+	const largeDataset = generateTestData(LARGE_DATASET, 20, 100);
 
 	describe('optimistic', () => {
 		describe('simple put operations (100 records)', () => {
@@ -95,6 +97,49 @@ describe('transaction sync', () => {
 			});
 		});
 
+		describe('batched reads (100 records)', () => {
+			function setup(ctx) {
+				ctx.data = smallDataset;
+				ctx.keys = smallDataset.map((item) => item.key);
+				for (const item of ctx.data) {
+					ctx.db.putSync(item.key, item.value);
+				}
+			}
+
+			benchmark('rocksdb', {
+				name: 'rocksdb getSync() per key',
+				setup,
+				bench({ db, keys }) {
+					db.transactionSync((txn) => {
+						for (const key of keys) {
+							txn.getSync(key);
+						}
+					});
+				},
+			});
+
+			benchmark('rocksdb', {
+				name: 'rocksdb getMany()',
+				setup,
+				bench({ db, keys }) {
+					db.transactionSync((txn) => {
+						txn.getMany(keys);
+					});
+				},
+			});
+
+			benchmark('lmdb', {
+				setup,
+				bench({ db, keys }) {
+					db.transactionSync(() => {
+						for (const key of keys) {
+							db.get(key);
+						}
+					});
+				},
+			});
+		});
+
 		describe('concurrent non-conflicting operations (100 records)', () => {
 			function setup(ctx) {
 				ctx.data = smallDataset;
@@ -213,6 +258,66 @@ describe('transaction sync', () => {
 			});
 		});
 
+		describe('back-to-back transactions (1000 records)', () => {
+			function setup(ctx) {
+				ctx.data = largeDataset;
+			}
+
+			benchmark('rocksdb', {
+				setup,
+				bench({ db, data }) {
+					for (const item of data) {
+						db.transactionSync((txn) => {
+							txn.putSync(item.key, item.value);
+						});
+					}
+				},
+			});
+
+			benchmark('lmdb', {
+				setup,
+				bench({ db, data }) {
+					for (const item of data) {
+						db.transactionSync(() => {
+							db.putSync(item.key, item.value);
+						});
+					}
+				},
+			});
+		});
+
+		describe('back-to-back transactions, pool on vs off (1000 records)', () => {
+			function setup(ctx) {
+				ctx.data = largeDataset;
+			}
+
+			benchmark('rocksdb', {
+				name: 'rocksdb pooled',
+				dbOptions: { transactionPoolSize: 32 },
+				setup,
+				bench({ db, data }) {
+					for (const item of data) {
+						db.transactionSync((txn) => {
+							txn.putSync(item.key, item.value);
+						});
+					}
+				},
+			});
+
+			benchmark('rocksdb', {
+				name: 'rocksdb unpooled',
+				dbOptions: { transactionPoolSize: 0 },
+				setup,
+				bench({ db, data }) {
+					for (const item of data) {
+						db.transactionSync((txn) => {
+							txn.putSync(item.key, item.value);
+						});
+					}
+				},
+			});
+		});
+
 		describe('empty transaction overhead', () => {
 			benchmark('rocksdb', {
 				bench({ db }) {
@@ -294,5 +399,66 @@ describe('transaction sync', () => {
 				},
 			});
 		});
+
+		describe('back-to-back transactions (1000 records)', () => {
+			function setup(ctx) {
+				ctx.data = largeDataset;
+			}
+
+			benchmark('rocksdb', {
+				dbOptions: { pessimistic: true },
+				setup,
+				bench({ db, data }) {
+					for (const item of data) {
+						db.transactionSync((txn) => {
+							txn.putSync(item.key, item.value);
+						});
+					}
+				},
+			});
+
+			benchmark('lmdb', {
+				setup,
+				bench({ db, data }) {
+					for (const item of data) {
+						db.transactionSync(() => {
+							db.putSync(item.key, item.value);
+						});
+					}
+				},
+			});
+		});
+
+		describe('back-to-back transactions, pool on vs off (1000 records)', () => {
+			function setup(ctx) {
+				ctx.data = largeDataset;
+			}
+
+			benchmark('rocksdb', {
+				name: 'rocksdb pooled',
+				dbOptions: { pessimistic: true, transactionPoolSize: 32 },
+				setup,
+				bench({ db, data }) {
+					for (const item of data) {
+						db.transactionSync((txn) => {
+							txn.putSync(item.key, item.value);
+						});
+					}
+				},
+			});
+
+			benchmark('rocksdb', {
+				name: 'rocksdb unpooled',
+				dbOptions: { pessimistic: true, transactionPoolSize: 0 },
+				setup,
+				bench({ db, data }) {
+					for (const item of data) {
+						db.transactionSync((txn) => {
+							txn.putSync(item.key, item.value);
+						});
+					}
+				},
+			});
+		});
 	});
 });
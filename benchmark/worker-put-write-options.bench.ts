@@ -0,0 +1,39 @@
+import {
+	generateRandomKeys,
+	workerBenchmark as benchmark,
+	workerDescribe as describe,
+} from './setup.js';
+
+// Compares the write path options under increasing writer contention. Each
+// variant opens its own database, so the numbers are only comparable within a
+// worker count.
+const VARIANTS: { name: string; dbOptions: Record<string, unknown> }[] = [
+	{ name: 'default', dbOptions: {} },
+	{ name: 'serial memtable writes', dbOptions: { allowConcurrentMemtableWrite: false } },
+	{ name: 'writeThreadMaxYieldUsec 10', dbOptions: { writeThreadMaxYieldUsec: 10 } },
+	{ name: 'writeThreadMaxYieldUsec 1000', dbOptions: { writeThreadMaxYieldUsec: 1000 } },
+];
+
+describe('putSync() write options', () => {
+	const DATASET = 1000;
+
+	for (const numWorkers of [1, 4, 16]) {
+		describe(`random keys (${DATASET} records, ${numWorkers} workers)`, () => {
+			for (const { name, dbOptions } of VARIANTS) {
+				benchmark('rocksdb', {
+					name,
+					dbOptions,
+					numWorkers,
+					setup(ctx) {
+						ctx.data = generateRandomKeys(DATASET);
+					},
+					bench({ data, db }) {
+						for (const key of data) {
+							db.putSync(key, 'test-value');
+						}
+					},
+				});
+			}
+		});
+	}
+});
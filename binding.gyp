@@ -40,24 +40,34 @@
 			],
 			'sources': [
 				'src/binding/binding.cpp',
+				'src/binding/core/background_jobs.cpp',
+				'src/binding/core/conflict_profiler.cpp',
 				'src/binding/core/debug.cpp',
+				'src/binding/core/external_sorter.cpp',
 				'src/binding/core/platform.cpp',
 				'src/binding/core/file_lock.cpp',
+				'src/binding/core/merge_operators.cpp',
+				'src/binding/core/tombstone_compactor.cpp',
+				'src/binding/core/ttl_compaction_filter.cpp',
+				'src/binding/core/value_cache.cpp',
 				'src/binding/core/verification_table.cpp',
 				'src/binding/napi/event_emitter.cpp',
 				'src/binding/napi/global_events.cpp',
 				'src/binding/napi/helpers.cpp',
+				'src/binding/napi/parked_reads.cpp',
 				'src/binding/database/backup.cpp',
 				'src/binding/database/backup_disk_space.cpp',
 				'src/binding/database/backup_stream.cpp',
 				'src/binding/database/backup_transaction_logs.cpp',
 				'src/binding/database/checkpoint.cpp',
+				'src/binding/database/commit_executor.cpp',
 				'src/binding/database/database.cpp',
 				'src/binding/database/database_events.cpp',
 				'src/binding/database/db_descriptor.cpp',
 				'src/binding/database/db_handle.cpp',
 				'src/binding/database/db_registry.cpp',
 				'src/binding/database/db_settings.cpp',
+				'src/binding/database/sst_writer.cpp',
 				'src/binding/iterator/db_iterator.cpp',
 				'src/binding/iterator/db_iterator_handle.cpp',
 				'src/binding/transaction/transaction_handle.cpp',
@@ -66,6 +76,7 @@
 				'src/binding/transaction_log/transaction_log_file.cpp',
 				'src/binding/transaction_log/transaction_log_handle.cpp',
 				'src/binding/transaction_log/transaction_log_recovery.cpp',
+				'src/binding/transaction_log/transaction_log_replay.cpp',
 				'src/binding/transaction_log/transaction_log_store.cpp',
 				'src/binding/transaction_log/transaction_log_store_registry.cpp',
 				'src/binding/transaction_log/transaction_log_validation.cpp',
@@ -209,26 +220,44 @@
 				'deps/googletest/googlemock/include',
 			],
 			'sources': [
+				'src/binding/core/background_jobs.cpp',
+				'src/binding/core/conflict_profiler.cpp',
 				'src/binding/core/debug.cpp',
+				'src/binding/core/external_sorter.cpp',
 				'src/binding/core/platform.cpp',
 				'src/binding/core/file_lock.cpp',
+				'src/binding/core/merge_operators.cpp',
+				'src/binding/core/tombstone_compactor.cpp',
+				'src/binding/core/ttl_compaction_filter.cpp',
+				'src/binding/core/value_cache.cpp',
 				'src/binding/core/verification_table.cpp',
 				'src/binding/database/backup_disk_space.cpp',
+				'src/binding/database/commit_executor.cpp',
 				'src/binding/transaction_log/transaction_log_file.cpp',
 				'src/binding/transaction_log/transaction_log_recovery.cpp',
 				'src/binding/transaction_log/transaction_log_validation.cpp',
 				'test/native/event_emitter_stub.cc',
 				'test/native/rocksdb_version_test.cc',
+				'test/native/background_jobs_test.cc',
 				'test/native/backup_disk_space_test.cc',
+				'test/native/commit_executor_test.cc',
+				'test/native/commit_mode_test.cc',
+				'test/native/conflict_profiler_test.cc',
 				'test/native/encoding_test.cc',
+				'test/native/external_sorter_test.cc',
 				'test/native/file_lock_test.cc',
 				'test/native/json_test.cc',
+				'test/native/merge_operators_test.cc',
 				'test/native/platform_fd_limit_test.cc',
+				'test/native/tombstone_compactor_test.cc',
+				'test/native/transaction_log_entry_test.cc',
 				'test/native/transaction_log_madvise_test.cc',
 				'test/native/transaction_log_mmap_test.cc',
 				'test/native/transaction_log_recovery_test.cc',
 				'test/native/transaction_log_validation_test.cc',
 				'test/native/transaction_log_writev_test.cc',
+				'test/native/ttl_compaction_filter_test.cc',
+				'test/native/value_cache_test.cc',
 				'test/native/verification_table_test.cc',
 			],
 			'defines': [
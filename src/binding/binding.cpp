@@ -1,12 +1,15 @@
 #include "napi/binding.h"
 #include "database/backup.h"
+#include "database/commit_executor.h"
 #include "database/database.h"
 #include "iterator/db_iterator.h"
 #include "iterator/db_iterator_handle.h"
 #include "database/db_registry.h"
 #include "database/db_settings.h"
+#include "database/sst_writer.h"
 #include "napi/global_events.h"
 #include "napi/macros.h"
+#include "napi/parked_reads.h"
 #include "rocksdb/db.h"
 #include "rocksdb/statistics.h"
 #include "transaction/transaction.h"
@@ -15,6 +18,7 @@
 #include "transaction_log/transaction_log_store_registry.h"
 #include "transaction_log/transaction_log_validation_napi.h"
 #include "core/platform.h"
+#include "core/value_cache.h"
 #include "core/file_lock.h"
 #include "core/test_seam.h"
 #include "napi/helpers.h"
@@ -108,6 +112,61 @@ napi_value FileLockRelease(napi_env env, napi_callback_info info) {
 	NAPI_RETURN_UNDEFINED();
 }
 
+/**
+ * Returns the process-wide commit lane configuration and per-lane queue depths
+ * as `{ lanes, depths }` (see CommitExecutor).
+ */
+napi_value CommitLaneStats(napi_env env, napi_callback_info info) {
+	CommitExecutor& executor = CommitExecutor::getInstance();
+	std::vector<size_t> depths = executor.laneDepths();
+
+	napi_value result;
+	NAPI_STATUS_THROWS(::napi_create_object(env, &result));
+
+	napi_value lanes;
+	NAPI_STATUS_THROWS(::napi_create_uint32(env, executor.getLaneCount(), &lanes));
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, result, "lanes", lanes));
+
+	napi_value jsDepths;
+	NAPI_STATUS_THROWS(::napi_create_array_with_length(env, depths.size(), &jsDepths));
+	for (uint32_t i = 0; i < depths.size(); ++i) {
+		napi_value depth;
+		NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(depths[i]), &depth));
+		NAPI_STATUS_THROWS(::napi_set_element(env, jsDepths, i, depth));
+	}
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, result, "depths", jsDepths));
+
+	return result;
+}
+
+/**
+ * Returns the process-wide value cache's budget, size and counters (see
+ * ValueCache).
+ */
+napi_value GetValueCacheStats(napi_env env, napi_callback_info info) {
+	ValueCacheStats stats = ValueCache::getInstance().getStats();
+
+	napi_value result;
+	NAPI_STATUS_THROWS(::napi_create_object(env, &result));
+
+#define SET_VALUE_CACHE_STAT(name) \
+	do { \
+		napi_value value; \
+		NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(stats.name), &value)); \
+		NAPI_STATUS_THROWS(::napi_set_named_property(env, result, #name, value)); \
+	} while (0)
+	SET_VALUE_CACHE_STAT(capacity);
+	SET_VALUE_CACHE_STAT(bytes);
+	SET_VALUE_CACHE_STAT(entries);
+	SET_VALUE_CACHE_STAT(hits);
+	SET_VALUE_CACHE_STAT(misses);
+	SET_VALUE_CACHE_STAT(inserts);
+	SET_VALUE_CACHE_STAT(evictions);
+#undef SET_VALUE_CACHE_STAT
+
+	return result;
+}
+
 /**
  * Advises the kernel that the file-backed pages of every mapped transaction log
  * are cold (MADV_COLD), so they are reclaimed first under memory pressure. Meant
@@ -187,6 +246,8 @@ NAPI_MODULE_INIT() {
 		// tsfns, so the shared commit thread stops marshalling into a torn-down
 		// env (mirrors the listener cleanup above).
 		rocksdb_js::DBRegistry::ReleaseCommitCompletionsByEnv(dyingEnv);
+		// Likewise for the parked-read wake tsfn, which writers' threads call.
+		rocksdb_js::ParkedReads::getInstance().releaseByEnv(dyingEnv);
 
 		int32_t newRefCount = --moduleRefCount;
 		if (newRefCount == 0) {
@@ -208,6 +269,9 @@ NAPI_MODULE_INIT() {
 	// backup management functions (restore/list/delete/purge/verify)
 	rocksdb_js::initBackupExports(env, exports);
 
+	// sst file writer for bulk ingestion
+	rocksdb_js::SstWriter::Init(env, exports);
+
 	// transaction
 	rocksdb_js::Transaction::Init(env, exports);
 
@@ -255,6 +319,16 @@ NAPI_MODULE_INIT() {
 	NAPI_STATUS_THROWS(::napi_create_function(env, "coolTransactionLogs", NAPI_AUTO_LENGTH, CoolTransactionLogs, nullptr, &coolTransactionLogsFn));
 	NAPI_STATUS_THROWS(::napi_set_named_property(env, exports, "coolTransactionLogs", coolTransactionLogsFn));
 
+	// commitLaneStats function
+	napi_value commitLaneStatsFn;
+	NAPI_STATUS_THROWS(::napi_create_function(env, "commitLaneStats", NAPI_AUTO_LENGTH, CommitLaneStats, nullptr, &commitLaneStatsFn));
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, exports, "commitLaneStats", commitLaneStatsFn));
+
+	// valueCacheStats function
+	napi_value valueCacheStatsFn;
+	NAPI_STATUS_THROWS(::napi_create_function(env, "valueCacheStats", NAPI_AUTO_LENGTH, GetValueCacheStats, nullptr, &valueCacheStatsFn));
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, exports, "valueCacheStats", valueCacheStatsFn));
+
 	// transactionLogMapCount function (test/diagnostics)
 	napi_value transactionLogMapCountFn;
 	NAPI_STATUS_THROWS(::napi_create_function(env, "transactionLogMapCount", NAPI_AUTO_LENGTH, TransactionLogMapCount, nullptr, &transactionLogMapCountFn));
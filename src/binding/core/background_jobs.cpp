@@ -0,0 +1,56 @@
+#include <chrono>
+#include <optional>
+#include "core/background_jobs.h"
+
+namespace rocksdb_js {
+
+namespace {
+
+// When the flush running on this thread began. A flush only notifies its
+// completion when it succeeds, so the next one to begin overwrites it.
+thread_local std::optional<std::chrono::steady_clock::time_point> flushStart;
+
+} // namespace
+
+void BackgroundJobListener::Counters::add(uint64_t elapsedUs) {
+	this->completed.fetch_add(1, std::memory_order_relaxed);
+	this->busyUs.fetch_add(elapsedUs, std::memory_order_relaxed);
+}
+
+BackgroundJobStats BackgroundJobListener::Counters::get() const {
+	BackgroundJobStats stats;
+	stats.completed = this->completed.load(std::memory_order_relaxed);
+	stats.busyMs = static_cast<double>(this->busyUs.load(std::memory_order_relaxed)) / 1000.0;
+	return stats;
+}
+
+void BackgroundJobListener::OnFlushBegin(rocksdb::DB* /*db*/, const rocksdb::FlushJobInfo& /*info*/) {
+	flushStart = std::chrono::steady_clock::now();
+}
+
+void BackgroundJobListener::OnFlushCompleted(rocksdb::DB* /*db*/, const rocksdb::FlushJobInfo& /*info*/) {
+	// an atomic flush notifies every column family's begin, then every
+	// completion, so only the first completion has time to add
+	uint64_t elapsedUs = 0;
+	if (flushStart) {
+		elapsedUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - *flushStart
+		).count());
+		flushStart.reset();
+	}
+	this->flushes.add(elapsedUs);
+}
+
+void BackgroundJobListener::OnCompactionCompleted(rocksdb::DB* /*db*/, const rocksdb::CompactionJobInfo& info) {
+	this->compactions.add(info.stats.elapsed_micros);
+}
+
+BackgroundJobStats BackgroundJobListener::getFlushStats() const {
+	return this->flushes.get();
+}
+
+BackgroundJobStats BackgroundJobListener::getCompactionStats() const {
+	return this->compactions.get();
+}
+
+} // namespace rocksdb_js
@@ -0,0 +1,52 @@
+#ifndef __BACKGROUND_JOBS_H__
+#define __BACKGROUND_JOBS_H__
+
+#include <atomic>
+#include <cstdint>
+#include "rocksdb/listener.h"
+
+namespace rocksdb_js {
+
+/**
+ * A snapshot of the jobs one background thread pool ran, returned as part of
+ * `backgroundStats()`.
+ */
+struct BackgroundJobStats final {
+	// jobs finished, successful or not for compactions, successful for flushes
+	uint64_t completed = 0;
+	// thread time spent running them, in milliseconds; divided by the pool
+	// size and the elapsed time, it gives the pool's utilization
+	double busyMs = 0;
+};
+
+/**
+ * Counts the flushes and compactions of every database in the process. It is
+ * added to each database's listeners, so with the shared thread pools of
+ * `config({ backgroundThreads })`, flushes account for the high priority pool
+ * and compactions for the low priority one.
+ */
+class BackgroundJobListener final : public rocksdb::EventListener {
+public:
+	void OnFlushBegin(rocksdb::DB* db, const rocksdb::FlushJobInfo& info) override;
+	void OnFlushCompleted(rocksdb::DB* db, const rocksdb::FlushJobInfo& info) override;
+	void OnCompactionCompleted(rocksdb::DB* db, const rocksdb::CompactionJobInfo& info) override;
+
+	BackgroundJobStats getFlushStats() const;
+	BackgroundJobStats getCompactionStats() const;
+
+private:
+	struct Counters {
+		std::atomic<uint64_t> completed{ 0 };
+		std::atomic<uint64_t> busyUs{ 0 };
+
+		void add(uint64_t elapsedUs);
+		BackgroundJobStats get() const;
+	};
+
+	Counters flushes;
+	Counters compactions;
+};
+
+} // namespace rocksdb_js
+
+#endif
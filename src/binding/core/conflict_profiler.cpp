@@ -0,0 +1,124 @@
+#include "core/conflict_profiler.h"
+#include <algorithm>
+
+namespace rocksdb_js {
+
+ConflictProfiler::ConflictProfiler(size_t capacity) : capacity(capacity) {}
+
+void ConflictProfiler::setCapacity(size_t newCapacity) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->capacity.store(newCapacity, std::memory_order_relaxed);
+	if (newCapacity == 0) {
+		this->counters.clear();
+		this->index.clear();
+		this->conflicts = 0;
+		this->unattributed = 0;
+	} else {
+		this->trim(newCapacity);
+	}
+}
+
+void ConflictProfiler::record(const std::vector<ConflictKey>& keys, uint32_t retries) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	size_t limit = this->capacity.load(std::memory_order_relaxed);
+	if (limit == 0) {
+		return;
+	}
+
+	this->conflicts++;
+	if (keys.empty()) {
+		this->unattributed++;
+		return;
+	}
+
+	std::string id;
+	for (const auto& conflictKey : keys) {
+		bool truncated = conflictKey.key.size() > MAX_KEY_PREFIX;
+		std::string_view prefix = conflictKey.key.substr(0, MAX_KEY_PREFIX);
+		id.assign(conflictKey.columnFamily);
+		id.push_back('\0');
+		id.append(prefix);
+
+		auto it = this->index.find(id);
+		if (it != this->index.end()) {
+			Counter& counter = this->counters[it->second];
+			counter.count++;
+			counter.truncated = counter.truncated || truncated;
+			counter.maxRetries = std::max(counter.maxRetries, retries);
+			continue;
+		}
+
+		if (this->counters.size() < limit) {
+			this->index.emplace(id, this->counters.size());
+			this->counters.push_back({ id, conflictKey.columnFamily.size(), truncated, 1, 0, retries });
+			continue;
+		}
+
+		// Space-Saving: replace the least conflicted key, inheriting its count
+		size_t victim = 0;
+		for (size_t i = 1; i < this->counters.size(); i++) {
+			if (this->counters[i].count < this->counters[victim].count) {
+				victim = i;
+			}
+		}
+		Counter& counter = this->counters[victim];
+		this->index.erase(counter.id);
+		this->index.emplace(id, victim);
+		counter.error = counter.count;
+		counter.count++;
+		counter.id = id;
+		counter.columnFamilyLength = conflictKey.columnFamily.size();
+		counter.truncated = truncated;
+		counter.maxRetries = retries;
+	}
+}
+
+ConflictStats ConflictProfiler::getStats() {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	ConflictStats stats;
+	stats.capacity = this->capacity.load(std::memory_order_relaxed);
+	stats.conflicts = this->conflicts;
+	stats.unattributed = this->unattributed;
+	stats.keys.reserve(this->counters.size());
+	for (const auto& counter : this->counters) {
+		ConflictKeyStats& key = stats.keys.emplace_back();
+		key.columnFamily = counter.id.substr(0, counter.columnFamilyLength);
+		key.key = counter.id.substr(counter.columnFamilyLength + 1);
+		key.truncated = counter.truncated;
+		key.count = counter.count;
+		key.error = counter.error;
+		key.maxRetries = counter.maxRetries;
+	}
+	std::stable_sort(stats.keys.begin(), stats.keys.end(), [](const ConflictKeyStats& a, const ConflictKeyStats& b) {
+		return a.count > b.count;
+	});
+	return stats;
+}
+
+void ConflictProfiler::reset() {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->counters.clear();
+	this->index.clear();
+	this->conflicts = 0;
+	this->unattributed = 0;
+}
+
+/**
+ * Drops the least conflicted keys until at most `limit` are tracked. Called
+ * with the mutex held.
+ */
+void ConflictProfiler::trim(size_t limit) {
+	if (this->counters.size() <= limit) {
+		return;
+	}
+	std::stable_sort(this->counters.begin(), this->counters.end(), [](const Counter& a, const Counter& b) {
+		return a.count > b.count;
+	});
+	this->counters.resize(limit);
+	this->index.clear();
+	for (size_t i = 0; i < this->counters.size(); i++) {
+		this->index.emplace(this->counters[i].id, i);
+	}
+}
+
+} // namespace rocksdb_js
@@ -0,0 +1,153 @@
+#ifndef __CONFLICT_PROFILER_H__
+#define __CONFLICT_PROFILER_H__
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace rocksdb_js {
+
+/**
+ * A key involved in a transaction conflict.
+ */
+struct ConflictKey final {
+	std::string_view columnFamily;
+	std::string_view key;
+};
+
+/**
+ * The counters of one tracked key, as returned by `getConflictStats()`.
+ */
+struct ConflictKeyStats final {
+	std::string columnFamily;
+
+	/**
+	 * The key, truncated to `ConflictProfiler::MAX_KEY_PREFIX` bytes.
+	 */
+	std::string key;
+
+	/**
+	 * Whether `key` is a truncated prefix of the conflicting key.
+	 */
+	bool truncated = false;
+
+	/**
+	 * The number of conflicts attributed to the key. An overestimate by at
+	 * most `error`.
+	 */
+	uint64_t count = 0;
+
+	/**
+	 * The Space-Saving error bound: the count inherited from the key this one
+	 * evicted.
+	 */
+	uint64_t error = 0;
+
+	/**
+	 * The most times a transaction had already been retried when it conflicted
+	 * on the key.
+	 */
+	uint32_t maxRetries = 0;
+};
+
+/**
+ * A snapshot of the conflict profiler, returned by `getConflictStats()`.
+ */
+struct ConflictStats final {
+	uint64_t capacity = 0;
+
+	/**
+	 * The number of conflicts recorded.
+	 */
+	uint64_t conflicts = 0;
+
+	/**
+	 * The number of conflicts no key could be attributed to.
+	 */
+	uint64_t unattributed = 0;
+
+	/**
+	 * The tracked keys, most conflicted first.
+	 */
+	std::vector<ConflictKeyStats> keys;
+};
+
+/**
+ * Tracks which keys transactions conflict on, enabled per database with the
+ * `conflictStatsSize` open option.
+ *
+ * Keys are counted with the Space-Saving algorithm: at most `capacity` keys
+ * are tracked, and a key seen while the table is full replaces the least
+ * conflicted one, inheriting its count (recorded as the new key's `error`).
+ * Every key conflicting more than `conflicts / capacity` times is guaranteed
+ * to be tracked, which is exactly the hot set worth restructuring.
+ *
+ * Recording takes a mutex and may scan the table for its minimum, which is
+ * fine because it only runs on the conflict path; when disabled, callers pay
+ * a single relaxed load in `enabled()`.
+ */
+class ConflictProfiler final {
+public:
+	/**
+	 * Keys longer than this are tracked by their prefix.
+	 */
+	static constexpr size_t MAX_KEY_PREFIX = 64;
+
+	explicit ConflictProfiler(size_t capacity = 0);
+
+	/**
+	 * Sets the number of keys tracked, keeping the most conflicted ones. 0
+	 * disables the profiler and drops everything recorded.
+	 */
+	void setCapacity(size_t capacity);
+
+	size_t getCapacity() const {
+		return this->capacity.load(std::memory_order_relaxed);
+	}
+
+	bool enabled() const {
+		return this->getCapacity() > 0;
+	}
+
+	/**
+	 * Records one conflict involving `keys`, by a transaction that had already
+	 * been retried `retries` times. With no keys, the conflict is counted as
+	 * unattributed.
+	 */
+	void record(const std::vector<ConflictKey>& keys, uint32_t retries);
+
+	ConflictStats getStats();
+
+	/**
+	 * Drops everything recorded, keeping the capacity.
+	 */
+	void reset();
+
+private:
+	struct Counter {
+		std::string id;
+		size_t columnFamilyLength;
+		bool truncated;
+		uint64_t count;
+		uint64_t error;
+		uint32_t maxRetries;
+	};
+
+	void trim(size_t capacity);
+
+	std::mutex mutex;
+	std::atomic<size_t> capacity;
+	// ids are `columnFamily + '\0' + key prefix`
+	std::vector<Counter> counters;
+	std::unordered_map<std::string, size_t> index;
+	uint64_t conflicts = 0;
+	uint64_t unattributed = 0;
+};
+
+} // namespace rocksdb_js
+
+#endif
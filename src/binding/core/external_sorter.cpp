@@ -0,0 +1,204 @@
+#include "core/external_sorter.h"
+#include "core/exception.h"
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <queue>
+
+namespace rocksdb_js {
+
+namespace {
+
+struct FileCloser {
+	void operator()(FILE* file) const {
+		std::fclose(file);
+	}
+};
+
+using FilePtr = std::unique_ptr<FILE, FileCloser>;
+
+/**
+ * Reads a run file back one entry at a time. Entries are stored as a native
+ * endian `uint32_t` key size, the key, a `uint32_t` value size and the value.
+ */
+struct RunReader final {
+	FilePtr file;
+	size_t index;
+	std::string key;
+	std::string value;
+
+	RunReader(const std::string& path, size_t index) : file(std::fopen(path.c_str(), "rb")), index(index) {
+		if (!this->file) {
+			throw DBException("Failed to open sort run: " + path);
+		}
+	}
+
+	/**
+	 * Reads the next entry, returning false at the end of the run.
+	 */
+	bool next() {
+		uint32_t size;
+		if (std::fread(&size, sizeof(size), 1, this->file.get()) != 1) {
+			if (std::ferror(this->file.get())) {
+				throw DBException("Failed to read sort run");
+			}
+			return false;
+		}
+		this->key.resize(size);
+		if (size > 0 && std::fread(this->key.data(), 1, size, this->file.get()) != size) {
+			throw DBException("Truncated sort run");
+		}
+		if (std::fread(&size, sizeof(size), 1, this->file.get()) != 1) {
+			throw DBException("Truncated sort run");
+		}
+		this->value.resize(size);
+		if (size > 0 && std::fread(this->value.data(), 1, size, this->file.get()) != size) {
+			throw DBException("Truncated sort run");
+		}
+		return true;
+	}
+};
+
+} // namespace
+
+ExternalSorter::ExternalSorter(std::string runPathPrefix, size_t memoryLimit)
+	: runPathPrefix(std::move(runPathPrefix)), memoryLimit(memoryLimit) {}
+
+ExternalSorter::~ExternalSorter() {
+	this->removeRuns();
+}
+
+void ExternalSorter::add(std::string_view key, std::string_view value) {
+	this->entries.push_back({ this->arena.size(), static_cast<uint32_t>(key.size()), static_cast<uint32_t>(value.size()) });
+	this->arena.append(key);
+	this->arena.append(value);
+	this->count++;
+
+	if (this->arena.size() + this->entries.size() * sizeof(Entry) >= this->memoryLimit) {
+		this->spill();
+	}
+}
+
+/**
+ * Sorts the buffered entries by key, keeping only the last one added for
+ * each key.
+ */
+void ExternalSorter::sortBuffered() {
+	// stable, so equal keys stay in the order they were added
+	std::stable_sort(this->entries.begin(), this->entries.end(), [this](const Entry& a, const Entry& b) {
+		return this->keyOf(a) < this->keyOf(b);
+	});
+
+	size_t kept = 0;
+	for (size_t i = 0; i < this->entries.size(); i++) {
+		if (i + 1 < this->entries.size() && this->keyOf(this->entries[i]) == this->keyOf(this->entries[i + 1])) {
+			continue;
+		}
+		this->entries[kept++] = this->entries[i];
+	}
+	this->entries.resize(kept);
+}
+
+/**
+ * Sorts the buffered entries and writes them to a new run file.
+ */
+void ExternalSorter::spill() {
+	if (this->entries.empty()) {
+		return;
+	}
+
+	this->sortBuffered();
+
+	std::string path = this->runPathPrefix + ".run-" + std::to_string(this->runs.size());
+	FilePtr file(std::fopen(path.c_str(), "wb"));
+	if (!file) {
+		throw DBException("Failed to create sort run: " + path);
+	}
+	// track the run before writing so a failed write still removes it
+	this->runs.push_back(path);
+
+	for (const auto& entry : this->entries) {
+		std::string_view key = this->keyOf(entry);
+		std::string_view value = this->valueOf(entry);
+		if (
+			std::fwrite(&entry.keySize, sizeof(entry.keySize), 1, file.get()) != 1 ||
+			std::fwrite(key.data(), 1, key.size(), file.get()) != key.size() ||
+			std::fwrite(&entry.valueSize, sizeof(entry.valueSize), 1, file.get()) != 1 ||
+			std::fwrite(value.data(), 1, value.size(), file.get()) != value.size()
+		) {
+			throw DBException("Failed to write sort run: " + path);
+		}
+	}
+	if (std::fclose(file.release()) != 0) {
+		throw DBException("Failed to write sort run: " + path);
+	}
+
+	this->entries.clear();
+	this->arena.clear();
+}
+
+void ExternalSorter::finish(const std::function<void(std::string_view key, std::string_view value)>& emit) {
+	if (this->runs.empty()) {
+		// everything fit in memory
+		this->sortBuffered();
+		for (const auto& entry : this->entries) {
+			emit(this->keyOf(entry), this->valueOf(entry));
+		}
+		this->entries.clear();
+		this->arena.clear();
+		return;
+	}
+
+	this->spill();
+
+	std::vector<std::unique_ptr<RunReader>> readers;
+	readers.reserve(this->runs.size());
+	for (size_t i = 0; i < this->runs.size(); i++) {
+		readers.push_back(std::make_unique<RunReader>(this->runs[i], i));
+	}
+
+	// smallest key first; for equal keys, the most recent run (added last)
+	// comes first
+	auto greater = [](const RunReader* a, const RunReader* b) {
+		int cmp = a->key.compare(b->key);
+		return cmp != 0 ? cmp > 0 : a->index < b->index;
+	};
+	std::priority_queue<RunReader*, std::vector<RunReader*>, decltype(greater)> heap(greater);
+	for (auto& reader : readers) {
+		if (reader->next()) {
+			heap.push(reader.get());
+		}
+	}
+
+	std::string emitted;
+	while (!heap.empty()) {
+		RunReader* reader = heap.top();
+		heap.pop();
+		emit(reader->key, reader->value);
+		emitted = reader->key;
+		if (reader->next()) {
+			heap.push(reader);
+		}
+
+		// drop the older runs' values for the same key
+		while (!heap.empty() && heap.top()->key == emitted) {
+			RunReader* stale = heap.top();
+			heap.pop();
+			if (stale->next()) {
+				heap.push(stale);
+			}
+		}
+	}
+
+	readers.clear();
+	this->removeRuns();
+}
+
+void ExternalSorter::removeRuns() {
+	for (const auto& path : this->runs) {
+		std::remove(path.c_str());
+	}
+	this->runs.clear();
+}
+
+} // namespace rocksdb_js
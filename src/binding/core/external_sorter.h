@@ -0,0 +1,85 @@
+#ifndef __EXTERNAL_SORTER_H__
+#define __EXTERNAL_SORTER_H__
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rocksdb_js {
+
+/**
+ * Sorts key/value pairs that may not fit in memory, for building SST files
+ * from unsorted input.
+ *
+ * Entries are buffered until `memoryLimit` bytes are held, then sorted and
+ * spilled to a run file named `<runPathPrefix>.run-<n>`. `finish()` merges
+ * the runs (and whatever is still buffered) and emits every key once, in
+ * bytewise order — the order of RocksDB's default comparator. When a key is
+ * added more than once, the value added last wins, as it would for a
+ * sequence of puts.
+ *
+ * Run files are removed by `finish()` and by the destructor. I/O errors throw
+ * `DBException`.
+ */
+class ExternalSorter final {
+public:
+	ExternalSorter(std::string runPathPrefix, size_t memoryLimit);
+	~ExternalSorter();
+
+	ExternalSorter(const ExternalSorter&) = delete;
+	ExternalSorter& operator=(const ExternalSorter&) = delete;
+
+	void add(std::string_view key, std::string_view value);
+
+	/**
+	 * Emits the entries in key order, then drops them.
+	 */
+	void finish(const std::function<void(std::string_view key, std::string_view value)>& emit);
+
+	/**
+	 * The number of entries added, counting duplicates.
+	 */
+	uint64_t size() const {
+		return this->count;
+	}
+
+	/**
+	 * The number of runs spilled to disk so far.
+	 */
+	size_t runCount() const {
+		return this->runs.size();
+	}
+
+private:
+	struct Entry {
+		size_t offset;
+		uint32_t keySize;
+		uint32_t valueSize;
+	};
+
+	std::string_view keyOf(const Entry& entry) const {
+		return std::string_view(this->arena.data() + entry.offset, entry.keySize);
+	}
+
+	std::string_view valueOf(const Entry& entry) const {
+		return std::string_view(this->arena.data() + entry.offset + entry.keySize, entry.valueSize);
+	}
+
+	void sortBuffered();
+	void spill();
+	void removeRuns();
+
+	std::string runPathPrefix;
+	size_t memoryLimit;
+	// buffered keys and values, back to back, indexed by `entries`
+	std::string arena;
+	std::vector<Entry> entries;
+	std::vector<std::string> runs;
+	uint64_t count = 0;
+};
+
+} // namespace rocksdb_js
+
+#endif
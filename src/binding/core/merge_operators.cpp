@@ -0,0 +1,210 @@
+#include <bit>
+#include <limits>
+#include "core/merge_operators.h"
+#include "core/verification_table.h"
+
+namespace rocksdb_js {
+
+static uint64_t loadBE64(const char* data) {
+	uint64_t value = 0;
+	for (size_t i = 0; i < 8; ++i) {
+		value = (value << 8) | static_cast<uint8_t>(data[i]);
+	}
+	return value;
+}
+
+static uint32_t loadBE32(const char* data) {
+	uint32_t value = 0;
+	for (size_t i = 0; i < 4; ++i) {
+		value = (value << 8) | static_cast<uint8_t>(data[i]);
+	}
+	return value;
+}
+
+static void appendBE64(std::string& out, uint64_t value) {
+	for (int shift = 56; shift >= 0; shift -= 8) {
+		out.push_back(static_cast<char>((value >> shift) & 0xff));
+	}
+}
+
+static void appendBE32(std::string& out, uint32_t value) {
+	for (int shift = 24; shift >= 0; shift -= 8) {
+		out.push_back(static_cast<char>((value >> shift) & 0xff));
+	}
+}
+
+/**
+ * The float64 version prefix of a value. Values too short to have one sort
+ * below every version.
+ */
+static double versionOf(const rocksdb::Slice& value) {
+	if (value.size() < sizeof(uint64_t)) {
+		return -std::numeric_limits<double>::infinity();
+	}
+	return std::bit_cast<double>(VerificationTable::extractVersionFromValue(value));
+}
+
+/**
+ * Whether `value` is a sequence of length-prefixed elements with nothing
+ * left over.
+ */
+static bool isFramed(const std::string& value) {
+	size_t offset = 0;
+	while (offset < value.size()) {
+		if (value.size() - offset < 4) {
+			return false;
+		}
+		size_t length = loadBE32(value.data() + offset);
+		offset += 4;
+		if (value.size() - offset < length) {
+			return false;
+		}
+		offset += length;
+	}
+	return true;
+}
+
+/**
+ * Drops the oldest elements until the value fits in `limit` bytes, always
+ * keeping the newest element.
+ */
+static void trimFramed(std::string& value, uint32_t limit) {
+	if (limit == 0 || value.size() <= limit) {
+		return;
+	}
+	size_t drop = 0;
+	while (value.size() - drop > limit) {
+		size_t next = drop + 4 + loadBE32(value.data() + drop);
+		if (next >= value.size()) {
+			break;
+		}
+		drop = next;
+	}
+	value.erase(0, drop);
+}
+
+bool parseMergeOperatorKind(const std::string& name, MergeOperatorKind& kind) {
+	if (name == "add") {
+		kind = MergeOperatorKind::Add;
+	} else if (name == "append") {
+		kind = MergeOperatorKind::Append;
+	} else if (name == "maxVersion") {
+		kind = MergeOperatorKind::MaxVersion;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+std::string encodeMergeOperand(MergeOperatorKind kind, uint32_t appendLimit, const rocksdb::Slice& payload) {
+	std::string operand;
+	operand.reserve(MERGE_APPEND_HEADER_SIZE + payload.size());
+	operand.push_back(static_cast<char>(kind));
+	if (kind == MergeOperatorKind::Append) {
+		appendBE32(operand, appendLimit);
+	}
+	operand.append(payload.data(), payload.size());
+	return operand;
+}
+
+bool BuiltinMergeOperator::FullMergeV2(const MergeOperationInput& merge_in, MergeOperationOutput* merge_out) const {
+	std::string& result = merge_out->new_value;
+	bool hasValue = merge_in.existing_value != nullptr;
+	if (hasValue) {
+		result.assign(merge_in.existing_value->data(), merge_in.existing_value->size());
+	} else {
+		result.clear();
+	}
+
+	for (const rocksdb::Slice& operand : merge_in.operand_list) {
+		if (operand.empty()) {
+			return false;
+		}
+
+		switch (static_cast<MergeOperatorKind>(operand[0])) {
+			case MergeOperatorKind::Add: {
+				if (operand.size() != MERGE_OPERAND_HEADER_SIZE + 8) {
+					return false;
+				}
+				uint64_t base = hasValue && result.size() == 8 ? loadBE64(result.data()) : 0;
+				result.clear();
+				appendBE64(result, base + loadBE64(operand.data() + MERGE_OPERAND_HEADER_SIZE));
+				break;
+			}
+
+			case MergeOperatorKind::Append: {
+				if (operand.size() < MERGE_APPEND_HEADER_SIZE) {
+					return false;
+				}
+				uint32_t limit = loadBE32(operand.data() + MERGE_OPERAND_HEADER_SIZE);
+				if (!hasValue || !isFramed(result)) {
+					result.clear();
+				}
+				appendBE32(result, static_cast<uint32_t>(operand.size() - MERGE_APPEND_HEADER_SIZE));
+				result.append(operand.data() + MERGE_APPEND_HEADER_SIZE, operand.size() - MERGE_APPEND_HEADER_SIZE);
+				trimFramed(result, limit);
+				break;
+			}
+
+			case MergeOperatorKind::MaxVersion: {
+				rocksdb::Slice candidate(operand.data() + MERGE_OPERAND_HEADER_SIZE, operand.size() - MERGE_OPERAND_HEADER_SIZE);
+				// on a tie the later write wins, as it would for a put
+				if (!hasValue || versionOf(candidate) >= versionOf(result)) {
+					result.assign(candidate.data(), candidate.size());
+				}
+				break;
+			}
+
+			default:
+				return false;
+		}
+		hasValue = true;
+	}
+
+	return true;
+}
+
+bool BuiltinMergeOperator::PartialMerge(
+	const rocksdb::Slice& /*key*/,
+	const rocksdb::Slice& left_operand,
+	const rocksdb::Slice& right_operand,
+	std::string* new_value,
+	rocksdb::Logger* /*logger*/
+) const {
+	if (left_operand.empty() || right_operand.empty() || left_operand[0] != right_operand[0]) {
+		return false;
+	}
+
+	switch (static_cast<MergeOperatorKind>(left_operand[0])) {
+		case MergeOperatorKind::Add: {
+			if (left_operand.size() != MERGE_OPERAND_HEADER_SIZE + 8 || right_operand.size() != MERGE_OPERAND_HEADER_SIZE + 8) {
+				return false;
+			}
+			new_value->clear();
+			new_value->push_back(static_cast<char>(MergeOperatorKind::Add));
+			appendBE64(
+				*new_value,
+				loadBE64(left_operand.data() + MERGE_OPERAND_HEADER_SIZE) + loadBE64(right_operand.data() + MERGE_OPERAND_HEADER_SIZE)
+			);
+			return true;
+		}
+
+		case MergeOperatorKind::MaxVersion: {
+			rocksdb::Slice left(left_operand.data() + MERGE_OPERAND_HEADER_SIZE, left_operand.size() - MERGE_OPERAND_HEADER_SIZE);
+			rocksdb::Slice right(right_operand.data() + MERGE_OPERAND_HEADER_SIZE, right_operand.size() - MERGE_OPERAND_HEADER_SIZE);
+			const rocksdb::Slice& winner = versionOf(right) >= versionOf(left) ? right_operand : left_operand;
+			new_value->assign(winner.data(), winner.size());
+			return true;
+		}
+
+		default:
+			return false;
+	}
+}
+
+std::shared_ptr<rocksdb::MergeOperator> getBuiltinMergeOperator() {
+	static std::shared_ptr<rocksdb::MergeOperator> mergeOperator = std::make_shared<BuiltinMergeOperator>();
+	return mergeOperator;
+}
+
+} // namespace rocksdb_js
@@ -0,0 +1,80 @@
+#ifndef __MERGE_OPERATORS_H__
+#define __MERGE_OPERATORS_H__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "rocksdb/merge_operator.h"
+#include "rocksdb/slice.h"
+
+namespace rocksdb_js {
+
+/**
+ * The built-in merge operators. The kind is the first byte of every operand,
+ * so the one operator installed on every column family can tell them apart.
+ */
+enum class MergeOperatorKind : uint8_t {
+	None = 0,
+	// Adds a uint64 (8 bytes, big-endian) delta to the value, wrapping on
+	// overflow. A missing or malformed value counts as 0.
+	Add = 1,
+	// Appends the operand as a uint32 big-endian length-prefixed element,
+	// dropping the oldest elements while the value exceeds the size cap.
+	Append = 2,
+	// Keeps the value with the highest float64 version prefix (see
+	// `VerificationTable::extractVersionFromValue()`).
+	MaxVersion = 3,
+};
+
+/**
+ * The size of an operand's header: the kind and, for `Append`, the uint32
+ * big-endian size cap in bytes (0 is unbounded).
+ */
+constexpr size_t MERGE_OPERAND_HEADER_SIZE = 1;
+constexpr size_t MERGE_APPEND_HEADER_SIZE = 5;
+
+/**
+ * Parses a `mergeOperator` option value. Returns `false` for an unknown name.
+ */
+bool parseMergeOperatorKind(const std::string& name, MergeOperatorKind& kind);
+
+/**
+ * Builds the operand passed to `Merge()`: the header followed by `payload`.
+ * For `Add`, `payload` is the 8-byte big-endian delta.
+ */
+std::string encodeMergeOperand(MergeOperatorKind kind, uint32_t appendLimit, const rocksdb::Slice& payload);
+
+/**
+ * Dispatches each operand to the built-in operator named by its header. The
+ * operands of a key are folded in order, so a key written with a `put()`
+ * and then merged starts from the put value.
+ *
+ * Adds and max-version operands are combined in partial merges during
+ * compaction; appends are only combined with the base value, since their
+ * size cap depends on what came before.
+ */
+class BuiltinMergeOperator final : public rocksdb::MergeOperator {
+public:
+	bool FullMergeV2(const MergeOperationInput& merge_in, MergeOperationOutput* merge_out) const override;
+
+	bool PartialMerge(
+		const rocksdb::Slice& key,
+		const rocksdb::Slice& left_operand,
+		const rocksdb::Slice& right_operand,
+		std::string* new_value,
+		rocksdb::Logger* logger
+	) const override;
+
+	const char* Name() const override {
+		return "rocksdb-js.BuiltinMergeOperator";
+	}
+};
+
+/**
+ * Returns the process-wide operator shared by every column family.
+ */
+std::shared_ptr<rocksdb::MergeOperator> getBuiltinMergeOperator();
+
+} // namespace rocksdb_js
+
+#endif
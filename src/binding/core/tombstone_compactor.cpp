@@ -0,0 +1,154 @@
+#include <chrono>
+#include "core/debug.h"
+#include "core/platform.h"
+#include "core/tombstone_compactor.h"
+#include "rocksdb/utilities/table_properties_collectors.h"
+
+namespace rocksdb_js {
+
+std::shared_ptr<rocksdb::TablePropertiesCollectorFactory> newTombstoneCollectorFactory() {
+	return rocksdb::NewCompactOnDeletionCollectorFactory(
+		TOMBSTONE_WINDOW_SIZE,
+		TOMBSTONE_WINDOW_TRIGGER,
+		TOMBSTONE_FILE_RATIO
+	);
+}
+
+TombstoneCompactor::TombstoneCompactor(uint64_t threshold, uint64_t bytesPerSecond, CompactFn compact) :
+	threshold(threshold),
+	bytesPerSecond(bytesPerSecond),
+	compact(std::move(compact))
+{}
+
+TombstoneCompactor::~TombstoneCompactor() {
+	this->shutdown();
+}
+
+void TombstoneCompactor::report(uint32_t cfId, const std::string& start, const std::string& end, uint64_t skipped) {
+	if (skipped == 0) {
+		return;
+	}
+	this->skippedTombstones.fetch_add(skipped, std::memory_order_relaxed);
+	if (skipped < this->threshold) {
+		return;
+	}
+	if (start.empty() && end.empty()) {
+		// compacting the whole column family is left to the marked-file
+		// compactions rather than forced from one iterator's report
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if (this->stopped) {
+			return;
+		}
+		for (const auto& range : this->queue) {
+			if (range.cfId == cfId && range.start == start && range.end == end) {
+				return;
+			}
+		}
+		if (this->queue.size() >= TOMBSTONE_MAX_QUEUED_RANGES) {
+			this->droppedRanges.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		this->queue.push_back(Range{ cfId, start, end });
+		if (!this->started) {
+			this->started = true;
+			// the thread keeps the compactor alive in case it drops the last
+			// reference to the database, which then shuts it down from it
+			this->thread = std::thread([self = this->shared_from_this()]() { self->run(); });
+		}
+	}
+	this->cv.notify_one();
+}
+
+void TombstoneCompactor::recordMarkedFileCompaction(uint64_t inputBytes) {
+	this->markedFileCompactions.fetch_add(1, std::memory_order_relaxed);
+	this->markedFileBytes.fetch_add(inputBytes, std::memory_order_relaxed);
+}
+
+TombstoneCompactionStats TombstoneCompactor::getStats() {
+	TombstoneCompactionStats stats;
+	stats.skippedTombstones = static_cast<double>(this->skippedTombstones.load(std::memory_order_relaxed));
+	stats.droppedRanges = static_cast<double>(this->droppedRanges.load(std::memory_order_relaxed));
+	stats.compactedRanges = static_cast<double>(this->compactedRanges.load(std::memory_order_relaxed));
+	stats.compactedBytes = static_cast<double>(this->compactedBytes.load(std::memory_order_relaxed));
+	stats.failedRanges = static_cast<double>(this->failedRanges.load(std::memory_order_relaxed));
+	stats.markedFileCompactions = static_cast<double>(this->markedFileCompactions.load(std::memory_order_relaxed));
+	stats.markedFileBytes = static_cast<double>(this->markedFileBytes.load(std::memory_order_relaxed));
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		stats.queuedRanges = static_cast<double>(this->queue.size());
+	}
+	return stats;
+}
+
+void TombstoneCompactor::shutdown() {
+	std::thread toJoin;
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->stopped = true;
+		this->queue.clear();
+		if (this->started) {
+			toJoin = std::move(this->thread);
+			this->started = false;
+		}
+	}
+	this->canceled.store(true);
+	this->cv.notify_all();
+	if (toJoin.joinable()) {
+		if (toJoin.get_id() == std::this_thread::get_id()) {
+			// closing the database it dropped the last reference to
+			toJoin.detach();
+		} else {
+			DEBUG_LOG("%p TombstoneCompactor::shutdown Joining compaction thread\n", this);
+			toJoin.join();
+		}
+	}
+}
+
+void TombstoneCompactor::run() {
+	setThreadName("rocksdb-tombs");
+	std::unique_lock<std::mutex> lock(this->mutex);
+	for (;;) {
+		this->cv.wait(lock, [this] { return this->stopped || !this->queue.empty(); });
+		if (this->stopped) {
+			return;
+		}
+		// stays queued while compacting, so the same range is not queued again
+		Range range = this->queue.front();
+		lock.unlock();
+
+		uint64_t bytes = 0;
+		rocksdb::Status status = this->compact(range.cfId, range.start, range.end, &this->canceled, bytes);
+		if (status.ok()) {
+			this->compactedRanges.fetch_add(1, std::memory_order_relaxed);
+			this->compactedBytes.fetch_add(bytes, std::memory_order_relaxed);
+		} else {
+			DEBUG_LOG("%p TombstoneCompactor::run Compaction failed: %s\n", this, status.ToString().c_str());
+			this->failedRanges.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		lock.lock();
+		if (!this->queue.empty()) {
+			this->queue.pop_front();
+		}
+
+		// spend the budget: wait as long as the range takes at the allowed rate
+		if (this->bytesPerSecond > 0 && bytes > 0) {
+			auto wait = std::chrono::milliseconds(bytes * 1000 / this->bytesPerSecond);
+			if (this->cv.wait_for(lock, wait, [this] { return this->stopped; })) {
+				return;
+			}
+		}
+	}
+}
+
+void TombstoneEventListener::OnCompactionCompleted(rocksdb::DB* /*db*/, const rocksdb::CompactionJobInfo& info) {
+	if (info.status.ok() && info.compaction_reason == rocksdb::CompactionReason::kFilesMarkedForCompaction) {
+		this->compactor->recordMarkedFileCompaction(info.stats.total_input_bytes);
+	}
+}
+
+} // namespace rocksdb_js
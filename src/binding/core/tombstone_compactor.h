@@ -0,0 +1,219 @@
+#ifndef __TOMBSTONE_COMPACTOR_H__
+#define __TOMBSTONE_COMPACTOR_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "rocksdb/listener.h"
+#include "rocksdb/perf_context.h"
+#include "rocksdb/perf_level.h"
+#include "rocksdb/status.h"
+#include "rocksdb/table_properties.h"
+
+namespace rocksdb_js {
+
+/**
+ * The table properties collector marks an SST file for compaction when any
+ * window of this many consecutive entries holds at least
+ * `TOMBSTONE_WINDOW_TRIGGER` tombstones, or when tombstones make up at least
+ * `TOMBSTONE_FILE_RATIO` of the whole file.
+ */
+constexpr size_t TOMBSTONE_WINDOW_SIZE = 1024;
+constexpr size_t TOMBSTONE_WINDOW_TRIGGER = 512;
+constexpr double TOMBSTONE_FILE_RATIO = 0.5;
+
+/**
+ * The most ranges waiting to be compacted. Reports past it are dropped.
+ */
+constexpr size_t TOMBSTONE_MAX_QUEUED_RANGES = 64;
+
+/**
+ * Creates the table properties collector that marks deletion-heavy SST files
+ * for compaction, which RocksDB then schedules as background compactions.
+ */
+std::shared_ptr<rocksdb::TablePropertiesCollectorFactory> newTombstoneCollectorFactory();
+
+/**
+ * The `tombstoneCompaction.*` statistics exposed by `db.getStats()` and
+ * `db.getStat()`, as an X-macro — `X(jsKey, TombstoneCompactionStats field)`.
+ */
+#define TOMBSTONE_COMPACTION_STATS(X) \
+	X("tombstoneCompaction.skippedTombstones", skippedTombstones) \
+	X("tombstoneCompaction.queuedRanges", queuedRanges) \
+	X("tombstoneCompaction.droppedRanges", droppedRanges) \
+	X("tombstoneCompaction.compactedRanges", compactedRanges) \
+	X("tombstoneCompaction.compactedBytes", compactedBytes) \
+	X("tombstoneCompaction.failedRanges", failedRanges) \
+	X("tombstoneCompaction.markedFileCompactions", markedFileCompactions) \
+	X("tombstoneCompaction.markedFileBytes", markedFileBytes)
+
+/**
+ * A snapshot of a database's tombstone compaction counters.
+ */
+struct TombstoneCompactionStats final {
+	// tombstones iterators skipped over
+	double skippedTombstones = 0;
+	// ranges waiting to be compacted
+	double queuedRanges = 0;
+	// reports dropped because the queue was full
+	double droppedRanges = 0;
+	double compactedRanges = 0;
+	// estimated size of the compacted ranges
+	double compactedBytes = 0;
+	double failedRanges = 0;
+	// background compactions of files the collector marked, and their input
+	double markedFileCompactions = 0;
+	double markedFileBytes = 0;
+};
+
+/**
+ * Compacts the key ranges that iterators found full of tombstones, one at a
+ * time on a background thread, under a bytes-per-second budget.
+ *
+ * An iterator counts the tombstones it skipped (see `SkippedTombstoneCounter`)
+ * and reports them, with the keys it visited around them, once exhausted or
+ * closed. That range is queued when it skipped at least `threshold`, unless
+ * the same range is already queued or it is unbounded on both sides.
+ * After compacting a range, the thread waits until its estimated size fits
+ * the budget before starting the next.
+ *
+ * The compaction itself is done by the `CompactFn` the database passes in.
+ * It receives an empty `start` or `end` for an unbounded side, never both,
+ * and sets
+ * `bytes` to the estimated size of the range.
+ */
+class TombstoneCompactor final : public std::enable_shared_from_this<TombstoneCompactor> {
+public:
+	using CompactFn = std::function<rocksdb::Status(
+		uint32_t cfId,
+		const std::string& start,
+		const std::string& end,
+		std::atomic<bool>* canceled,
+		uint64_t& bytes
+	)>;
+
+	TombstoneCompactor(uint64_t threshold, uint64_t bytesPerSecond, CompactFn compact);
+	~TombstoneCompactor();
+
+	const uint64_t threshold;
+	const uint64_t bytesPerSecond;
+
+	/**
+	 * Counts the tombstones an iterator skipped within `[start, end)`, and
+	 * queues the range when they reach the threshold and it is bounded on at
+	 * least one side, lazily starting the thread. Ignored once shut down.
+	 */
+	void report(uint32_t cfId, const std::string& start, const std::string& end, uint64_t skipped);
+
+	/**
+	 * Counts a background compaction of files marked by the collector.
+	 */
+	void recordMarkedFileCompaction(uint64_t inputBytes);
+
+	TombstoneCompactionStats getStats();
+
+	/**
+	 * Cancels the running compaction, drops the queue and joins the thread.
+	 * Idempotent. The thread holds a reference to the compactor, so its owner
+	 * must call it once done (see `DBDescriptor::finishClose()`).
+	 */
+	void shutdown();
+
+private:
+	struct Range {
+		uint32_t cfId;
+		std::string start;
+		std::string end;
+	};
+
+	void run();
+
+	CompactFn compact;
+
+	std::mutex mutex;
+	std::condition_variable cv;
+	std::deque<Range> queue;
+	std::thread thread;
+	bool started = false;
+	bool stopped = false;
+	std::atomic<bool> canceled{ false };
+
+	std::atomic<uint64_t> skippedTombstones{ 0 };
+	std::atomic<uint64_t> droppedRanges{ 0 };
+	std::atomic<uint64_t> compactedRanges{ 0 };
+	std::atomic<uint64_t> compactedBytes{ 0 };
+	std::atomic<uint64_t> failedRanges{ 0 };
+	std::atomic<uint64_t> markedFileCompactions{ 0 };
+	std::atomic<uint64_t> markedFileBytes{ 0 };
+};
+
+/**
+ * Counts the tombstones RocksDB skips in the iterator calls made on this
+ * thread while it is in scope, adding them to `total`. Raises the thread's
+ * perf level to `kEnableCount` for the duration when needed. Does nothing
+ * when `enabled` is false.
+ */
+class SkippedTombstoneCounter final {
+public:
+	SkippedTombstoneCounter(uint64_t& total, bool enabled) : total(enabled ? &total : nullptr) {
+		if (this->total) {
+			this->level = rocksdb::GetPerfLevel();
+			if (this->level < rocksdb::PerfLevel::kEnableCount) {
+				rocksdb::SetPerfLevel(rocksdb::PerfLevel::kEnableCount);
+			}
+			this->start = rocksdb::get_perf_context()->internal_delete_skipped_count;
+		}
+	}
+
+	~SkippedTombstoneCounter() {
+		if (this->total) {
+			this->flush();
+			if (this->level < rocksdb::PerfLevel::kEnableCount) {
+				rocksdb::SetPerfLevel(this->level);
+			}
+		}
+	}
+
+	/**
+	 * Adds the tombstones skipped so far to `total`.
+	 */
+	void flush() {
+		if (this->total) {
+			uint64_t skipped = rocksdb::get_perf_context()->internal_delete_skipped_count;
+			*this->total += skipped - this->start;
+			this->start = skipped;
+		}
+	}
+
+	SkippedTombstoneCounter(const SkippedTombstoneCounter&) = delete;
+	SkippedTombstoneCounter& operator=(const SkippedTombstoneCounter&) = delete;
+
+private:
+	uint64_t* total;
+	rocksdb::PerfLevel level = rocksdb::PerfLevel::kDisable;
+	uint64_t start = 0;
+};
+
+/**
+ * Counts the background compactions RocksDB ran for the files the tombstone
+ * collector marked.
+ */
+class TombstoneEventListener final : public rocksdb::EventListener {
+public:
+	explicit TombstoneEventListener(std::shared_ptr<TombstoneCompactor> compactor) : compactor(std::move(compactor)) {}
+
+	void OnCompactionCompleted(rocksdb::DB* db, const rocksdb::CompactionJobInfo& info) override;
+
+private:
+	std::shared_ptr<TombstoneCompactor> compactor;
+};
+
+} // namespace rocksdb_js
+
+#endif
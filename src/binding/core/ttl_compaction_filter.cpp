@@ -0,0 +1,158 @@
+#include <bit>
+#include <chrono>
+#include "core/ttl_compaction_filter.h"
+
+namespace rocksdb_js {
+
+bool TtlRule::expired(const rocksdb::Slice& key, const rocksdb::Slice& value, double now) const {
+	if (value.size() < sizeof(uint64_t)) {
+		return false;
+	}
+	double version = std::bit_cast<double>(VerificationTable::extractVersionFromValue(value));
+
+	if (this->ttl > 0 && version < now - this->ttl) {
+		return true;
+	}
+
+	// expected to be a short list, so a scan beats an index
+	for (const auto& [prefix, expiresBefore] : this->prefixExpiry) {
+		if (version < expiresBefore && key.starts_with(prefix)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void TtlRules::set(uint32_t cfId, std::shared_ptr<const TtlRule> rule) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	if (rule) {
+		this->rules[cfId] = std::move(rule);
+	} else {
+		this->rules.erase(cfId);
+	}
+}
+
+std::shared_ptr<const TtlRule> TtlRules::get(uint32_t cfId) const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	auto it = this->rules.find(cfId);
+	return it == this->rules.end() ? nullptr : it->second;
+}
+
+void TtlRules::addDropped(
+	uint32_t cfId,
+	const TtlRule& rule,
+	std::vector<std::atomic<uint64_t>*>& slots,
+	bool overflowed
+) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	Pending& pending = this->pending[cfId];
+	pending.vt = rule.vt;
+	pending.vtEpoch = rule.vtEpoch;
+	if (overflowed || pending.slots.size() + slots.size() > TTL_MAX_SETTLE_SLOTS) {
+		pending.settlePartition = true;
+		pending.slots.clear();
+	} else if (!pending.settlePartition) {
+		pending.slots.insert(pending.slots.end(), slots.begin(), slots.end());
+	}
+}
+
+void TtlRules::compactionStarted(uint32_t cfId) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->running[cfId]++;
+}
+
+void TtlRules::compactionCompleted(uint32_t cfId) {
+	Pending pending;
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		uint32_t& running = this->running[cfId];
+		if (running > 0) {
+			running--;
+		}
+		auto it = this->pending.find(cfId);
+		if (it == this->pending.end()) {
+			return;
+		}
+		if (running == 0) {
+			pending = std::move(it->second);
+			this->pending.erase(it);
+		} else {
+			pending = it->second;
+		}
+	}
+
+	if (pending.settlePartition) {
+		pending.vt->settlePartition(VerificationTable::partitionFor(pending.vtEpoch, cfId));
+	} else {
+		for (auto* slot : pending.slots) {
+			pending.vt->settleKeySlot(slot);
+		}
+	}
+}
+
+TtlCompactionFilter::TtlCompactionFilter(
+	std::shared_ptr<TtlRules> rules,
+	std::shared_ptr<const TtlRule> rule,
+	uint32_t cfId,
+	double now
+) :
+	rules(std::move(rules)),
+	rule(std::move(rule)),
+	cfId(cfId),
+	now(now)
+{}
+
+TtlCompactionFilter::~TtlCompactionFilter() {
+	if (this->rule->vt && (this->overflowed || !this->droppedSlots.empty())) {
+		this->rules->addDropped(this->cfId, *this->rule, this->droppedSlots, this->overflowed);
+	}
+}
+
+bool TtlCompactionFilter::Filter(
+	int /*level*/,
+	const rocksdb::Slice& key,
+	const rocksdb::Slice& existingValue,
+	std::string* /*newValue*/,
+	bool* /*valueChanged*/
+) const {
+	if (!this->rule->expired(key, existingValue, this->now)) {
+		return false;
+	}
+
+	if (this->rule->vt && !this->overflowed) {
+		if (this->droppedSlots.size() < TTL_MAX_SETTLE_SLOTS) {
+			auto* slot = this->rule->vt->slotFor(this->rule->vtEpoch, this->cfId, key);
+			if (slot) {
+				this->droppedSlots.push_back(slot);
+			}
+		} else {
+			this->overflowed = true;
+			this->droppedSlots.clear();
+			this->droppedSlots.shrink_to_fit();
+		}
+	}
+	return true;
+}
+
+std::unique_ptr<rocksdb::CompactionFilter> TtlCompactionFilterFactory::CreateCompactionFilter(
+	const rocksdb::CompactionFilter::Context& context
+) {
+	auto rule = this->rules->get(context.column_family_id);
+	if (!rule) {
+		return nullptr;
+	}
+	double now = std::chrono::duration<double, std::milli>(
+		std::chrono::system_clock::now().time_since_epoch()
+	).count();
+	return std::make_unique<TtlCompactionFilter>(this->rules, std::move(rule), context.column_family_id, now);
+}
+
+void TtlEventListener::OnCompactionBegin(rocksdb::DB* /*db*/, const rocksdb::CompactionJobInfo& info) {
+	this->rules->compactionStarted(info.cf_id);
+}
+
+void TtlEventListener::OnCompactionCompleted(rocksdb::DB* /*db*/, const rocksdb::CompactionJobInfo& info) {
+	this->rules->compactionCompleted(info.cf_id);
+}
+
+} // namespace rocksdb_js
@@ -0,0 +1,178 @@
+#ifndef __TTL_COMPACTION_FILTER_H__
+#define __TTL_COMPACTION_FILTER_H__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "rocksdb/compaction_filter.h"
+#include "rocksdb/listener.h"
+#include "core/verification_table.h"
+
+namespace rocksdb_js {
+
+/**
+ * The most verification table slots a compaction collects for the keys it
+ * drops. Past it, the column family's whole partition is settled instead.
+ */
+constexpr size_t TTL_MAX_SETTLE_SLOTS = 65536;
+
+/**
+ * When the records of one column family expire, judged by the float64
+ * version timestamp (milliseconds since the epoch) at the start of every
+ * value (see `VerificationTable::extractVersionFromValue()`). Values shorter
+ * than 8 bytes never expire.
+ */
+struct TtlRule final {
+	// Records older than `now - ttl` milliseconds expire. 0 disables it.
+	double ttl = 0;
+
+	// Records whose key starts with a prefix expire while their version is
+	// below the prefix's expiry timestamp.
+	std::vector<std::pair<std::string, double>> prefixExpiry;
+
+	// When set, the slots of dropped keys are settled once the compaction
+	// that dropped them completes.
+	VerificationTable* vt = nullptr;
+	uint64_t vtEpoch = 0;
+
+	bool expired(const rocksdb::Slice& key, const rocksdb::Slice& value, double now) const;
+};
+
+/**
+ * The TTL rules of every column family of a database, read by the filter
+ * each compaction creates, and the verification table slots of the keys
+ * those compactions dropped. Rules can be replaced at any time; a running
+ * compaction keeps the rule it started with.
+ */
+class TtlRules final {
+public:
+	/**
+	 * Replaces the column family's rule. A null rule stops expiring records.
+	 */
+	void set(uint32_t cfId, std::shared_ptr<const TtlRule> rule);
+
+	std::shared_ptr<const TtlRule> get(uint32_t cfId) const;
+
+	/**
+	 * Queues the slots a compaction's filter dropped keys from, settled by
+	 * `compactionCompleted()` once the compaction's output is installed. With
+	 * `overflowed`, the whole partition is settled instead.
+	 */
+	void addDropped(
+		uint32_t cfId,
+		const TtlRule& rule,
+		std::vector<std::atomic<uint64_t>*>& slots,
+		bool overflowed
+	);
+
+	/**
+	 * Counts a compaction of the column family as running.
+	 */
+	void compactionStarted(uint32_t cfId);
+
+	/**
+	 * Settles the queued slots of a column family when one of its compactions
+	 * completes, since the dropped records stay readable until then. The
+	 * slots stay queued, and are settled again, until no compaction of the
+	 * column family is running: the filter of one still running may have
+	 * queued them, and a reader could cache the old version again before its
+	 * output is installed.
+	 */
+	void compactionCompleted(uint32_t cfId);
+
+private:
+	struct Pending {
+		VerificationTable* vt = nullptr;
+		uint64_t vtEpoch = 0;
+		bool settlePartition = false;
+		std::vector<std::atomic<uint64_t>*> slots;
+	};
+
+	mutable std::mutex mutex;
+	std::unordered_map<uint32_t, std::shared_ptr<const TtlRule>> rules;
+	std::unordered_map<uint32_t, Pending> pending;
+	std::unordered_map<uint32_t, uint32_t> running;
+};
+
+/**
+ * Drops expired records while a compaction rewrites them, so expired data
+ * disappears without the tombstones a scan-and-delete would write.
+ */
+class TtlCompactionFilter final : public rocksdb::CompactionFilter {
+public:
+	TtlCompactionFilter(
+		std::shared_ptr<TtlRules> rules,
+		std::shared_ptr<const TtlRule> rule,
+		uint32_t cfId,
+		double now
+	);
+
+	// hands the dropped keys' slots to `TtlRules`
+	~TtlCompactionFilter() override;
+
+	bool Filter(
+		int level,
+		const rocksdb::Slice& key,
+		const rocksdb::Slice& existingValue,
+		std::string* newValue,
+		bool* valueChanged
+	) const override;
+
+	const char* Name() const override {
+		return "rocksdb-js.TtlCompactionFilter";
+	}
+
+private:
+	std::shared_ptr<TtlRules> rules;
+	std::shared_ptr<const TtlRule> rule;
+	uint32_t cfId;
+	double now;
+
+	// a filter is used by a single (sub)compaction thread
+	mutable bool overflowed = false;
+	mutable std::vector<std::atomic<uint64_t>*> droppedSlots;
+};
+
+/**
+ * Creates a filter for each compaction of a column family that has a rule,
+ * with the rule and the time at the start of the compaction.
+ */
+class TtlCompactionFilterFactory final : public rocksdb::CompactionFilterFactory {
+public:
+	explicit TtlCompactionFilterFactory(std::shared_ptr<TtlRules> rules) : rules(std::move(rules)) {}
+
+	std::unique_ptr<rocksdb::CompactionFilter> CreateCompactionFilter(
+		const rocksdb::CompactionFilter::Context& context
+	) override;
+
+	const char* Name() const override {
+		return "rocksdb-js.TtlCompactionFilterFactory";
+	}
+
+private:
+	std::shared_ptr<TtlRules> rules;
+};
+
+/**
+ * Tracks the running compactions of each column family and settles the
+ * slots of the keys they dropped once they complete.
+ */
+class TtlEventListener final : public rocksdb::EventListener {
+public:
+	explicit TtlEventListener(std::shared_ptr<TtlRules> rules) : rules(std::move(rules)) {}
+
+	void OnCompactionBegin(rocksdb::DB* db, const rocksdb::CompactionJobInfo& info) override;
+	void OnCompactionCompleted(rocksdb::DB* db, const rocksdb::CompactionJobInfo& info) override;
+
+private:
+	std::shared_ptr<TtlRules> rules;
+};
+
+} // namespace rocksdb_js
+
+#endif
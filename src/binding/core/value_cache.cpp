@@ -0,0 +1,122 @@
+#include "core/value_cache.h"
+#include <cstring>
+#include <functional>
+
+namespace rocksdb_js {
+
+namespace {
+
+/**
+ * Builds the cache key for a record: the database's per-open epoch and the
+ * column family id, followed by the record key.
+ */
+void makeCompositeKey(std::string& out, uint64_t dbId, uint32_t cfId, std::string_view key) {
+	out.resize(sizeof(dbId) + sizeof(cfId) + key.size());
+	char* p = out.data();
+	::memcpy(p, &dbId, sizeof(dbId));
+	::memcpy(p + sizeof(dbId), &cfId, sizeof(cfId));
+	if (!key.empty()) {
+		::memcpy(p + sizeof(dbId) + sizeof(cfId), key.data(), key.size());
+	}
+}
+
+} // namespace
+
+ValueCache::ValueCache(size_t capacity) : capacity(capacity) {}
+
+ValueCache::Shard& ValueCache::shardFor(std::string_view compositeKey) {
+	return this->shards[std::hash<std::string_view>{}(compositeKey) % SHARDS];
+}
+
+void ValueCache::setCapacity(size_t newCapacity) {
+	this->capacity.store(newCapacity, std::memory_order_relaxed);
+	for (auto& shard : this->shards) {
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		this->evict(shard, newCapacity / SHARDS);
+	}
+}
+
+bool ValueCache::lookup(uint64_t dbId, uint32_t cfId, std::string_view key, uint64_t version, std::string& out) {
+	thread_local std::string compositeKey;
+	makeCompositeKey(compositeKey, dbId, cfId, key);
+
+	Shard& shard = this->shardFor(compositeKey);
+	std::lock_guard<std::mutex> lock(shard.mutex);
+	auto it = shard.index.find(compositeKey);
+	if (it == shard.index.end() || it->second->version != version) {
+		// a version mismatch is left for a newer read to replace or the hand
+		// to evict: the slot may belong to a colliding key
+		shard.misses++;
+		return false;
+	}
+	it->second->referenced = true;
+	out.assign(it->second->value);
+	shard.hits++;
+	return true;
+}
+
+void ValueCache::insert(uint64_t dbId, uint32_t cfId, std::string_view key, uint64_t version, std::string_view value) {
+	size_t budget = this->getCapacity() / SHARDS;
+	thread_local std::string compositeKey;
+	makeCompositeKey(compositeKey, dbId, cfId, key);
+	if (compositeKey.size() + value.size() + ENTRY_OVERHEAD > budget / MAX_ENTRY_FRACTION) {
+		return;
+	}
+
+	Shard& shard = this->shardFor(compositeKey);
+	std::lock_guard<std::mutex> lock(shard.mutex);
+	auto it = shard.index.find(compositeKey);
+	if (it != shard.index.end()) {
+		Entry& entry = *it->second;
+		shard.bytes -= charge(entry);
+		entry.value.assign(value);
+		entry.version = version;
+		shard.bytes += charge(entry);
+	} else {
+		// Inserted just behind the hand, so a new entry gets a full sweep
+		// before it can be evicted.
+		auto node = shard.ring.insert(shard.hand, Entry{ compositeKey, std::string(value), version, false });
+		shard.index.emplace(node->key, node);
+		shard.bytes += charge(*node);
+	}
+	shard.inserts++;
+	this->evict(shard, budget);
+}
+
+/**
+ * Advances the CLOCK hand, clearing reference bits and evicting unreferenced
+ * entries, until the shard fits `budget`. Called with the shard's mutex held.
+ */
+void ValueCache::evict(Shard& shard, size_t budget) {
+	while (shard.bytes > budget && !shard.ring.empty()) {
+		if (shard.hand == shard.ring.end()) {
+			shard.hand = shard.ring.begin();
+		}
+		if (shard.hand->referenced) {
+			shard.hand->referenced = false;
+			++shard.hand;
+			continue;
+		}
+		shard.bytes -= charge(*shard.hand);
+		shard.index.erase(shard.hand->key);
+		shard.hand = shard.ring.erase(shard.hand);
+		shard.evictions++;
+	}
+}
+
+ValueCacheStats ValueCache::getStats() {
+	ValueCacheStats stats;
+	stats.capacity = this->getCapacity();
+	for (auto& shard : this->shards) {
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		stats.bytes += shard.bytes;
+		stats.entries += shard.ring.size();
+		stats.hits += shard.hits;
+		stats.misses += shard.misses;
+		stats.inserts += shard.inserts;
+		stats.evictions += shard.evictions;
+	}
+	return stats;
+}
+
+} // namespace rocksdb_js
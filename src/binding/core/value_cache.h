@@ -0,0 +1,137 @@
+#ifndef __VALUE_CACHE_H__
+#define __VALUE_CACHE_H__
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace rocksdb_js {
+
+/**
+ * A snapshot of the value cache's size and counters, returned by
+ * `valueCacheStats()`.
+ */
+struct ValueCacheStats final {
+	uint64_t capacity = 0;
+	uint64_t bytes = 0;
+	uint64_t entries = 0;
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+	uint64_t inserts = 0;
+	uint64_t evictions = 0;
+};
+
+/**
+ * Process-wide cache of raw record values, shared by every env (main thread
+ * and worker threads), enabled via `config({ valueCacheSize })`.
+ *
+ * Each worker keeps its own decoded-record cache and validates it with the
+ * verification table, so N workers hold N copies of the same hot records and
+ * each misses separately. This cache holds one copy of the value bytes, keyed
+ * by `(vtEpoch, cfId, key)` and tagged with the record version the value
+ * carries. An entry is only served when the key's verification table slot
+ * currently holds that same version — the same proof of freshness a
+ * `verifyVersion()` hit gives a worker's own cache — so writes never need to
+ * touch the cache: they move the slot, and the entry simply stops matching
+ * until a newer read replaces it or it is evicted.
+ *
+ * Memory is bounded by a byte budget (value + key + per-entry overhead),
+ * split evenly across shards, each evicting with the CLOCK algorithm: a hit
+ * sets an entry's reference bit, and the eviction hand clears set bits and
+ * evicts the first entry it finds clear.
+ */
+class ValueCache final {
+public:
+	/**
+	 * The number of independently locked shards.
+	 */
+	static constexpr size_t SHARDS = 16;
+
+	/**
+	 * Bytes charged per entry on top of its key and value.
+	 */
+	static constexpr size_t ENTRY_OVERHEAD = 64;
+
+	/**
+	 * Values larger than this fraction of a shard's budget are not cached, so
+	 * one large record cannot flush a whole shard.
+	 */
+	static constexpr size_t MAX_ENTRY_FRACTION = 4;
+
+	explicit ValueCache(size_t capacity = 0);
+
+	/**
+	 * Returns the process-wide cache (disabled until a capacity is set).
+	 */
+	static ValueCache& getInstance() {
+		static ValueCache instance;
+		return instance;
+	}
+
+	/**
+	 * Sets the byte budget, evicting down to it. 0 disables the cache and
+	 * drops every entry.
+	 */
+	void setCapacity(size_t capacity);
+
+	size_t getCapacity() const {
+		return this->capacity.load(std::memory_order_relaxed);
+	}
+
+	bool enabled() const {
+		return this->getCapacity() > 0;
+	}
+
+	/**
+	 * Copies the cached value for the key into `out` if it is tagged with
+	 * `version`. Returns false on a miss or a version mismatch.
+	 */
+	bool lookup(uint64_t dbId, uint32_t cfId, std::string_view key, uint64_t version, std::string& out);
+
+	/**
+	 * Caches `value` for the key, tagged with `version`, replacing any previous
+	 * entry for the key.
+	 */
+	void insert(uint64_t dbId, uint32_t cfId, std::string_view key, uint64_t version, std::string_view value);
+
+	ValueCacheStats getStats();
+
+private:
+	struct Entry {
+		std::string key;
+		std::string value;
+		uint64_t version;
+		bool referenced;
+	};
+
+	struct alignas(64) Shard {
+		std::mutex mutex;
+		// CLOCK ring; list nodes are stable, so the index can view their keys
+		std::list<Entry> ring;
+		std::unordered_map<std::string_view, std::list<Entry>::iterator> index;
+		std::list<Entry>::iterator hand = ring.end();
+		size_t bytes = 0;
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t inserts = 0;
+		uint64_t evictions = 0;
+	};
+
+	static size_t charge(const Entry& entry) {
+		return entry.key.size() + entry.value.size() + ENTRY_OVERHEAD;
+	}
+
+	Shard& shardFor(std::string_view compositeKey);
+	void evict(Shard& shard, size_t budget);
+
+	std::atomic<size_t> capacity;
+	Shard shards[SHARDS];
+};
+
+} // namespace rocksdb_js
+
+#endif
@@ -1,5 +1,10 @@
 #include "core/verification_table.h"
+#include <algorithm>
+#include <cmath>
 #include <cstring>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <xmmintrin.h>
+#endif
 #include "core/debug.h"
 
 namespace rocksdb_js {
@@ -13,6 +18,23 @@ static std::atomic<uint16_t> vtGlobalGen{0};
 // settled-empty marker is always distinct from the all-zero initial state).
 static std::atomic<uint64_t> vtGlobalSettleGen{1};
 
+// Process-global verification counters, sharded so concurrent readers bump
+// different cache lines. Each thread picks a shard on first use.
+constexpr size_t VT_COUNTER_SHARDS = 16;
+
+struct alignas(64) VTCounterShard {
+	std::atomic<uint64_t> values[static_cast<size_t>(VTCounter::Count)] = {};
+};
+
+static VTCounterShard vtCounterShards[VT_COUNTER_SHARDS];
+static std::atomic<size_t> vtNextCounterShard{0};
+
+inline VTCounterShard& vtThreadCounterShard() {
+	thread_local size_t shard =
+		vtNextCounterShard.fetch_add(1, std::memory_order_relaxed) % VT_COUNTER_SHARDS;
+	return vtCounterShards[shard];
+}
+
 // SplitMix64 finalizer.
 inline uint64_t mix64(uint64_t x) {
 	x ^= x >> 33;
@@ -29,9 +51,9 @@ inline uint64_t loadUnaligned64(const uint8_t* p) {
 	return v;
 }
 
-inline uint64_t hashKeyBytes(const uint8_t* data, size_t len, uint64_t seed) {
-	uint64_t h = seed;
-	size_t i = 0;
+// Continues hashKeyBytes() from byte `i` with running hash `h`, so a caller
+// that has already folded in the first `i` bytes can finish the key.
+inline uint64_t hashKeyBytesFrom(const uint8_t* data, size_t len, size_t i, uint64_t h) {
 	while (i + 8 <= len) {
 		h ^= loadUnaligned64(data + i);
 		h = mix64(h);
@@ -47,6 +69,50 @@ inline uint64_t hashKeyBytes(const uint8_t* data, size_t len, uint64_t seed) {
 	return mix64(h);
 }
 
+inline uint64_t hashKeyBytes(const uint8_t* data, size_t len, uint64_t seed) {
+	return hashKeyBytesFrom(data, len, 0, seed);
+}
+
+// Hashes VT_HASH_LANES keys at once. The 8-byte words the keys have in common
+// are folded in lock step so the independent mix64 multiply chains overlap in
+// the pipeline (and can be auto-vectorized where 64-bit lane multiplies are
+// available); each lane then finishes its own tail. Produces exactly the same
+// hashes as hashKeyBytes().
+constexpr size_t VT_HASH_LANES = 4;
+
+inline void hashKeyBytesLanes(
+	const uint8_t* const* data,
+	const size_t* len,
+	uint64_t seed,
+	uint64_t* out
+) {
+	uint64_t h[VT_HASH_LANES];
+	size_t common = len[0];
+	for (size_t l = 0; l < VT_HASH_LANES; ++l) {
+		h[l] = seed;
+		common = std::min(common, len[l]);
+	}
+	common &= ~static_cast<size_t>(7);
+	for (size_t i = 0; i < common; i += 8) {
+		for (size_t l = 0; l < VT_HASH_LANES; ++l) {
+			h[l] = mix64(h[l] ^ loadUnaligned64(data[l] + i));
+		}
+	}
+	for (size_t l = 0; l < VT_HASH_LANES; ++l) {
+		out[l] = hashKeyBytesFrom(data[l], len[l], common, h[l]);
+	}
+}
+
+inline void prefetchSlot(const std::atomic<uint64_t>* slot) {
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(slot, 0, 1);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	_mm_prefetch(reinterpret_cast<const char*>(slot), _MM_HINT_T1);
+#else
+	(void)slot;
+#endif
+}
+
 inline size_t roundUpToPowerOf2(size_t n) {
 	if (n <= 1) return n;
 	size_t p = 1;
@@ -82,19 +148,30 @@ VerificationTable::VerificationTable(size_t numEntries, uint64_t seed)
 	}
 	size_t n = roundUpToPowerOf2(numEntries);
 	slots_ = std::unique_ptr<std::atomic<uint64_t>[]>(new std::atomic<uint64_t>[n]);
+	tags_ = std::unique_ptr<std::atomic<uint8_t>[]>(new std::atomic<uint8_t>[n]);
 	for (size_t i = 0; i < n; ++i) {
 		slots_[i].store(0, std::memory_order_relaxed);
+		tags_[i].store(VT_PARTITION_NONE, std::memory_order_relaxed);
 	}
 	mask_ = n - 1;
 	DEBUG_LOG(
 		"VerificationTable initialized: %zu slots (%zu bytes), seed=0x%llx\n",
 		n,
-		n * sizeof(std::atomic<uint64_t>),
+		n * (sizeof(std::atomic<uint64_t>) + sizeof(std::atomic<uint8_t>)),
 		static_cast<unsigned long long>(seed)
 	);
 }
 
-VerificationTable::~VerificationTable() = default;
+VerificationTable::~VerificationTable() {
+	{
+		std::lock_guard<std::mutex> lock(samplerMutex_);
+		samplerStop_ = true;
+	}
+	samplerCv_.notify_all();
+	if (sampler_.joinable()) {
+		sampler_.join();
+	}
+}
 
 std::atomic<uint64_t>* VerificationTable::slotFor(
 	uint64_t dbId,
@@ -104,13 +181,94 @@ std::atomic<uint64_t>* VerificationTable::slotFor(
 	if (!slots_) {
 		return nullptr;
 	}
+	uint64_t h = hashKeyBytes(reinterpret_cast<const uint8_t*>(key.data()), key.size(), storeSeed(dbId, cfId));
+	return &slots_[h & mask_];
+}
+
+uint8_t VerificationTable::partitionFor(uint64_t dbId, uint32_t cfId) {
+	// Offset by cfId rather than mixing it in, so up to 254 column families of
+	// one database never share a partition. 1..254: 0 and 0xFF are
+	// VT_PARTITION_NONE / VT_PARTITION_MIXED.
+	return static_cast<uint8_t>(1 + (mix64(dbId) % 254 + cfId) % 254);
+}
+
+uint64_t VerificationTable::storeSeed(uint64_t dbId, uint32_t cfId) const {
 	uint64_t h = seed_;
 	h ^= dbId;
 	h = mix64(h);
 	h ^= static_cast<uint64_t>(cfId);
-	h = mix64(h);
-	h = hashKeyBytes(reinterpret_cast<const uint8_t*>(key.data()), key.size(), h);
-	return &slots_[h & mask_];
+	return mix64(h);
+}
+
+size_t VerificationTable::verifyVersions(
+	uint64_t dbId,
+	uint32_t cfId,
+	const rocksdb::Slice* keys,
+	const uint64_t* versions,
+	size_t count,
+	uint8_t* bitmap
+) const {
+	::memset(bitmap, 0, (count + 7) / 8);
+	if (!slots_) {
+		return 0;
+	}
+
+	// The (db, cf) prefix is the same for every key, so it is mixed once.
+	const uint64_t seed = storeSeed(dbId, cfId);
+	size_t fresh = 0;
+	size_t locked = 0;
+	size_t checked = 0;
+	size_t indexes[VT_VERIFY_CHUNK];
+
+	for (size_t base = 0; base < count; base += VT_VERIFY_CHUNK) {
+		const size_t n = std::min(VT_VERIFY_CHUNK, count - base);
+
+		// Pass 1: hash the chunk and prefetch every slot, so the cache misses
+		// on the slot array overlap instead of being taken one key at a time.
+		size_t i = 0;
+		for (; i + VT_HASH_LANES <= n; i += VT_HASH_LANES) {
+			const uint8_t* data[VT_HASH_LANES];
+			size_t len[VT_HASH_LANES];
+			uint64_t h[VT_HASH_LANES];
+			for (size_t l = 0; l < VT_HASH_LANES; ++l) {
+				data[l] = reinterpret_cast<const uint8_t*>(keys[base + i + l].data());
+				len[l] = keys[base + i + l].size();
+			}
+			hashKeyBytesLanes(data, len, seed, h);
+			for (size_t l = 0; l < VT_HASH_LANES; ++l) {
+				indexes[i + l] = h[l] & mask_;
+				prefetchSlot(&slots_[indexes[i + l]]);
+			}
+		}
+		for (; i < n; ++i) {
+			const rocksdb::Slice& key = keys[base + i];
+			indexes[i] = hashKeyBytes(reinterpret_cast<const uint8_t*>(key.data()), key.size(), seed) & mask_;
+			prefetchSlot(&slots_[indexes[i]]);
+		}
+
+		// Pass 2: compare, with the same semantics as verifyVersion().
+		for (i = 0; i < n; ++i) {
+			uint64_t expected = versions[base + i];
+			if (expected == 0 || vtIsLock(expected)) {
+				continue;
+			}
+			++checked;
+			uint64_t observed = slots_[indexes[i]].load(std::memory_order_acquire);
+			if (observed == expected) {
+				size_t bit = base + i;
+				bitmap[bit >> 3] |= static_cast<uint8_t>(1u << (bit & 7));
+				++fresh;
+			} else if (vtIsLock(observed)) {
+				++locked;
+			}
+		}
+	}
+
+	// Counted once per call rather than per key.
+	vtCount(VTCounter::FreshHit, fresh);
+	vtCount(VTCounter::LockFallback, locked);
+	vtCount(VTCounter::Miss, checked - fresh - locked);
+	return fresh;
 }
 
 bool VerificationTable::verifyVersion(
@@ -120,12 +278,12 @@ bool VerificationTable::verifyVersion(
 	if (!slot || expectedVersion == 0 || vtIsLock(expectedVersion)) {
 		return false;
 	}
-	uint64_t v = slot->load(std::memory_order_acquire);
-	return v == expectedVersion;
+	return vtCheckVersion(slot->load(std::memory_order_acquire), expectedVersion);
 }
 
 bool VerificationTable::populateVersion(
 	std::atomic<uint64_t>* slot,
+	uint8_t partition,
 	uint64_t newVersion
 ) {
 	if (!slot || !vtIsVersion(newVersion)) {
@@ -133,6 +291,7 @@ bool VerificationTable::populateVersion(
 		// settled-empty bit patterns).
 		return false;
 	}
+	tagSlot(slot, partition);
 	uint64_t expected = slot->load(std::memory_order_acquire);
 	while (true) {
 		if (vtIsLock(expected)) {
@@ -155,7 +314,9 @@ bool VerificationTable::populateVersion(
 
 bool VerificationTable::populateVersionIfUnchanged(
 	std::atomic<uint64_t>* slot,
+	uint8_t partition,
 	uint64_t observed,
+	uint64_t observedClearGen,
 	uint64_t newVersion
 ) {
 	if (!slot || !vtIsVersion(newVersion)) {
@@ -168,16 +329,156 @@ bool VerificationTable::populateVersionIfUnchanged(
 	if (observed == newVersion) {
 		return true; // already current; nothing to do
 	}
+	// Tag before reading the partition's clear generation, both sequentially
+	// consistent against settlePartition's generation store and tag scan:
+	// either a concurrent clear's sweep sees this tag (and settles the slot
+	// under the CAS below), or this load sees the clear's generation. A clear
+	// whose generation the caller already saw finished deleting before the read
+	// started, so the read saw post-clear data.
+	tagSlot(slot, partition);
+	uint64_t clearedAt = clearGens_[partition].load(std::memory_order_seq_cst);
+	if (clearedAt != observedClearGen && !(vtIsSettled(observed) && vtSettledGen(observed) > clearedAt)) {
+		// The partition was cleared during the read, so `observed` may predate
+		// the clear and the value read may be pre-clear data. Advance the slot so
+		// the next read observes a post-clear generation and can populate.
+		if (slot->compare_exchange_strong(
+				observed,
+				vtEncodeSettled(vtNextSettleGen()),
+				std::memory_order_release,
+				std::memory_order_acquire
+			)) {
+			return false;
+		}
+		vtCount(VTCounter::PopulateCasFailure);
+		return false;
+	}
 	// Single CAS from the pre-read value. If any write cycle intervened the slot
 	// no longer equals `observed` (it moved to a lock and then to a fresh settle
 	// generation), so this fails and we leave the slot cold rather than publish a
 	// possibly-stale version.
-	return slot->compare_exchange_strong(
-		observed,
-		newVersion,
-		std::memory_order_release,
-		std::memory_order_acquire
-	);
+	if (slot->compare_exchange_strong(
+			observed,
+			newVersion,
+			std::memory_order_release,
+			std::memory_order_acquire
+		)) {
+		return true;
+	}
+	vtCount(VTCounter::PopulateCasFailure);
+	return false;
+}
+
+void VerificationTable::sampleSlots(size_t count) {
+	if (!slots_) return;
+	size_t n = mask_ + 1;
+	count = std::min(count, n);
+
+	size_t start;
+	{
+		std::lock_guard<std::mutex> lock(sampleMutex_);
+		start = sampleCursor_;
+		sampleCursor_ = (sampleCursor_ + count) & mask_;
+	}
+
+	uint64_t versions = 0;
+	uint64_t settled = 0;
+	uint64_t locks = 0;
+	for (size_t i = 0; i < count; ++i) {
+		uint64_t v = slots_[(start + i) & mask_].load(std::memory_order_relaxed);
+		if (vtIsVersion(v)) {
+			++versions;
+		} else if (vtIsSettled(v)) {
+			++settled;
+		} else if (vtIsLock(v)) {
+			++locks;
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(sampleMutex_);
+	sampledSlots_ = count;
+	sampledVersions_ = versions;
+	sampledSettled_ = settled;
+	sampledLocks_ = locks;
+}
+
+void VerificationTable::startSampler(std::chrono::milliseconds interval) {
+	if (!slots_) return;
+	std::lock_guard<std::mutex> lock(samplerMutex_);
+	if (sampler_.joinable() || samplerStop_) return;
+
+	// Take a first sample right away so stats are meaningful before the first
+	// interval elapses.
+	sampleSlots();
+	sampler_ = std::thread([this, interval]() {
+		std::unique_lock<std::mutex> lock(samplerMutex_);
+		while (!samplerCv_.wait_for(lock, interval, [this] { return samplerStop_; })) {
+			lock.unlock();
+			sampleSlots();
+			lock.lock();
+		}
+	});
+}
+
+VerificationTableStats VerificationTable::collectStats(const VerificationTable* vt) {
+	VerificationTableStats stats;
+	stats.freshHits = static_cast<double>(vtCounterTotal(VTCounter::FreshHit));
+	stats.softMisses = static_cast<double>(vtCounterTotal(VTCounter::SoftMiss));
+	stats.lockFallbacks = static_cast<double>(vtCounterTotal(VTCounter::LockFallback));
+	stats.misses = static_cast<double>(vtCounterTotal(VTCounter::Miss));
+	stats.populateCasFailures = static_cast<double>(vtCounterTotal(VTCounter::PopulateCasFailure));
+	stats.parkedReads = static_cast<double>(vtCounterTotal(VTCounter::ParkedRead));
+	if (!vt || !vt->slots_) {
+		return stats;
+	}
+
+	double m = static_cast<double>(vt->mask_ + 1);
+	stats.slots = m;
+
+	uint64_t sampled, versions, settled, locks;
+	{
+		std::lock_guard<std::mutex> lock(vt->sampleMutex_);
+		sampled = vt->sampledSlots_;
+		versions = vt->sampledVersions_;
+		settled = vt->sampledSettled_;
+		locks = vt->sampledLocks_;
+	}
+	if (sampled == 0) {
+		return stats;
+	}
+
+	double s = static_cast<double>(sampled);
+	stats.versionSlots = std::round(m * static_cast<double>(versions) / s);
+	stats.settledSlots = std::round(m * static_cast<double>(settled) / s);
+	// Settled-empty slots are left out: a settle sweep marks every slot,
+	// including ones no key ever hashed to, so counting them would read a swept
+	// table as full.
+	double occupancy = static_cast<double>(versions + locks) / s;
+	stats.occupancy = occupancy;
+
+	// Under uniform hashing, k keys over m slots leave a slot empty with
+	// probability e^-λ (λ = k / m), so the sampled occupancy inverts to an
+	// estimate of λ. A fully occupied sample is clamped to half a slot short of
+	// full to keep the estimate finite.
+	double occ = std::min(occupancy, 1.0 - 0.5 / s);
+	double lambda = -std::log1p(-occ);
+	if (lambda <= 0) {
+		stats.recommendedEntries = 1024;
+		return stats;
+	}
+	double empty = std::exp(-lambda);
+	// Of the occupied slots, the share holding two or more keys.
+	stats.estimatedCollisionRate = (1.0 - empty - lambda * empty) / (1.0 - empty);
+
+	// A key shares its slot with another with probability 1 - e^-(k/m); size
+	// the table so that stays at VT_TARGET_COLLISION_RATE.
+	double estimatedKeys = lambda * m;
+	double target = estimatedKeys / -std::log1p(-VT_TARGET_COLLISION_RATE);
+	double recommended = 1024;
+	while (recommended < target) {
+		recommended *= 2;
+	}
+	stats.recommendedEntries = recommended;
+	return stats;
 }
 
 uint64_t VerificationTable::extractVersionFromValue(const rocksdb::Slice& value) {
@@ -188,6 +489,19 @@ uint64_t VerificationTable::extractVersionFromValue(const rocksdb::Slice& value)
 	return toHostEndian(be);
 }
 
+void vtCount(VTCounter counter, uint64_t n) {
+	if (n == 0) return;
+	vtThreadCounterShard().values[static_cast<size_t>(counter)].fetch_add(n, std::memory_order_relaxed);
+}
+
+uint64_t vtCounterTotal(VTCounter counter) {
+	uint64_t total = 0;
+	for (auto& shard : vtCounterShards) {
+		total += shard.values[static_cast<size_t>(counter)].load(std::memory_order_relaxed);
+	}
+	return total;
+}
+
 uint16_t vtNextGen() {
 	return vtGlobalGen.fetch_add(1, std::memory_order_relaxed) & 0x3FFF;
 }
@@ -196,6 +510,33 @@ uint64_t vtNextSettleGen() {
 	return vtGlobalSettleGen.fetch_add(1, std::memory_order_relaxed) & VT_SETTLED_GEN_MASK;
 }
 
+void VerificationTable::tagSlot(std::atomic<uint64_t>* slot, uint8_t partition) {
+	std::atomic<uint8_t>& tag = tags_[slotIndexOf(slot)];
+	uint8_t current = tag.load(std::memory_order_seq_cst);
+	while (current != partition && current != VT_PARTITION_MIXED) {
+		uint8_t next = current == VT_PARTITION_NONE ? partition : VT_PARTITION_MIXED;
+		if (tag.compare_exchange_weak(current, next, std::memory_order_seq_cst)) {
+			return;
+		}
+	}
+}
+
+void VerificationTable::settleSlot(size_t i, uint64_t settledValue) {
+	uint64_t v = slots_[i].load(std::memory_order_acquire);
+	// CAS non-lock (version or settled-empty) to the sweep generation, retrying
+	// until the CAS lands or the slot turns into a lock (each failed CAS reloads
+	// v; a lock exits via the loop condition).
+	while (!vtIsLock(v)) {
+		if (slots_[i].compare_exchange_strong(
+				v,
+				settledValue,
+				std::memory_order_release,
+				std::memory_order_acquire)) {
+			break;
+		}
+	}
+}
+
 LockTracker* VerificationTable::lockSlotForWrite(std::atomic<uint64_t>* slot, uint64_t dbId) {
 	if (!slot) return nullptr;
 	std::lock_guard<std::mutex> lock(writerMutex_);
@@ -216,6 +557,9 @@ LockTracker* VerificationTable::lockSlotForWrite(std::atomic<uint64_t>* slot, ui
 	LockTracker* t = new LockTracker(slotIndexOf(slot), gen, dbId);
 	t->holders.store(1, std::memory_order_relaxed);
 	t->refcount.store(1, std::memory_order_relaxed); // 1 reference == this holder
+	t->nextInstalled = installedTrackers_;
+	if (installedTrackers_) installedTrackers_->prevInstalled = t;
+	installedTrackers_ = t;
 	slot->store(vtEncodeLock(t, gen), std::memory_order_release);
 	return t;
 }
@@ -234,6 +578,13 @@ void VerificationTable::releaseWriteIntent(std::atomic<uint64_t>* slot, LockTrac
 		uint64_t expected = vtEncodeLock(t, t->generation);
 		slot->compare_exchange_strong(expected, vtEncodeSettled(vtNextSettleGen()),
 		    std::memory_order_release, std::memory_order_acquire);
+		if (t->prevInstalled) {
+			t->prevInstalled->nextInstalled = t->nextInstalled;
+		} else {
+			installedTrackers_ = t->nextInstalled;
+		}
+		if (t->nextInstalled) t->nextInstalled->prevInstalled = t->prevInstalled;
+		t->prevInstalled = t->nextInstalled = nullptr;
 		t->wake();
 	}
 	if (t->refcount.fetch_sub(1, std::memory_order_acq_rel) == 1) delete t;
@@ -255,6 +606,26 @@ void VerificationTable::unrefTracker(LockTracker* t) {
 	if (t->refcount.fetch_sub(1, std::memory_order_acq_rel) == 1) delete t;
 }
 
+void VerificationTable::settlePartition(uint8_t partition) {
+	if (!slots_) return;
+	// Minted before the sweep's settle generation, so a slot settled below is
+	// always newer than the recorded clear.
+	clearGens_[partition].store(vtNextSettleGen(), std::memory_order_seq_cst);
+	const uint64_t settledValue = vtEncodeSettled(vtNextSettleGen());
+	size_t n = mask_ + 1;
+	for (size_t i = 0; i < n; ++i) {
+		uint8_t tag = tags_[i].load(std::memory_order_seq_cst);
+		if (tag != partition && tag != VT_PARTITION_MIXED) continue;
+		// Lock slots keep their tag; the write-intent lifecycle settles them.
+		if (vtIsLock(slots_[i].load(std::memory_order_acquire))) continue;
+		// Reset the tag before settling: a populate that re-tags the slot after
+		// this either has its CAS overwritten or failed by the settle below, or
+		// observed the settled value and so read post-clear data.
+		tags_[i].store(VT_PARTITION_NONE, std::memory_order_seq_cst);
+		settleSlot(i, settledValue);
+	}
+}
+
 void VerificationTable::settleAllSlots() {
 	if (!slots_) return;
 	size_t n = mask_ + 1;
@@ -264,51 +635,40 @@ void VerificationTable::settleAllSlots() {
 	// that for all slots, and hoisting avoids n atomic fetch-adds.
 	const uint64_t settledValue = vtEncodeSettled(vtNextSettleGen());
 	for (size_t i = 0; i < n; ++i) {
-		uint64_t v = slots_[i].load(std::memory_order_acquire);
 		// Skip lock slots — the write-intent lifecycle (releaseWriteIntent)
 		// advances them to a fresh settled-empty when the last holder releases.
 		// A concurrent lockSlotForWrite uses an unconditional store (under
 		// writerMutex_) that can race with our CAS; if it wins, the slot is a
 		// lock that will advance further when committed/aborted — still correct.
-		if (vtIsLock(v)) continue;
-		// CAS non-lock (version or settled-empty) to the sweep generation,
-		// retrying until the CAS lands or the slot turns into a lock (each
-		// failed CAS reloads v; a lock exits via the loop condition).
-		while (!vtIsLock(v)) {
-			if (slots_[i].compare_exchange_strong(
-					v,
-					settledValue,
-					std::memory_order_release,
-					std::memory_order_acquire)) {
-				break;
-			}
-		}
+		if (vtIsLock(slots_[i].load(std::memory_order_acquire))) continue;
+		tags_[i].store(VT_PARTITION_NONE, std::memory_order_seq_cst);
+		settleSlot(i, settledValue);
 	}
 }
 
+void VerificationTable::settleKeySlot(std::atomic<uint64_t>* slot) {
+	if (!slot) return;
+	settleSlot(slotIndexOf(slot), vtEncodeSettled(vtNextSettleGen()));
+}
+
 void VerificationTable::cancelForDB(uint64_t dbId) {
 	if (!slots_) return;
 	std::lock_guard<std::mutex> lock(writerMutex_);
-	size_t n = mask_ + 1;
-	for (size_t i = 0; i < n; ++i) {
-		uint64_t v = slots_[i].load(std::memory_order_acquire);
-		if (!vtIsLock(v)) continue;
-
-		// Holding writerMutex_ means no concurrent release can free this tracker
-		// out from under us, so the loaded pointer is safe to dereference.
-		LockTracker* t = vtDecodeLock(v);
-		uint16_t gen = vtGenFromLock(v);
+	for (LockTracker* t = installedTrackers_; t; t = t->nextInstalled) {
+		// Holding writerMutex_ means no concurrent release can unlink or free
+		// this tracker out from under us.
 		if (t->dbId != dbId) continue;
 
-		// Settle the slot to a fresh settled-empty generation; may fail
-		// harmlessly if it changed. (Like releaseWriteIntent, never back to 0.)
-		uint64_t expected = vtEncodeLock(t, gen);
-		slots_[i].compare_exchange_strong(expected, vtEncodeSettled(vtNextSettleGen()),
+		// Settle the slot to a fresh settled-empty generation; fails harmlessly
+		// if an earlier cancel already moved it. (Like releaseWriteIntent, never
+		// back to 0.)
+		uint64_t expected = vtEncodeLock(t, t->generation);
+		slots_[t->slotIndex].compare_exchange_strong(expected, vtEncodeSettled(vtNextSettleGen()),
 		    std::memory_order_release, std::memory_order_acquire);
 
 		// Wake any parked TSFN waiters — idempotent if already woken. The
-		// outstanding holders' releaseWriteIntent calls will free the tracker;
-		// cancelForDB only clears the slot and unparks waiters.
+		// outstanding holders' releaseWriteIntent calls unlink and free the
+		// tracker; cancelForDB only clears the slot and unparks waiters.
 		t->wake();
 	}
 }
@@ -2,10 +2,13 @@
 #define __VERIFICATION_TABLE_H__
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 #include "rocksdb/slice.h"
 
@@ -42,6 +45,13 @@ struct LockTracker;
  * Hash collisions are intentional. Two different keys hashing to the same
  * slot will spuriously share state; this can cause false invalidations
  * (revert to slow path) but never incorrect results.
+ *
+ * Alongside each slot is a one-byte partition tag recording which store —
+ * (db, cf), hashed to one of 254 partitions (see partitionFor) — published a
+ * version into it, or VT_PARTITION_MIXED once several have. It lets a bulk
+ * delete (clear, drop) settle only its own partition's slots instead of the
+ * whole process-global table (see settlePartition). Tags are written only by
+ * the cold populate path and the sweeps; the verify hot path never reads them.
  */
 
 constexpr uint64_t VT_TAG_BIT     = 1ULL << 63;             // 1 = not a version
@@ -56,6 +66,13 @@ inline bool vtIsVersion(uint64_t v) { return v != 0 && (v & VT_TAG_BIT) == 0; }
 inline bool vtIsLock(uint64_t v)    { return (v & VT_TAG_BIT) != 0 && (v & VT_SETTLED_BIT) == 0; }
 // A settled-empty marker: tagged with the settled bit set (carries a generation).
 inline bool vtIsSettled(uint64_t v) { return (v & VT_TAG_BIT) != 0 && (v & VT_SETTLED_BIT) != 0; }
+// Settle generation of a settled-empty value.
+inline uint64_t vtSettledGen(uint64_t v) { return v & VT_SETTLED_GEN_MASK; }
+
+// Partition tags: no store has published into the slot since it was last
+// swept / published by more than one store.
+constexpr uint8_t VT_PARTITION_NONE  = 0;
+constexpr uint8_t VT_PARTITION_MIXED = 0xFF;
 
 // LockTracker slot encoding helpers.
 // x86-64 canonical user-space pointers fit in 48 bits.
@@ -85,7 +102,8 @@ inline uint64_t vtEncodeSettled(uint64_t gen) {
  *
  * Lifetime: heap-allocated; freed when refcount drops to zero.
  *
- * Phase 3 will add: waitersMutex + waiters[] for TSFN-based wake-up.
+ * Parked readers (async `get()` with `waitForWrite`) register wake callbacks
+ * that marshal back to their env through `ParkedReads`.
  */
 struct LockTracker {
 	std::atomic<uint32_t> refcount{1};  // 1 for the slot reference + 1 per holder
@@ -94,6 +112,11 @@ struct LockTracker {
 	size_t                slotIndex;    // index in VT slots_ array (for cancelForDB)
 	uint64_t              dbId;         // per-open epoch of the owning DB (DBDescriptor::vtEpoch)
 
+	// Links in the table's list of installed trackers (guarded by the table's
+	// writerMutex_), so cancelForDB visits in-flight locks instead of every slot.
+	LockTracker*          prevInstalled{nullptr};
+	LockTracker*          nextInstalled{nullptr};
+
 	bool                               woken{false};
 	std::mutex                         wakeCallbacksMutex;
 	std::vector<std::function<void()>> wakeCallbacks;
@@ -116,6 +139,93 @@ struct LockTracker {
 	void wake();
 };
 
+/**
+ * Process-wide verification table counters. Bumped on the read hot path, so
+ * they are sharded per thread (see vtCount) rather than a single contended
+ * atomic per counter.
+ *
+ *   FreshHit           : a version check matched the slot, no read needed
+ *   SoftMiss           : a check missed but the value read back still carried
+ *                        the expected version (a false invalidation: a
+ *                        colliding key, a settle sweep or a cold slot); a
+ *                        subset of the LockFallback and Miss outcomes
+ *   LockFallback       : a check found the slot lock-tagged (write in flight)
+ *                        and fell back to a read
+ *   Miss               : any other failed check (stale, settled or empty slot)
+ *   PopulateCasFailure : a cold populate lost its CAS to an intervening write
+ *   ParkedRead         : an async read with `waitForWrite` found the slot
+ *                        lock-tagged and parked until the write settled
+ */
+enum class VTCounter : uint8_t {
+	FreshHit,
+	SoftMiss,
+	LockFallback,
+	Miss,
+	PopulateCasFailure,
+	ParkedRead,
+	Count
+};
+
+void vtCount(VTCounter counter, uint64_t n = 1);
+uint64_t vtCounterTotal(VTCounter counter);
+
+/**
+ * Compares a loaded slot value against the caller's expected version and
+ * counts the outcome. Returns true on a fresh hit.
+ */
+inline bool vtCheckVersion(uint64_t observed, uint64_t expectedVersion) {
+	if (observed == expectedVersion) {
+		vtCount(VTCounter::FreshHit);
+		return true;
+	}
+	vtCount(vtIsLock(observed) ? VTCounter::LockFallback : VTCounter::Miss);
+	return false;
+}
+
+/**
+ * The `verificationTable.*` statistics exposed by `db.getStats()` and
+ * `db.getStat()`, as an X-macro — `X(jsKey, VerificationTableStats field)`.
+ * The table is process-global, so every database reports the same values.
+ */
+#define VERIFICATION_TABLE_STATS(X) \
+	X("verificationTable.freshHits", freshHits) \
+	X("verificationTable.softMisses", softMisses) \
+	X("verificationTable.lockFallbacks", lockFallbacks) \
+	X("verificationTable.misses", misses) \
+	X("verificationTable.populateCasFailures", populateCasFailures) \
+	X("verificationTable.parkedReads", parkedReads) \
+	X("verificationTable.slots", slots) \
+	X("verificationTable.versionSlots", versionSlots) \
+	X("verificationTable.settledSlots", settledSlots) \
+	X("verificationTable.occupancy", occupancy) \
+	X("verificationTable.estimatedCollisionRate", estimatedCollisionRate) \
+	X("verificationTable.recommendedEntries", recommendedEntries)
+
+/**
+ * A snapshot of the verification table counters and the estimates derived
+ * from the most recent background occupancy sample.
+ */
+struct VerificationTableStats final {
+	double freshHits = 0;
+	double softMisses = 0;
+	double lockFallbacks = 0;
+	double misses = 0;
+	double populateCasFailures = 0;
+	double parkedReads = 0;
+	// table size in slots
+	double slots = 0;
+	// estimated number of slots holding a version / a settled-empty marker
+	double versionSlots = 0;
+	double settledSlots = 0;
+	// fraction of slots holding a version or a lock
+	double occupancy = 0;
+	// estimated fraction of in-use slots shared by more than one key
+	double estimatedCollisionRate = 0;
+	// power-of-two slot count that would keep the chance of a key sharing its
+	// slot near VT_TARGET_COLLISION_RATE for the estimated number of keys
+	double recommendedEntries = 0;
+};
+
 // Returns a fresh 14-bit generation tag for a new LockTracker install.
 // Process-global monotonic counter wraps every 16 K installs.
 uint16_t vtNextGen();
@@ -130,9 +240,9 @@ class VerificationTable final {
 public:
 	/**
 	 * Construct a table with at least `numEntries` atomic slots. The actual
-	 * size is rounded up to the next power of two. A `numEntries` of 0
-	 * disables the table; `slotFor()` then returns null and all helpers are
-	 * no-ops.
+	 * size is rounded up to the next power of two; each slot costs 8 bytes plus
+	 * a 1-byte partition tag. A `numEntries` of 0 disables the table;
+	 * `slotFor()` then returns null and all helpers are no-ops.
 	 */
 	VerificationTable(size_t numEntries, uint64_t seed);
 	~VerificationTable();
@@ -147,6 +257,37 @@ public:
 		const rocksdb::Slice& key
 	) const;
 
+	/**
+	 * Returns the partition (1..254) the given store's slots are tagged with.
+	 * Column families of one database get distinct partitions; stores of
+	 * different databases may share one, which only widens what a clear
+	 * invalidates.
+	 */
+	static uint8_t partitionFor(uint64_t dbId, uint32_t cfId);
+
+	/**
+	 * Batched verifyVersion() for `count` keys of one (db, cf). Sets bit `i`
+	 * of `bitmap` (LSB first, `(count + 7) / 8` bytes, cleared first) when
+	 * the slot for `keys[i]` holds `versions[i]`. Keys are hashed several at a
+	 * time and all slots of a chunk are prefetched before any is loaded, so a
+	 * page of keys costs one pass over the slot array's cache misses rather
+	 * than one miss per key. Returns the number of fresh keys.
+	 */
+	size_t verifyVersions(
+		uint64_t dbId,
+		uint32_t cfId,
+		const rocksdb::Slice* keys,
+		const uint64_t* versions,
+		size_t count,
+		uint8_t* bitmap
+	) const;
+
+	/**
+	 * The number of keys verifyVersions() hashes and prefetches before it
+	 * starts loading slots.
+	 */
+	static constexpr size_t VT_VERIFY_CHUNK = 64;
+
 	/**
 	 * Returns true if the slot currently holds a version equal to
 	 * `expectedVersion`.
@@ -158,9 +299,19 @@ public:
 	 * (0, a settled-empty marker, or an older version) except a lock, which is
 	 * never overwritten. This is the low-level "force set" primitive behind the
 	 * explicit populateVersion() JS API; the cold read path uses
-	 * populateVersionIfUnchanged() instead. Returns true on success.
+	 * populateVersionIfUnchanged() instead. Tags the slot with `partition`.
+	 * Returns true on success.
 	 */
-	static bool populateVersion(std::atomic<uint64_t>* slot, uint64_t newVersion);
+	bool populateVersion(std::atomic<uint64_t>* slot, uint8_t partition, uint64_t newVersion);
+
+	/**
+	 * The generation of the latest clear of `partition` (0 if it was never
+	 * cleared). A cold read loads it before it loads the slot value it later
+	 * passes to populateVersionIfUnchanged().
+	 */
+	uint64_t clearGeneration(uint8_t partition) const {
+		return clearGens_[partition].load(std::memory_order_seq_cst);
+	}
 
 	/**
 	 * Conditionally publishes `newVersion`, succeeding only if the slot still
@@ -171,10 +322,20 @@ public:
 	 * generation, so it can never restore `observed`). Therefore it can never
 	 * publish a stale or superseded version. Skips (returns false) when `observed`
 	 * is a lock or `newVersion` is not a real version.
+	 *
+	 * The slot is tagged with `partition` before the CAS. `observedClearGen`
+	 * is the partition's clearGeneration() loaded along with `observed`. If the
+	 * partition was cleared (settlePartition) since then and `observed` is not
+	 * a settled-empty marker minted after that clear, the read may have seen
+	 * pre-clear data in a slot the clear did not sweep, so the slot is advanced
+	 * to a fresh settled-empty generation instead and the next read populates
+	 * it. Reads that observed the slot after the clear publish as usual.
 	 */
-	static bool populateVersionIfUnchanged(
+	bool populateVersionIfUnchanged(
 		std::atomic<uint64_t>* slot,
+		uint8_t partition,
 		uint64_t observed,
+		uint64_t observedClearGen,
 		uint64_t newVersion
 	);
 
@@ -190,6 +351,41 @@ public:
 	static uint64_t extractVersionFromValue(const rocksdb::Slice& value);
 
 	size_t size() const { return slots_ ? mask_ + 1 : 0; }
+
+	/**
+	 * Counts the slot classes in the next `count` slots (wrapping around) and
+	 * publishes them as the current occupancy sample. Called periodically by
+	 * the background sampler; successive windows cover the whole table.
+	 */
+	void sampleSlots(size_t count = VT_SAMPLE_WINDOW);
+
+	/**
+	 * Starts the background thread that calls sampleSlots() every `interval`.
+	 * Idempotent; a no-op when the table is disabled. The thread is stopped and
+	 * joined by the destructor.
+	 */
+	void startSampler(std::chrono::milliseconds interval = std::chrono::milliseconds(VT_SAMPLE_INTERVAL_MS));
+
+	/**
+	 * Returns the process-wide counters and, when `vt` is non-null, the table
+	 * size and occupancy estimates from its latest sample.
+	 */
+	static VerificationTableStats collectStats(const VerificationTable* vt);
+
+	/**
+	 * The number of slots scanned per background sample.
+	 */
+	static constexpr size_t VT_SAMPLE_WINDOW = 16384;
+
+	/**
+	 * How often the background sampler runs.
+	 */
+	static constexpr uint32_t VT_SAMPLE_INTERVAL_MS = 5000;
+
+	/**
+	 * The per-key collision probability recommendedEntries is sized for.
+	 */
+	static constexpr double VT_TARGET_COLLISION_RATE = 0.05;
 	uint64_t seed() const { return seed_; }
 
 	/**
@@ -201,9 +397,11 @@ public:
 	}
 
 	/**
-	 * Safety-net scan called from DBDescriptor::close(). Finds every slot
-	 * whose LockTracker was installed by the given database, CASes it back to
-	 * 0, and calls wake() to unpark any parked TSFN waiters.
+	 * Safety-net pass called from DBDescriptor::close(). Finds every installed
+	 * LockTracker owned by the given database, settles its slot to a fresh
+	 * settled-empty generation, and calls wake() to unpark any parked TSFN
+	 * waiters. Walks the in-flight trackers, not the table, so it only touches
+	 * the closing database's slots.
 	 *
 	 * Under normal shutdown all TransactionHandle::close() calls already do
 	 * this via releaseIntent(); cancelForDB() is a defensive final pass for
@@ -211,14 +409,39 @@ public:
 	 */
 	void cancelForDB(uint64_t dbId);
 
+	/**
+	 * Settles the slots of one partition after a bulk delete of one store
+	 * (clear, drop). Records a clear generation for the partition, then
+	 * advances every non-lock slot tagged with it (or VT_PARTITION_MIXED) to a
+	 * fresh settled-empty generation and resets its tag. Versions published by
+	 * the store before the clear can no longer verify, and a populate that
+	 * observed a slot before the clear either finds the slot swept (its CAS
+	 * fails) or finds the clear generation newer than what it observed (see
+	 * populateVersionIfUnchanged). Other partitions' entries stay cached.
+	 *
+	 * Ordering: call AFTER the data-delete operations complete.
+	 *
+	 * Cost: the sweep reads the tag of every slot in the table, so a clear is
+	 * O(table size) no matter how few slots the partition holds. That is fine
+	 * for clear(), which already deletes the whole column family, but keep it
+	 * off any per-key path.
+	 */
+	void settlePartition(uint8_t partition);
+
+	/**
+	 * Advances one non-lock slot to a fresh settled-empty generation, so the
+	 * version it held can no longer verify, after a key was deleted outside a
+	 * write (a compaction filter dropping it). Lock slots are skipped, as in
+	 * settlePartition(). Ordering: call AFTER the delete is visible.
+	 */
+	void settleKeySlot(std::atomic<uint64_t>* slot);
+
 	/**
 	 * Sweeps every non-lock slot in the table and advances it to a fresh
-	 * settled-empty generation. Called after a bulk-delete operation (clear)
-	 * to ensure that any pre-clear version cached in a slot can no longer be
-	 * re-published via a concurrent populate CAS. The sweep is coarse (it
-	 * covers all slots, not just those for the cleared store) because slot
-	 * identities are not tracked in version or settled-empty slots — only in
-	 * LockTracker, which belongs to lock slots that are intentionally skipped.
+	 * settled-empty generation. Called after a bulk write that may span every
+	 * store of a database (transaction log replay) to ensure that any earlier
+	 * version cached in a slot can no longer be re-published via a concurrent
+	 * populate CAS. Single-store bulk deletes use settlePartition() instead.
 	 *
 	 * Lock slots are skipped: the write-intent lifecycle already advances them
 	 * to a fresh settled-empty generation when the last holder releases. A
@@ -272,14 +495,55 @@ public:
 	void unrefTracker(LockTracker* tracker);
 
 private:
+	/**
+	 * The hash state after mixing in the (db, cf) prefix that every key of a
+	 * store shares.
+	 */
+	uint64_t storeSeed(uint64_t dbId, uint32_t cfId) const;
+
+	/**
+	 * Adds `partition` to the slot's tag (none -> partition, another partition
+	 * -> mixed).
+	 */
+	void tagSlot(std::atomic<uint64_t>* slot, uint8_t partition);
+
+	/**
+	 * Advances slot `i` to `settledValue` unless it is (or becomes) a lock.
+	 */
+	void settleSlot(size_t i, uint64_t settledValue);
+
 	std::unique_ptr<std::atomic<uint64_t>[]> slots_;
+	std::unique_ptr<std::atomic<uint8_t>[]> tags_;
 	size_t mask_;
 	uint64_t seed_;
 
+	// Settle generation minted by the latest settlePartition() of each
+	// partition (0 = never cleared).
+	std::atomic<uint64_t> clearGens_[256] = {};
+
+	// Head of the installed LockTracker list (see LockTracker::nextInstalled),
+	// guarded by writerMutex_.
+	LockTracker* installedTrackers_ = nullptr;
+
 	// Serializes all LockTracker install / join / release / reference / reclaim
 	// operations (see the write-intent lifecycle methods above). Not taken on
 	// the lock-free read path.
 	std::mutex writerMutex_;
+
+	// Latest occupancy sample and the position the next one starts at, guarded
+	// by sampleMutex_.
+	mutable std::mutex sampleMutex_;
+	size_t sampleCursor_ = 0;
+	uint64_t sampledSlots_ = 0;
+	uint64_t sampledVersions_ = 0;
+	uint64_t sampledSettled_ = 0;
+	uint64_t sampledLocks_ = 0;
+
+	// Background sampler thread (see startSampler).
+	std::thread sampler_;
+	std::mutex samplerMutex_;
+	std::condition_variable samplerCv_;
+	bool samplerStop_ = false;
 };
 
 } // namespace rocksdb_js
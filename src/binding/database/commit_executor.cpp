@@ -0,0 +1,91 @@
+#include "database/commit_executor.h"
+
+namespace rocksdb_js {
+
+CommitExecutor& CommitExecutor::getInstance() {
+	// Intentionally leaked: the lanes are joined by nobody at process exit, so
+	// static destruction can't race a lane still finishing a commit.
+	static CommitExecutor* instance = new CommitExecutor();
+	return *instance;
+}
+
+void CommitExecutor::setLaneCount(uint32_t count) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->laneCount = count;
+	while (this->lanes.size() < count) {
+		// threads are started lazily on the first task
+		this->lanes.push_back(std::make_shared<CommitWorker>("rocksdb-lane"));
+	}
+	DEBUG_LOG("CommitExecutor::setLaneCount Using %u shared commit lanes (%zu allocated)\n", count, this->lanes.size());
+}
+
+uint32_t CommitExecutor::getLaneCount() {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->laneCount;
+}
+
+std::shared_ptr<CommitWorker> CommitExecutor::acquireLane(uint64_t hash, uint32_t offset, int32_t& laneIndex) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	if (this->laneCount == 0) {
+		laneIndex = -1;
+		return nullptr;
+	}
+	laneIndex = static_cast<int32_t>((hash + offset) % this->laneCount);
+	return this->lanes[laneIndex];
+}
+
+std::vector<size_t> CommitExecutor::laneDepths() {
+	std::vector<std::shared_ptr<CommitWorker>> lanes;
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		lanes = this->lanes;
+	}
+	std::vector<size_t> depths;
+	depths.reserve(lanes.size());
+	for (auto& lane : lanes) {
+		depths.push_back(lane->depth());
+	}
+	return depths;
+}
+
+uint64_t CommitExecutor::hashKey(const std::string& key) {
+	uint64_t hash = 14695981039346656037ull;
+	for (unsigned char c : key) {
+		hash ^= c;
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+void CommitLaneTracker::enqueue(const std::shared_ptr<CommitWorker>& lane, std::function<void()> task) {
+	bool runInline = false;
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		runInline = this->closed;
+		if (!runInline) {
+			++this->pending;
+		}
+	}
+	if (runInline) {
+		// a commit racing close fails fast on the database's closing checks
+		DEBUG_LOG("%p CommitLaneTracker::enqueue Tracker closed, running task inline\n", this);
+		task();
+		return;
+	}
+	auto self = this->shared_from_this();
+	lane->enqueue([self, task = std::move(task)]() {
+		task();
+		std::lock_guard<std::mutex> lock(self->mutex);
+		if (--self->pending == 0) {
+			self->cv.notify_all();
+		}
+	});
+}
+
+void CommitLaneTracker::drain() {
+	std::unique_lock<std::mutex> lock(this->mutex);
+	this->cv.wait(lock, [this] { return this->pending == 0; });
+	this->closed = true;
+}
+
+} // namespace rocksdb_js
@@ -0,0 +1,100 @@
+#ifndef __COMMIT_EXECUTOR_H__
+#define __COMMIT_EXECUTOR_H__
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "database/commit_worker.h"
+
+namespace rocksdb_js {
+
+/**
+ * The upper bound for `config({ commitLanes })`.
+ */
+#define COMMIT_EXECUTOR_MAX_LANES 256
+
+/**
+ * A process-wide set of commit lanes shared by every database, enabled via
+ * `config({ commitLanes: N })`. By default (0 lanes) each `DBDescriptor` runs
+ * its own commit (and, in two-lane mode, log) thread, which for processes that
+ * open many databases means many mostly idle threads contending for the CPU
+ * during bursts.
+ *
+ * With lanes enabled, a database is mapped onto a lane by a stable hash of its
+ * path when it is opened. All of a database's commits go through that one
+ * FIFO lane, so per-database commit order is preserved exactly as with a
+ * dedicated worker, and each lane wakeup drains the queued commits of every
+ * database mapped to it in one pass.
+ *
+ * Lanes are only ever added: lowering the count affects databases opened
+ * afterwards, while already-open databases keep the lane they were assigned.
+ */
+struct CommitExecutor final {
+	static CommitExecutor& getInstance();
+
+	/**
+	 * Sets the number of lanes new databases are spread across. 0 disables the
+	 * shared lanes (dedicated per-database workers).
+	 */
+	void setLaneCount(uint32_t count);
+
+	uint32_t getLaneCount();
+
+	/**
+	 * Returns the lane for a database, or nullptr when shared lanes are
+	 * disabled. `offset` selects a neighbouring lane for the same database
+	 * (used to place the log lane next to the commit lane in two-lane mode).
+	 */
+	std::shared_ptr<CommitWorker> acquireLane(uint64_t hash, uint32_t offset, int32_t& laneIndex);
+
+	/**
+	 * Number of queued (not yet started) tasks per lane, including lanes no
+	 * longer assigned to new databases. Diagnostic only.
+	 */
+	std::vector<size_t> laneDepths();
+
+	/**
+	 * FNV-1a hash of a database path. Stable across runs so a database always
+	 * maps to the same lane for a given lane count.
+	 */
+	static uint64_t hashKey(const std::string& key);
+
+private:
+	CommitExecutor() = default;
+
+	std::mutex mutex;
+	uint32_t laneCount = 0;
+	std::vector<std::shared_ptr<CommitWorker>> lanes;
+};
+
+/**
+ * Tracks a database's tasks queued on shared lanes so that closing the
+ * database can wait for them to drain, the way shutting down a dedicated
+ * worker does. Held by shared_ptr and captured by each task, so the final
+ * decrement never touches a destroyed descriptor.
+ */
+struct CommitLaneTracker final : std::enable_shared_from_this<CommitLaneTracker> {
+	std::mutex mutex;
+	std::condition_variable cv;
+	uint32_t pending = 0;
+	bool closed = false;
+
+	/**
+	 * Enqueues `task` on `lane`, or runs it inline once the tracker has been
+	 * closed (mirroring a stopped CommitWorker).
+	 */
+	void enqueue(const std::shared_ptr<CommitWorker>& lane, std::function<void()> task);
+
+	/**
+	 * Waits for all tracked tasks to finish, then closes the tracker.
+	 */
+	void drain();
+};
+
+} // namespace rocksdb_js
+
+#endif
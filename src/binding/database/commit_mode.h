@@ -0,0 +1,155 @@
+#ifndef __COMMIT_MODE_H__
+#define __COMMIT_MODE_H__
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include "core/debug.h"
+
+namespace rocksdb_js {
+
+/**
+ * Per-database commit pipeline mode tracking. Measures how long the
+ * transaction-log write and the RocksDB commit stages take, counts commits per
+ * pipeline mode, and — when `ROCKSDB_JS_COMMIT_THREAD=auto` — decides whether
+ * new commits should be split across the log and commit lanes (two-lane) or
+ * run back to back on the commit lane (single-lane).
+ *
+ * Splitting only pays when both stages are expensive: the two-lane pipeline
+ * overlaps one transaction's log write with the previous transaction's
+ * RocksDB commit, saving at most `min(logStage, commitStage)` per commit, but
+ * costs a cross-thread handoff that outweighs the overlap for small commits.
+ * Stage times are averaged over a window of commits and the mode flips only
+ * when the average overlap crosses `ENTER_TWO_LANE_NS` (going up) or drops
+ * below `EXIT_TWO_LANE_NS` (going down), so a mixed workload does not flap.
+ *
+ * `record()` is only called from the database's commit lane (a single thread
+ * at a time); the mode and counters are read from the JS thread and stats.
+ * `dispatch()` may be called from any JS thread that commits to the database.
+ */
+struct CommitModeTracker final {
+	/**
+	 * The number of commits averaged before the mode is re-evaluated.
+	 */
+	static constexpr uint32_t WINDOW = 32;
+
+	/**
+	 * Average stage overlap at or above which commits are split across lanes.
+	 */
+	static constexpr uint64_t ENTER_TWO_LANE_NS = 40000;
+
+	/**
+	 * Average stage overlap below which commits go back to a single lane.
+	 */
+	static constexpr uint64_t EXIT_TWO_LANE_NS = 15000;
+
+	/**
+	 * Commits executed on a single lane / split across both lanes.
+	 */
+	std::atomic<uint64_t> singleLaneCommits{0};
+	std::atomic<uint64_t> twoLaneCommits{0};
+
+	/**
+	 * The number of times the adaptive mode flipped between single and two
+	 * lane.
+	 */
+	std::atomic<uint64_t> modeSwitches{0};
+
+	/**
+	 * Average log-write and RocksDB-commit stage times over the last completed
+	 * window, in nanoseconds.
+	 */
+	std::atomic<uint64_t> logStageNs{0};
+	std::atomic<uint64_t> commitStageNs{0};
+
+	/**
+	 * Commits dispatched to the log lane that have not yet been forwarded to
+	 * the commit lane. While non-zero, new commits must also go through the log
+	 * lane, otherwise a single-lane commit could overtake them.
+	 */
+	std::atomic<uint32_t> logStageInFlight{0};
+
+	/**
+	 * Single-lane commits queued on the commit lane that have not yet written
+	 * their transaction-log batch. While non-zero, new commits must also run
+	 * on a single lane, otherwise a two-lane commit's log write could land
+	 * ahead of theirs and the log order would no longer match the commit
+	 * order replay relies on.
+	 */
+	std::atomic<uint32_t> singleLaneInFlight{0};
+
+	/**
+	 * Decides whether a new commit is split across the log and commit lanes
+	 * and counts it in `logStageInFlight` or `singleLaneInFlight`. A commit
+	 * only takes the `preferred` route once every commit dispatched the other
+	 * way has passed the point where it could be overtaken; until then it
+	 * follows them. The caller decrements the counter once the commit has been
+	 * forwarded to the commit lane (two-lane) or written its log batch
+	 * (single-lane).
+	 */
+	bool dispatch(bool preferred) {
+		std::lock_guard<std::mutex> lock(this->dispatchMutex);
+		bool twoLane = preferred;
+		if (twoLane ? this->singleLaneInFlight.load() > 0 : this->logStageInFlight.load() > 0) {
+			twoLane = !twoLane;
+		}
+		(twoLane ? this->logStageInFlight : this->singleLaneInFlight).fetch_add(1);
+		return twoLane;
+	}
+
+	/**
+	 * Whether the adaptive mode currently prefers splitting commits across the
+	 * log and commit lanes.
+	 */
+	bool preferTwoLane() const {
+		return this->twoLane.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Records one executed commit and, at the end of each window, re-evaluates
+	 * the preferred mode.
+	 */
+	void record(uint64_t logNs, uint64_t commitNs, bool ranTwoLane) {
+		(ranTwoLane ? this->twoLaneCommits : this->singleLaneCommits).fetch_add(1, std::memory_order_relaxed);
+
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->logSum += logNs;
+		this->commitSum += commitNs;
+		if (++this->samples < WINDOW) {
+			return;
+		}
+
+		uint64_t avgLog = this->logSum / this->samples;
+		uint64_t avgCommit = this->commitSum / this->samples;
+		this->samples = 0;
+		this->logSum = 0;
+		this->commitSum = 0;
+		this->logStageNs.store(avgLog, std::memory_order_relaxed);
+		this->commitStageNs.store(avgCommit, std::memory_order_relaxed);
+
+		uint64_t overlap = std::min(avgLog, avgCommit);
+		bool current = this->twoLane.load(std::memory_order_relaxed);
+		bool next = current ? overlap >= EXIT_TWO_LANE_NS : overlap >= ENTER_TWO_LANE_NS;
+		if (next != current) {
+			DEBUG_LOG("%p CommitModeTracker::record Switching to %s lane (log=%llu ns, commit=%llu ns)\n",
+				this, next ? "two" : "single", (unsigned long long)avgLog, (unsigned long long)avgCommit);
+			this->twoLane.store(next, std::memory_order_relaxed);
+			this->modeSwitches.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+private:
+	std::atomic<bool> twoLane{false};
+	std::mutex mutex;
+	// makes the route check and the in-flight increment in dispatch() atomic
+	// across JS threads
+	std::mutex dispatchMutex;
+	uint32_t samples = 0;
+	uint64_t logSum = 0;
+	uint64_t commitSum = 0;
+};
+
+} // namespace rocksdb_js
+
+#endif
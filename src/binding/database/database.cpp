@@ -14,6 +14,10 @@
 #include "core/platform.h"
 #include "napi/helpers.h"
 #include "napi/async.h"
+#include "napi/parked_reads.h"
+#include "core/encoding.h"
+#include "core/merge_operators.h"
+#include "core/value_cache.h"
 #include "core/verification_table.h"
 
 namespace rocksdb_js {
@@ -476,12 +480,12 @@ napi_value Database::Drop(napi_env env, napi_callback_info info) {
 		// family, so unregistering here would corrupt the registry.
 		(*dbHandle)->descriptor->unregisterColumnFamily((*dbHandle)->getColumnFamilyName());
 		// Dropping a column family bulk-deletes its data exactly like clear();
-		// sweep the VT so pre-drop versions can no longer verify FRESH (see
-		// DBHandle::clear). Only on the ok path — on already-dropped, the
+		// sweep its VT partition so pre-drop versions can no longer verify FRESH
+		// (see DBHandle::clear). Only on the ok path — on already-dropped, the
 		// handle that performed the drop owns the sweep.
 		if ((*dbHandle)->enableVerificationTable) {
 			VerificationTable* vt = DBSettings::getInstance().getVerificationTableRaw();
-			if (vt) vt->settleAllSlots();
+			if (vt) vt->settlePartition(vtPartitionFor(*dbHandle));
 		}
 	}
 
@@ -530,12 +534,12 @@ napi_value Database::DropSync(napi_env env, napi_callback_info info) {
 		// family, so unregistering here would corrupt the registry.
 		(*dbHandle)->descriptor->unregisterColumnFamily((*dbHandle)->getColumnFamilyName());
 		// Dropping a column family bulk-deletes its data exactly like clear();
-		// sweep the VT so pre-drop versions can no longer verify FRESH (see
-		// DBHandle::clear). Only on the ok path — on already-dropped, the
+		// sweep its VT partition so pre-drop versions can no longer verify FRESH
+		// (see DBHandle::clear). Only on the ok path — on already-dropped, the
 		// handle that performed the drop owns the sweep.
 		if ((*dbHandle)->enableVerificationTable) {
 			VerificationTable* vt = DBSettings::getInstance().getVerificationTableRaw();
-			if (vt) vt->settleAllSlots();
+			if (vt) vt->settlePartition(vtPartitionFor(*dbHandle));
 		}
 	}
 
@@ -543,6 +547,108 @@ napi_value Database::DropSync(napi_env env, napi_callback_info info) {
 	NAPI_RETURN_UNDEFINED();
 }
 
+/**
+ * Finishes a bulk load synchronously: compacts the entire column family with
+ * all `parallelismThreads` subcompactions, then reverts the bulk load options
+ * and turns the WAL back on (unless it was disabled with `disableWAL`).
+ *
+ * @example
+ * ```typescript
+ * const db = new NativeDatabase();
+ * db.open('/tmp/testdb', { bulkLoad: true });
+ * db.finishBulkLoadSync();
+ * ```
+ */
+napi_value Database::FinishBulkLoadSync(napi_env env, napi_callback_info info) {
+	NAPI_METHOD();
+	UNWRAP_DB_HANDLE_AND_OPEN();
+	ACQUIRE_OPERATIONS_LOCK();
+
+	if ((*dbHandle)->descriptor->readOnly) {
+		NAPI_RETURN_UNDEFINED();
+	}
+
+	ROCKSDB_STATUS_THROWS_ERROR_LIKE((*dbHandle)->finishBulkLoad(), "Finish bulk load failed");
+
+	NAPI_RETURN_UNDEFINED();
+}
+
+/**
+ * Finishes a bulk load asynchronously. See `FinishBulkLoadSync()`.
+ *
+ * @example
+ * ```typescript
+ * const db = new NativeDatabase();
+ * db.open('/tmp/testdb', { bulkLoad: true });
+ * await new Promise((resolve, reject) => db.finishBulkLoad(resolve, reject));
+ * ```
+ */
+napi_value Database::FinishBulkLoad(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(2);
+	UNWRAP_DB_HANDLE_AND_OPEN();
+
+	if ((*dbHandle)->descriptor->readOnly) {
+		NAPI_RETURN_UNDEFINED();
+	}
+
+	napi_value resolve = argv[0];
+	napi_value reject = argv[1];
+
+	napi_value name;
+	NAPI_STATUS_THROWS(::napi_create_string_utf8(
+		env,
+		"database.finishBulkLoad",
+		NAPI_AUTO_LENGTH,
+		&name
+	));
+
+	auto state = new AsyncFinishBulkLoadState(env, *dbHandle);
+	NAPI_STATUS_THROWS(::napi_create_reference(env, resolve, 1, &state->resolveRef));
+	NAPI_STATUS_THROWS(::napi_create_reference(env, reject, 1, &state->rejectRef));
+
+	NAPI_STATUS_THROWS(::napi_create_async_work(
+		env,       // node_env
+		nullptr,   // async_resource
+		name,      // async_resource_name
+		[](napi_env doNotUse, void* data) { // execute
+			auto state = reinterpret_cast<AsyncFinishBulkLoadState*>(data);
+			if (!state->handle) {
+				state->status = rocksdb::Status::Aborted("Database closed during finish bulk load operation");
+			} else {
+				state->status = state->handle->finishBulkLoad();
+			}
+			// signal that execute handler is complete
+			state->signalExecuteCompleted();
+		},
+		[](napi_env env, napi_status status, void* data) { // complete
+			auto state = reinterpret_cast<AsyncFinishBulkLoadState*>(data);
+
+			state->deleteAsyncWork();
+
+			if (status != napi_cancelled) {
+				if (state->status.ok()) {
+					napi_value undefined;
+					NAPI_STATUS_THROWS_VOID(::napi_get_undefined(env, &undefined));
+					state->callResolve(undefined);
+				} else {
+					ROCKSDB_STATUS_CREATE_NAPI_ERROR_VOID(state->status, "Finish bulk load failed");
+					state->callReject(error);
+				}
+			}
+
+			delete state;
+		},
+		state,
+		&state->asyncWork
+	));
+
+	(*dbHandle)->registerAsyncWork();
+
+	NAPI_STATUS_THROWS(::napi_queue_async_work(env, state->asyncWork));
+
+	NAPI_RETURN_UNDEFINED();
+}
+
 /**
  * Flushes the RocksDB database memtable to disk synchronously.
  *
@@ -695,9 +801,11 @@ napi_value Database::Get(napi_env env, napi_callback_info info) {
 	// when no write cycle intervened.
 	std::atomic<uint64_t>* vtSlot = nullptr;
 	uint64_t vtObserved = 0;
+	uint64_t vtClearGen = 0;
 	if (hasExpectedVersion) {
-		vtSlot = vtSlotFor(*dbHandle, DBSettings::getInstance().getVerificationTableRaw(), keySlice);
-		if (vtSlot != nullptr) vtObserved = vtSlot->load(std::memory_order_acquire);
+		VerificationTable* vt = DBSettings::getInstance().getVerificationTableRaw();
+		vtSlot = vtSlotFor(*dbHandle, vt, keySlice);
+		if (vtSlot != nullptr) vtObserved = vtObserve(*dbHandle, vt, vtSlot, vtClearGen);
 	}
 
 	if (txnIdType == napi_number) {
@@ -711,7 +819,20 @@ napi_value Database::Get(napi_env env, napi_callback_info info) {
 			NAPI_RETURN_UNDEFINED();
 		}
 		return txnHandle->get(env, key, resolve, reject, *dbHandle,
-		                      vtSlot, vtObserved, hasExpectedVersion, expectedVersion);
+		                      vtSlot, vtObserved, vtClearGen, hasExpectedVersion, expectedVersion);
+	}
+
+	// Same check as getSync, counted the same way: the caller's version matches
+	// the table, so resolve FRESH without queuing a read.
+	if (vtSlot != nullptr && hasExpectedVersion && vtCheckVersion(vtObserved, expectedVersion)) {
+		napi_value global;
+		napi_value freshResult;
+		NAPI_STATUS_THROWS(::napi_get_global(env, &global));
+		NAPI_STATUS_THROWS(::napi_create_int32(env, FRESH_VERSION_FLAG, &freshResult));
+		NAPI_STATUS_THROWS(::napi_call_function(env, global, resolve, 1, &freshResult, nullptr));
+		napi_value returnStatus;
+		NAPI_STATUS_THROWS(::napi_create_uint32(env, 0, &returnStatus));
+		return returnStatus;
 	}
 
 	rocksdb::ReadOptions readOptions;
@@ -725,7 +846,9 @@ napi_value Database::Get(napi_env env, napi_callback_info info) {
 
 	auto state = new AsyncGetState<std::shared_ptr<DBHandle>>(env, *dbHandle, readOptions, std::move(key));
 	state->vtSlot = vtSlot;
+	if (vtSlot) state->vtPartition = vtPartitionFor(*dbHandle);
 	state->vtObserved = vtObserved;
+	state->vtClearGen = vtClearGen;
 	state->hasExpectedVersion = hasExpectedVersion;
 	state->expectedVersion = expectedVersion;
 	NAPI_STATUS_THROWS(::napi_create_reference(env, resolve, 1, &state->resolveRef));
@@ -779,6 +902,128 @@ napi_value Database::Get(napi_env env, napi_callback_info info) {
 	return returnStatus;
 }
 
+/**
+ * Parks an async read on an in-flight write. If the key's verification table
+ * slot is lock-tagged, registers a wake callback on the slot's `LockTracker`
+ * that calls `onWake(id)` on this env once the last write intent is released
+ * (commit, abort or database close) and returns `true`; otherwise returns
+ * `false` and the caller should read right away. The caller bounds the wait
+ * with its own timer, so a wake-up may arrive after it has already given up.
+ *
+ * @example
+ * ```typescript
+ * if (db.parkRead(keyBuf, id, onWake)) {
+ *   // read once onWake(id) fires or the timeout elapses
+ * }
+ * ```
+ */
+napi_value Database::ParkRead(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(3);
+	UNWRAP_DB_HANDLE_AND_OPEN();
+
+	rocksdb::Slice keySlice;
+	if (!rocksdb_js::getSliceFromArg(env, argv[0], keySlice, (*dbHandle)->defaultKeyBufferPtr, "Key must be a buffer")) {
+		return nullptr;
+	}
+
+	uint32_t id;
+	NAPI_STATUS_THROWS(::napi_get_value_uint32(env, argv[1], &id));
+
+	napi_valuetype onWakeType;
+	NAPI_STATUS_THROWS(::napi_typeof(env, argv[2], &onWakeType));
+	if (onWakeType != napi_function) {
+		::napi_throw_type_error(env, nullptr, "Wake callback must be a function");
+		return nullptr;
+	}
+
+	bool parked = false;
+	VerificationTable* vt = DBSettings::getInstance().getVerificationTableRaw();
+	auto* slot = vtSlotFor(*dbHandle, vt, keySlice);
+	// refTrackerIfLocked pins the tracker under the VT writer mutex, so it
+	// cannot be freed by a concurrent releaseWriteIntent while we register.
+	LockTracker* t = slot ? vt->refTrackerIfLocked(slot) : nullptr;
+	if (t) {
+		napi_status registerStatus = ParkedReads::getInstance().registerEnv(env, argv[2]);
+		if (registerStatus == napi_ok) {
+			// The callback captures only the env and the id: wake() runs under
+			// the VT writer mutex on the releasing thread and must not own a
+			// descriptor or any JS reference. If the tracker already woke,
+			// the write has settled and the caller reads right away.
+			parked = t->addWakeCallback([env, id]() {
+				ParkedReads::getInstance().dispatch(env, id);
+			});
+		}
+		vt->unrefTracker(t);
+		NAPI_STATUS_THROWS(registerStatus);
+	}
+	if (parked) {
+		vtCount(VTCounter::ParkedRead);
+	}
+
+	napi_value result;
+	NAPI_STATUS_THROWS(::napi_get_boolean(env, parked, &result));
+	return result;
+}
+
+/**
+ * Gets the keys transactions have conflicted on, most conflicted first.
+ * Requires the `conflictStatsSize` option. When the argument is `true`, the
+ * profiler is reset after reading.
+ *
+ * @example
+ * ```typescript
+ * const db = NativeDatabase.open('path/to/db', { conflictStatsSize: 100 });
+ * const { conflicts, keys } = db.getConflictStats(false);
+ * ```
+ */
+napi_value Database::GetConflictStats(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(1);
+	UNWRAP_DB_HANDLE_AND_OPEN();
+
+	bool reset = false;
+	NAPI_STATUS_THROWS(::napi_get_value_bool(env, argv[0], &reset));
+
+	auto& profiler = (*dbHandle)->descriptor->conflictProfiler;
+	ConflictStats stats = profiler.getStats();
+	if (reset) {
+		profiler.reset();
+	}
+
+	napi_value result;
+	napi_value value;
+	NAPI_STATUS_THROWS(::napi_create_object(env, &result));
+	NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(stats.capacity), &value));
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, result, "capacity", value));
+	NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(stats.conflicts), &value));
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, result, "conflicts", value));
+	NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(stats.unattributed), &value));
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, result, "unattributed", value));
+
+	napi_value keys;
+	NAPI_STATUS_THROWS(::napi_create_array_with_length(env, stats.keys.size(), &keys));
+	for (size_t i = 0; i < stats.keys.size(); i++) {
+		const ConflictKeyStats& keyStats = stats.keys[i];
+		napi_value entry;
+		NAPI_STATUS_THROWS(::napi_create_object(env, &entry));
+		NAPI_STATUS_THROWS(::napi_create_string_utf8(env, keyStats.columnFamily.c_str(), keyStats.columnFamily.size(), &value));
+		NAPI_STATUS_THROWS(::napi_set_named_property(env, entry, "columnFamily", value));
+		NAPI_STATUS_THROWS(::napi_create_buffer_copy(env, keyStats.key.size(), keyStats.key.data(), nullptr, &value));
+		NAPI_STATUS_THROWS(::napi_set_named_property(env, entry, "key", value));
+		NAPI_STATUS_THROWS(::napi_get_boolean(env, keyStats.truncated, &value));
+		NAPI_STATUS_THROWS(::napi_set_named_property(env, entry, "truncated", value));
+		NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(keyStats.count), &value));
+		NAPI_STATUS_THROWS(::napi_set_named_property(env, entry, "count", value));
+		NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(keyStats.error), &value));
+		NAPI_STATUS_THROWS(::napi_set_named_property(env, entry, "error", value));
+		NAPI_STATUS_THROWS(::napi_create_uint32(env, keyStats.maxRetries, &value));
+		NAPI_STATUS_THROWS(::napi_set_named_property(env, entry, "maxRetries", value));
+		NAPI_STATUS_THROWS(::napi_set_element(env, keys, static_cast<uint32_t>(i), entry));
+	}
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, result, "keys", keys));
+
+	return result;
+}
+
 /**
  * Gets the number of keys within a range or in the entire RocksDB database.
  *
@@ -969,6 +1214,62 @@ napi_value Database::GetStats(napi_env env, napi_callback_info info) {
 	return (*dbHandle)->getStats(env, all);
 }
 
+/**
+ * Returns a `getSync()` value to JS: copied into the default value buffer
+ * (returning its length) when it fits, otherwise as a new buffer.
+ */
+static napi_value createGetSyncResult(
+	napi_env env,
+	const std::shared_ptr<DBHandle>& dbHandle,
+	int32_t flags,
+	const char* data,
+	size_t size
+) {
+	napi_value result;
+	if (!(flags & ALWAYS_CREATE_NEW_BUFFER_FLAG) && // this flag is used by getBinary() to force a new buffer to be created (that can safely live long-term)
+			dbHandle->defaultValueBufferPtr != nullptr &&
+			size <= dbHandle->defaultValueBufferLength) {
+		// if it fits in the default value buffer, copy the data and just return the length
+		::memcpy(dbHandle->defaultValueBufferPtr, data, size);
+		NAPI_STATUS_THROWS(::napi_create_int32(env, size, &result));
+		return result;
+	}
+
+	// otherwise, create a new buffer and return it
+	NAPI_STATUS_THROWS(::napi_create_buffer_copy(
+		env,
+		size,
+		data,
+		nullptr,
+		&result
+	));
+
+	return result;
+}
+
+/**
+ * Caches a value just read in the shared value cache, but only once the
+ * populate has made its version the slot's current one — otherwise no lookup
+ * could match it anyway.
+ */
+static void valueCacheInsertIfCurrent(
+	const std::shared_ptr<DBHandle>& dbHandle,
+	std::atomic<uint64_t>* vtSlot,
+	const rocksdb::Slice& key,
+	uint64_t version,
+	const rocksdb::Slice& value
+) {
+	if (vtIsVersion(version) && vtSlot->load(std::memory_order_acquire) == version) {
+		ValueCache::getInstance().insert(
+			dbHandle->descriptor->vtEpoch,
+			dbHandle->getColumnFamilyHandle()->GetID(),
+			std::string_view(key.data(), key.size()),
+			version,
+			std::string_view(value.data(), value.size())
+		);
+	}
+}
+
 /**
  * Synchronously gets a value from the RocksDB database. The first argument, that specifies the key, can be a buffer or a number
  * indicating the length of the key that was written to the shared buffer.
@@ -1053,19 +1354,39 @@ napi_value Database::GetSync(napi_env env, napi_callback_info info) {
 	// both the fast-path check and the post-read conditional CAS, so the
 	// populate only succeeds if nothing changed the slot across the read.
 	uint64_t vtObserved = 0;
+	uint64_t vtClearGen = 0;
 	if (hasExpectedVersion || wantsPopulate) {
-		vtSlot = vtSlotFor(*dbHandle, DBSettings::getInstance().getVerificationTable(), keySlice);
-		if (vtSlot != nullptr) vtObserved = vtSlot->load(std::memory_order_acquire);
+		VerificationTable* vt = DBSettings::getInstance().getVerificationTable();
+		vtSlot = vtSlotFor(*dbHandle, vt, keySlice);
+		if (vtSlot != nullptr) vtObserved = vtObserve(*dbHandle, vt, vtSlot, vtClearGen);
 	}
 
 	// Fast path: caller-supplied version matches the table — return FRESH
 	// sentinel without touching RocksDB. Snapshot already established above.
-	if (vtSlot != nullptr && hasExpectedVersion && vtObserved == expectedVersion) {
+	if (vtSlot != nullptr && hasExpectedVersion && vtCheckVersion(vtObserved, expectedVersion)) {
 		napi_value result;
 		NAPI_STATUS_THROWS(::napi_create_int32(env, FRESH_VERSION_FLAG, &result));
 		return result;
 	}
 
+	// Shared value cache: the caller's copy is stale, but the slot holds the
+	// current version, so another env may already have read and cached it. A
+	// matching entry is as fresh as a FRESH hit (see ValueCache).
+	ValueCache& valueCache = ValueCache::getInstance();
+	bool useValueCache = vtSlot != nullptr && hasExpectedVersion && valueCache.enabled();
+	if (useValueCache && vtIsVersion(vtObserved)) {
+		thread_local std::string cachedValue;
+		if (valueCache.lookup(
+			(*dbHandle)->descriptor->vtEpoch,
+			(*dbHandle)->getColumnFamilyHandle()->GetID(),
+			std::string_view(keySlice.data(), keySlice.size()),
+			vtObserved,
+			cachedValue
+		)) {
+			return createGetSyncResult(env, *dbHandle, flags, cachedValue.data(), cachedValue.size());
+		}
+	}
+
 	rocksdb::ReadOptions readOptions;
 	if (flags & ONLY_IF_IN_MEMORY_CACHE_FLAG) {
 		// this is used by get() so that the getSync() call will fail if the entry is not in the cache
@@ -1113,33 +1434,22 @@ napi_value Database::GetSync(napi_env env, napi_callback_info info) {
 		if (hasExpectedVersion && extracted == expectedVersion) {
 			// Soft VT miss confirmed fresh: the value still carries the caller's
 			// expected version, so the cached value is valid for this read.
-			vtPopulateIfSettled(*dbHandle, vtSlot, keySlice, extracted, readSnapshot, vtObserved);
+			vtCount(VTCounter::SoftMiss);
+			vtPopulateIfSettled(*dbHandle, vtSlot, keySlice, extracted, readSnapshot, vtObserved, vtClearGen);
+			if (useValueCache) {
+				valueCacheInsertIfCurrent(*dbHandle, vtSlot, keySlice, extracted, value);
+			}
 			napi_value freshResult;
 			NAPI_STATUS_THROWS(::napi_create_int32(env, FRESH_VERSION_FLAG, &freshResult));
 			return freshResult;
 		}
-		vtPopulateIfSettled(*dbHandle, vtSlot, keySlice, extracted, readSnapshot, vtObserved);
-	}
-
-	if (!(flags & ALWAYS_CREATE_NEW_BUFFER_FLAG) && // this flag is used by getBinary() to force a new buffer to be created (that can safely live long-term)
-			(*dbHandle)->defaultValueBufferPtr != nullptr &&
-			value.size() <= (*dbHandle)->defaultValueBufferLength) {
-		// if it fits in the default value buffer, copy the data and just return the length
-		::memcpy((*dbHandle)->defaultValueBufferPtr, value.data(), value.size());
-		NAPI_STATUS_THROWS(::napi_create_int32(env, value.size(), &result));
-		return result;
+		vtPopulateIfSettled(*dbHandle, vtSlot, keySlice, extracted, readSnapshot, vtObserved, vtClearGen);
+		if (useValueCache) {
+			valueCacheInsertIfCurrent(*dbHandle, vtSlot, keySlice, extracted, value);
+		}
 	}
 
-	// otherwise, create a new buffer and return it
-	NAPI_STATUS_THROWS(::napi_create_buffer_copy(
-		env,
-		value.size(),
-		value.data(),
-		nullptr,
-		&result
-	));
-
-	return result;
+	return createGetSyncResult(env, *dbHandle, flags, value.data(), value.size());
 }
 
 /**
@@ -1185,6 +1495,76 @@ napi_value Database::VerifyVersion(napi_env env, napi_callback_info info) {
 	return result;
 }
 
+/**
+ * Batched `verifyVersion()`: checks a page of keys against the verification
+ * table in one call. `argv[0]` is a buffer of keys, each prefixed with its
+ * length as a big-endian uint32; `argv[1]` is a Float64Array with one version
+ * per key; bit `i` (LSB first) of the `argv[2]` Uint8Array is set when key `i`
+ * is fresh. Returns the number of fresh keys.
+ *
+ * @example
+ * ```typescript
+ * const fresh = db.verifyVersions(packedKeys, versions, bitmap);
+ * ```
+ */
+napi_value Database::VerifyVersions(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(3);
+	UNWRAP_DB_HANDLE_AND_OPEN();
+
+	char* packed = nullptr;
+	size_t packedLength = 0;
+	NAPI_STATUS_THROWS(::napi_get_buffer_info(env, argv[0], reinterpret_cast<void**>(&packed), &packedLength));
+
+	napi_typedarray_type versionsType;
+	size_t count = 0;
+	void* versionsData = nullptr;
+	NAPI_STATUS_THROWS(::napi_get_typedarray_info(env, argv[1], &versionsType, &count, &versionsData, nullptr, nullptr));
+	if (versionsType != napi_float64_array) {
+		::napi_throw_type_error(env, nullptr, "Versions must be a Float64Array");
+		return nullptr;
+	}
+
+	napi_typedarray_type bitmapType;
+	size_t bitmapLength = 0;
+	void* bitmapData = nullptr;
+	NAPI_STATUS_THROWS(::napi_get_typedarray_info(env, argv[2], &bitmapType, &bitmapLength, &bitmapData, nullptr, nullptr));
+	if (bitmapType != napi_uint8_array || bitmapLength < (count + 7) / 8) {
+		::napi_throw_range_error(env, nullptr, "Bitmap must be a Uint8Array with one bit per key");
+		return nullptr;
+	}
+
+	std::vector<rocksdb::Slice> keys;
+	if (!parsePackedKeys(packed, packedLength, count, keys)) {
+		::napi_throw_range_error(env, nullptr, "Packed keys do not match the number of versions");
+		return nullptr;
+	}
+
+	// Float64Array data is 8-byte aligned; the versions are compared as their
+	// uint64 bit patterns, like parseExpectedVersion()
+	std::vector<uint64_t> versions(count);
+	::memcpy(versions.data(), versionsData, count * sizeof(uint64_t));
+
+	uint8_t* bitmap = static_cast<uint8_t*>(bitmapData);
+	size_t fresh = 0;
+	VerificationTable* vt = DBSettings::getInstance().getVerificationTable();
+	if (vt) {
+		fresh = vt->verifyVersions(
+			(*dbHandle)->descriptor->vtEpoch,
+			(*dbHandle)->getColumnFamilyHandle()->GetID(),
+			keys.data(),
+			versions.data(),
+			count,
+			bitmap
+		);
+	} else {
+		::memset(bitmap, 0, (count + 7) / 8);
+	}
+
+	napi_value result;
+	NAPI_STATUS_THROWS(::napi_create_uint32(env, static_cast<uint32_t>(fresh), &result));
+	return result;
+}
+
 /**
  * Sets the verification-table slot for the given key to the given version,
  * unless the slot is currently lock-tagged. Useful for seeding the table
@@ -1212,13 +1592,14 @@ napi_value Database::PopulateVersion(napi_env env, napi_callback_info info) {
 		NAPI_RETURN_UNDEFINED();
 	}
 
-	auto* slot = vtSlotFor(*dbHandle, DBSettings::getInstance().getVerificationTable(), keySlice);
+	VerificationTable* vt = DBSettings::getInstance().getVerificationTable();
+	auto* slot = vtSlotFor(*dbHandle, vt, keySlice);
 	if (slot) {
 		// Low-level explicit primitive: publish exactly the caller-supplied
 		// version. The snapshot-isolation gating lives on the read/getSync
 		// populate path (vtPopulateIfSettled); callers of this API assert the
 		// version directly.
-		VerificationTable::populateVersion(slot, version);
+		vt->populateVersion(slot, vtPartitionFor(*dbHandle), version);
 	}
 
 	NAPI_RETURN_UNDEFINED();
@@ -1290,6 +1671,67 @@ napi_value Database::SetIteratorState(napi_env env, napi_callback_info info) {
 	NAPI_RETURN_UNDEFINED();
 }
 
+/**
+ * Sets the column family's TTL rule: records whose version timestamp is older
+ * than `ttl` milliseconds, or below the expiry of a key prefix they start
+ * with, are dropped by the next compactions that rewrite them. A `ttl` of 0
+ * without prefixes removes the rule.
+ *
+ * @example
+ * ```typescript
+ * const db = new NativeDatabase();
+ * db.open('/tmp/testdb');
+ * db.setTtl(86400000, [{ prefix: Buffer.from('session:'), expiresBefore: Date.now() }]);
+ * ```
+ */
+napi_value Database::SetTtl(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(2);
+	UNWRAP_DB_HANDLE_AND_OPEN();
+	THROW_IF_READONLY((*dbHandle)->descriptor, "Set TTL failed: ");
+
+	double ttl = 0;
+	napi_valuetype ttlType;
+	NAPI_STATUS_THROWS(::napi_typeof(env, argv[0], &ttlType));
+	if (ttlType != napi_number || ::napi_get_value_double(env, argv[0], &ttl) != napi_ok || !(ttl >= 0)) {
+		::napi_throw_type_error(env, nullptr, "TTL must be a non-negative number");
+		return nullptr;
+	}
+
+	std::vector<std::pair<std::string, double>> prefixExpiry;
+	napi_valuetype prefixesType;
+	NAPI_STATUS_THROWS(::napi_typeof(env, argv[1], &prefixesType));
+	if (prefixesType != napi_undefined && prefixesType != napi_null) {
+		bool isArray = false;
+		NAPI_STATUS_THROWS(::napi_is_array(env, argv[1], &isArray));
+		if (!isArray) {
+			::napi_throw_type_error(env, nullptr, "Prefixes must be an array");
+			return nullptr;
+		}
+
+		uint32_t length = 0;
+		NAPI_STATUS_THROWS(::napi_get_array_length(env, argv[1], &length));
+		prefixExpiry.reserve(length);
+		for (uint32_t i = 0; i < length; i++) {
+			napi_value entry;
+			NAPI_STATUS_THROWS(::napi_get_element(env, argv[1], i, &entry));
+			std::string prefix;
+			double expiresBefore = 0;
+			if (rocksdb_js::getProperty(env, entry, "prefix", prefix, true) != napi_ok ||
+				rocksdb_js::getProperty(env, entry, "expiresBefore", expiresBefore, true) != napi_ok
+			) {
+				::napi_throw_type_error(env, nullptr, "Prefixes must have a prefix and an expiresBefore timestamp");
+				return nullptr;
+			}
+			prefixExpiry.emplace_back(std::move(prefix), expiresBefore);
+		}
+	}
+
+	ACQUIRE_OPERATIONS_LOCK();
+	ROCKSDB_STATUS_THROWS_ERROR_LIKE((*dbHandle)->setTtl(ttl, std::move(prefixExpiry)), "Set TTL failed");
+
+	NAPI_RETURN_UNDEFINED();
+}
+
 /**
  * Gets or creates a buffer that an be shared across worker threads.
  */
@@ -1343,6 +1785,153 @@ napi_value Database::HasLock(napi_env env, napi_callback_info info) {
 	return result;
 }
 
+/**
+ * Reads the SST file paths and `moveFiles` option passed to `ingest()` and
+ * `ingestSync()`. Throws and returns false when the paths are invalid.
+ */
+static bool getIngestArgs(
+	napi_env env,
+	napi_value filesArg,
+	napi_value optionsArg,
+	std::vector<std::string>& files,
+	bool& moveFiles
+) {
+	bool isArray = false;
+	NAPI_STATUS_THROWS_RVAL(::napi_is_array(env, filesArg, &isArray), false);
+	if (!isArray) {
+		::napi_throw_type_error(env, nullptr, "Files must be an array of paths");
+		return false;
+	}
+
+	uint32_t length = 0;
+	NAPI_STATUS_THROWS_RVAL(::napi_get_array_length(env, filesArg, &length), false);
+	if (length == 0) {
+		::napi_throw_type_error(env, nullptr, "At least one file is required");
+		return false;
+	}
+
+	files.reserve(length);
+	for (uint32_t i = 0; i < length; i++) {
+		napi_value file;
+		NAPI_STATUS_THROWS_RVAL(::napi_get_element(env, filesArg, i, &file), false);
+		std::string path;
+		if (rocksdb_js::getString(env, file, path) != napi_ok) {
+			::napi_throw_type_error(env, nullptr, "Files must be an array of paths");
+			return false;
+		}
+		files.push_back(std::move(path));
+	}
+
+	NAPI_STATUS_THROWS_RVAL(rocksdb_js::getProperty(env, optionsArg, "moveFiles", moveFiles), false);
+	return true;
+}
+
+/**
+ * Ingests SST files built with `SstWriter` (or any `SstFileWriter` using the
+ * same comparator) into the column family.
+ *
+ * @example
+ * ```typescript
+ * const db = new NativeDatabase();
+ * await db.ingest(resolve, reject, ['/tmp/bulk.sst'], { moveFiles: true });
+ * ```
+ */
+napi_value Database::Ingest(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(4);
+	UNWRAP_DB_HANDLE_AND_OPEN();
+	THROW_IF_READONLY((*dbHandle)->descriptor, "Ingest failed: ");
+
+	napi_value resolve = argv[0];
+	napi_value reject = argv[1];
+
+	std::vector<std::string> files;
+	bool moveFiles = false;
+	if (!getIngestArgs(env, argv[2], argv[3], files, moveFiles)) {
+		return nullptr;
+	}
+
+	napi_value name;
+	NAPI_STATUS_THROWS(::napi_create_string_utf8(
+		env,
+		"database.ingest",
+		NAPI_AUTO_LENGTH,
+		&name
+	));
+
+	auto state = new AsyncIngestState(env, *dbHandle, std::move(files), moveFiles);
+	NAPI_STATUS_THROWS(::napi_create_reference(env, resolve, 1, &state->resolveRef));
+	NAPI_STATUS_THROWS(::napi_create_reference(env, reject, 1, &state->rejectRef));
+
+	NAPI_STATUS_THROWS(::napi_create_async_work(
+		env,       // node_env
+		nullptr,   // async_resource
+		name,      // async_resource_name
+		[](napi_env doNotUse, void* data) { // execute
+			auto state = reinterpret_cast<AsyncIngestState*>(data);
+			// check if database is still open before proceeding
+			if (!state->handle || !state->handle->opened() || state->handle->isCancelled()) {
+				state->status = rocksdb::Status::Aborted("Database closed during ingest operation");
+			} else {
+				state->status = state->handle->ingest(state->files, state->moveFiles);
+			}
+			// signal that execute handler is complete
+			state->signalExecuteCompleted();
+		},
+		[](napi_env env, napi_status status, void* data) { // complete
+			auto state = reinterpret_cast<AsyncIngestState*>(data);
+
+			state->deleteAsyncWork();
+
+			if (status != napi_cancelled) {
+				if (state->status.ok()) {
+					napi_value undefined;
+					NAPI_STATUS_THROWS_VOID(::napi_get_undefined(env, &undefined));
+					state->callResolve(undefined);
+				} else {
+					ROCKSDB_STATUS_CREATE_NAPI_ERROR_VOID(state->status, "Ingest failed");
+					state->callReject(error);
+				}
+			}
+
+			delete state;
+		},
+		state,
+		&state->asyncWork
+	));
+
+	(*dbHandle)->registerAsyncWork();
+
+	NAPI_STATUS_THROWS(::napi_queue_async_work(env, state->asyncWork));
+
+	NAPI_RETURN_UNDEFINED();
+}
+
+/**
+ * Synchronously ingests SST files into the column family.
+ *
+ * @example
+ * ```typescript
+ * const db = new NativeDatabase();
+ * db.ingestSync(['/tmp/bulk.sst'], { moveFiles: true });
+ * ```
+ */
+napi_value Database::IngestSync(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(2);
+	UNWRAP_DB_HANDLE_AND_OPEN();
+	THROW_IF_READONLY((*dbHandle)->descriptor, "Ingest failed: ");
+
+	std::vector<std::string> files;
+	bool moveFiles = false;
+	if (!getIngestArgs(env, argv[0], argv[1], files, moveFiles)) {
+		return nullptr;
+	}
+
+	ACQUIRE_OPERATIONS_LOCK();
+	ROCKSDB_STATUS_THROWS_ERROR_LIKE((*dbHandle)->ingest(files, moveFiles), "Ingest failed");
+
+	NAPI_RETURN_UNDEFINED();
+}
+
 /**
  * Checks if the RocksDB database is open.
  */
@@ -1364,6 +1953,89 @@ napi_value Database::ListLogs(napi_env env, napi_callback_info info) {
 	return (*dbHandle)->descriptor->listTransactionLogStores(env);
 }
 
+/**
+ * Merges an operand into a key's value with the built-in merge operator the
+ * database was opened with. When a transaction id is passed, the operand is
+ * written to that transaction instead.
+ *
+ * @example
+ * ```typescript
+ * const db = new NativeDatabase();
+ * db.open('/tmp/testdb', { mergeOperator: 'add' });
+ * db.mergeSync(Buffer.from('counter'), delta);
+ * ```
+ */
+napi_value Database::MergeSync(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(3);
+	NAPI_GET_BUFFER(argv[0], key, "Key is required");
+	NAPI_GET_BUFFER(argv[1], operand, "Operand is required");
+	UNWRAP_DB_HANDLE_AND_OPEN();
+	ACQUIRE_OPERATIONS_LOCK();
+	THROW_IF_READONLY((*dbHandle)->descriptor, "Merge failed: ");
+
+	rocksdb::Slice keySlice(key + keyStart, keyEnd - keyStart);
+	rocksdb::Slice payloadSlice(operand + operandStart, operandEnd - operandStart);
+
+	rocksdb::Status status;
+
+	napi_valuetype txnIdType;
+	NAPI_STATUS_THROWS(::napi_typeof(env, argv[2], &txnIdType));
+
+	if (txnIdType == napi_number) {
+		uint32_t txnId;
+		NAPI_STATUS_THROWS(::napi_get_value_uint32(env, argv[2], &txnId));
+
+		auto txnHandle = (*dbHandle)->descriptor->transactionGet(txnId);
+		if (!txnHandle) {
+			std::string errorMsg = "Merge failed: Transaction not found (txnId: " + std::to_string(txnId) + ")";
+			::napi_throw_error(env, nullptr, errorMsg.c_str());
+			NAPI_RETURN_UNDEFINED();
+		}
+		status = txnHandle->mergeSync(keySlice, payloadSlice, *dbHandle);
+	} else {
+		std::string mergeOperand;
+		status = (*dbHandle)->encodeMergeOperand(payloadSlice, mergeOperand);
+		if (!status.ok()) {
+			ROCKSDB_STATUS_CREATE_NAPI_ERROR(status, "Merge failed");
+			::napi_throw(env, error);
+			return nullptr;
+		}
+
+		// Same lock-before-write, settle-after pattern as PutSync.
+		VerificationTable* vt = (*dbHandle)->enableVerificationTable
+			? DBSettings::getInstance().getVerificationTableRaw()
+			: nullptr;
+		std::atomic<uint64_t>* vtSlot = nullptr;
+		LockTracker* vtTracker = nullptr;
+		if (vt) {
+			// Per-open epoch, not the descriptor pointer (reused across reopen).
+			uint64_t dbId = (*dbHandle)->descriptor->vtEpoch;
+			uint32_t cfId = (*dbHandle)->getColumnFamilyHandle()->GetID();
+			vtSlot = vt->slotFor(dbId, cfId, keySlice);
+			vtTracker = vt->lockSlotForWrite(vtSlot, dbId);
+		}
+		rocksdb::WriteOptions writeOptions;
+		writeOptions.disableWAL = (*dbHandle)->disableWAL;
+		status = (*dbHandle)->descriptor->db->Merge(
+			writeOptions,
+			(*dbHandle)->getColumnFamilyHandle(),
+			keySlice,
+			mergeOperand
+		);
+		if (vt && vtSlot) {
+			vt->releaseWriteIntent(vtSlot, vtTracker);
+		}
+	}
+
+	if (!status.ok()) {
+		ROCKSDB_STATUS_CREATE_NAPI_ERROR(status, "Merge failed");
+		::napi_throw(env, error);
+		return nullptr;
+	}
+
+	NAPI_RETURN_UNDEFINED();
+}
+
 /**
  * Opens the RocksDB database. This must be called before any data methods are called.
  */
@@ -1381,6 +2053,35 @@ napi_value Database::Open(napi_env env, napi_callback_info info) {
 
 	DBOptions dbHandleOptions;
 
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "allowConcurrentMemtableWrite", dbHandleOptions.allowConcurrentMemtableWrite));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "blobCacheShared", dbHandleOptions.blobCacheShared));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "blobCacheSize", dbHandleOptions.blobCacheSize));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "blobCompactionReadaheadSize", dbHandleOptions.blobCompactionReadaheadSize));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "blobFileSize", dbHandleOptions.blobFileSize));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "blobGarbageCollectionAgeCutoff", dbHandleOptions.blobGarbageCollectionAgeCutoff));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "minBlobSize", dbHandleOptions.minBlobSize));
+	if (dbHandleOptions.blobCacheShared && dbHandleOptions.blobCacheSize > 0) {
+		::napi_throw_error(env, nullptr, "blobCacheShared and blobCacheSize cannot be used together");
+		return nullptr;
+	}
+	if (dbHandleOptions.blobGarbageCollectionAgeCutoff &&
+		!(*dbHandleOptions.blobGarbageCollectionAgeCutoff >= 0.0 && *dbHandleOptions.blobGarbageCollectionAgeCutoff <= 1.0)
+	) {
+		::napi_throw_error(env, nullptr, "blobGarbageCollectionAgeCutoff must be between 0.0 and 1.0");
+		return nullptr;
+	}
+	if (dbHandleOptions.blobFileSize && *dbHandleOptions.blobFileSize == 0) {
+		::napi_throw_error(env, nullptr, "blobFileSize must be greater than 0");
+		return nullptr;
+	}
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "bloomFilterBitsPerKey", dbHandleOptions.bloomFilterBitsPerKey));
+	if (!(dbHandleOptions.bloomFilterBitsPerKey >= 0.0)) {
+		::napi_throw_error(env, nullptr, "bloomFilterBitsPerKey must be 0 or greater");
+		return nullptr;
+	}
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "bulkLoad", dbHandleOptions.bulkLoad));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "cacheIndexAndFilterBlocks", dbHandleOptions.cacheIndexAndFilterBlocks));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "conflictStatsSize", dbHandleOptions.conflictStatsSize));
 	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "disableWAL", dbHandleOptions.disableWAL));
 	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "verificationTable", dbHandleOptions.verificationTable));
 
@@ -1401,11 +2102,39 @@ napi_value Database::Open(napi_env env, napi_callback_info info) {
 		dbHandleOptions.mode = DBMode::Pessimistic;
 	}
 
+	std::string mergeOperatorName;
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "mergeOperator", mergeOperatorName));
+	if (!mergeOperatorName.empty() && !parseMergeOperatorKind(mergeOperatorName, dbHandleOptions.mergeOperator)) {
+		std::string errorMsg = "Invalid merge operator: " + mergeOperatorName;
+		::napi_throw_error(env, nullptr, errorMsg.c_str());
+		return nullptr;
+	}
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "mergeAppendLimit", dbHandleOptions.mergeAppendLimit));
+
 	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "name", dbHandleOptions.name));
 	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "noBlockCache", dbHandleOptions.noBlockCache));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "partitionedIndexFilters", dbHandleOptions.partitionedIndexFilters));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "pinL0FilterAndIndexBlocksInCache", dbHandleOptions.pinL0FilterAndIndexBlocksInCache));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "pinTopLevelIndexAndFilter", dbHandleOptions.pinTopLevelIndexAndFilter));
+	if (dbHandleOptions.cacheIndexAndFilterBlocks && dbHandleOptions.noBlockCache) {
+		::napi_throw_error(env, nullptr, "cacheIndexAndFilterBlocks requires the block cache");
+		return nullptr;
+	}
+	if (dbHandleOptions.pinL0FilterAndIndexBlocksInCache && !dbHandleOptions.cacheIndexAndFilterBlocks) {
+		::napi_throw_error(env, nullptr, "pinL0FilterAndIndexBlocksInCache requires cacheIndexAndFilterBlocks");
+		return nullptr;
+	}
+	if (dbHandleOptions.pinTopLevelIndexAndFilter.has_value() && !dbHandleOptions.cacheIndexAndFilterBlocks) {
+		::napi_throw_error(env, nullptr, "pinTopLevelIndexAndFilter requires cacheIndexAndFilterBlocks");
+		return nullptr;
+	}
 	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "readOnly", dbHandleOptions.readOnly));
 	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "parallelismThreads", dbHandleOptions.parallelismThreads));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "tombstoneCompaction", dbHandleOptions.tombstoneCompaction));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "tombstoneCompactionBytesPerSecond", dbHandleOptions.tombstoneCompactionBytesPerSecond));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "tombstoneCompactionThreshold", dbHandleOptions.tombstoneCompactionThreshold));
 	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "writeBufferSize", dbHandleOptions.writeBufferSize));
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "writeThreadMaxYieldUsec", dbHandleOptions.writeThreadMaxYieldUsec));
 	// Parse as double and validate BEFORE narrowing: napi_get_value_int32
 	// truncates (-1.5 -> -1) and wraps modulo 2^32 (4294967295 -> -1), which
 	// would silently turn invalid values into "unlimited".
@@ -1428,6 +2157,7 @@ napi_value Database::Open(napi_env env, napi_callback_info info) {
 	std::string transactionLogsPath = (std::filesystem::path(path) / "transaction_logs").string();
 	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "transactionLogsPath", transactionLogsPath));
 	dbHandleOptions.transactionLogsPath = transactionLogsPath;
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, options, "transactionPoolSize", dbHandleOptions.transactionPoolSize));
 
 	if (dbHandleOptions.transactionLogMaxAgeThreshold < 0.0f || dbHandleOptions.transactionLogMaxAgeThreshold > 1.0f) {
 		::napi_throw_error(env, nullptr, "transactionLogMaxAgeThreshold must be between 0.0 and 1.0");
@@ -1549,6 +2279,138 @@ napi_value Database::PutSync(napi_env env, napi_callback_info info) {
 }
 
 
+/**
+ * Removes the keys from `start` (inclusive) to `end` (exclusive)
+ * asynchronously with a single range tombstone. With the `compact` option,
+ * the range is then compacted.
+ *
+ * @example
+ * ```typescript
+ * const db = new NativeDatabase();
+ * db.open('/tmp/testdb');
+ * await new Promise((resolve, reject) => db.removeRange(resolve, reject, Buffer.from('a'), Buffer.from('m'), { compact: true }));
+ * ```
+ */
+napi_value Database::RemoveRange(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(5);
+	UNWRAP_DB_HANDLE_AND_OPEN();
+	THROW_IF_READONLY((*dbHandle)->descriptor, "Remove range failed: ");
+
+	napi_value resolve = argv[0];
+	napi_value reject = argv[1];
+	NAPI_GET_BUFFER(argv[2], start, "Start key is required");
+	NAPI_GET_BUFFER(argv[3], end, "End key is required");
+
+	bool compact = false;
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, argv[4], "compact", compact));
+
+	auto state = new AsyncRemoveRangeState(env, *dbHandle);
+	state->startKey.assign(start + startStart, startEnd - startStart);
+	state->endKey.assign(end + endStart, endEnd - endStart);
+	state->compact = compact;
+
+	napi_value name;
+	NAPI_STATUS_THROWS(::napi_create_string_utf8(
+		env,
+		"database.removeRange",
+		NAPI_AUTO_LENGTH,
+		&name
+	));
+
+	NAPI_STATUS_THROWS(::napi_create_reference(env, resolve, 1, &state->resolveRef));
+	NAPI_STATUS_THROWS(::napi_create_reference(env, reject, 1, &state->rejectRef));
+
+	NAPI_STATUS_THROWS(::napi_create_async_work(
+		env,       // node_env
+		nullptr,   // async_resource
+		name,      // async_resource_name
+		[](napi_env doNotUse, void* data) { // execute
+			auto state = reinterpret_cast<AsyncRemoveRangeState*>(data);
+			if (!state->handle) {
+				state->status = rocksdb::Status::Aborted("Database closed during remove range operation");
+			} else {
+				state->status = state->handle->removeRange(state->startKey, state->endKey, state->compact);
+			}
+			// signal that execute handler is complete
+			state->signalExecuteCompleted();
+		},
+		[](napi_env env, napi_status status, void* data) { // complete
+			auto state = reinterpret_cast<AsyncRemoveRangeState*>(data);
+
+			state->deleteAsyncWork();
+
+			if (status != napi_cancelled) {
+				if (state->status.ok()) {
+					napi_value undefined;
+					NAPI_STATUS_THROWS_VOID(::napi_get_undefined(env, &undefined));
+					state->callResolve(undefined);
+				} else {
+					ROCKSDB_STATUS_CREATE_NAPI_ERROR_VOID(state->status, "Remove range failed");
+					state->callReject(error);
+				}
+			}
+
+			delete state;
+		},
+		state,
+		&state->asyncWork
+	));
+
+	(*dbHandle)->registerAsyncWork();
+
+	NAPI_STATUS_THROWS(::napi_queue_async_work(env, state->asyncWork));
+
+	NAPI_RETURN_UNDEFINED();
+}
+
+/**
+ * Removes the keys from `start` (inclusive) to `end` (exclusive)
+ * synchronously. When a transaction id is passed, the range is removed when
+ * that transaction commits instead.
+ *
+ * @example
+ * ```typescript
+ * const db = new NativeDatabase();
+ * db.open('/tmp/testdb');
+ * db.removeRangeSync(Buffer.from('a'), Buffer.from('m'));
+ * ```
+ */
+napi_value Database::RemoveRangeSync(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(4);
+	NAPI_GET_BUFFER(argv[0], start, "Start key is required");
+	NAPI_GET_BUFFER(argv[1], end, "End key is required");
+	UNWRAP_DB_HANDLE_AND_OPEN();
+	ACQUIRE_OPERATIONS_LOCK();
+	THROW_IF_READONLY((*dbHandle)->descriptor, "Remove range failed: ");
+
+	rocksdb::Slice startSlice(start + startStart, startEnd - startStart);
+	rocksdb::Slice endSlice(end + endStart, endEnd - endStart);
+
+	napi_valuetype txnIdType;
+	NAPI_STATUS_THROWS(::napi_typeof(env, argv[2], &txnIdType));
+
+	if (txnIdType == napi_number) {
+		uint32_t txnId;
+		NAPI_STATUS_THROWS(::napi_get_value_uint32(env, argv[2], &txnId));
+
+		auto txnHandle = (*dbHandle)->descriptor->transactionGet(txnId);
+		if (!txnHandle) {
+			std::string errorMsg = "Remove range failed: Transaction not found (txnId: " + std::to_string(txnId) + ")";
+			::napi_throw_error(env, nullptr, errorMsg.c_str());
+			NAPI_RETURN_UNDEFINED();
+		}
+		ROCKSDB_STATUS_THROWS_ERROR_LIKE(txnHandle->removeRangeSync(startSlice, endSlice, *dbHandle), "Remove range failed");
+		NAPI_RETURN_UNDEFINED();
+	}
+
+	bool compact = false;
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, argv[3], "compact", compact));
+
+	ROCKSDB_STATUS_THROWS_ERROR_LIKE((*dbHandle)->removeRange(startSlice, endSlice, compact), "Remove range failed");
+
+	NAPI_RETURN_UNDEFINED();
+}
+
 /**
  * Removes a key from the RocksDB database.
  */
@@ -1748,9 +2610,12 @@ void Database::Init(napi_env env, napi_value exports) {
 		{ "destroy", nullptr, Destroy, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "drop", nullptr, Drop, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "dropSync", nullptr, DropSync, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "finishBulkLoad", nullptr, FinishBulkLoad, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "finishBulkLoadSync", nullptr, FinishBulkLoadSync, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "flush", nullptr, Flush, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "flushSync", nullptr, FlushSync, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "get", nullptr, Get, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "getConflictStats", nullptr, GetConflictStats, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "getCount", nullptr, GetCount, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "getDBIntProperty", nullptr, GetDBIntProperty, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "getDBProperty", nullptr, GetDBProperty, nullptr, nullptr, nullptr, napi_default, nullptr },
@@ -1761,23 +2626,31 @@ void Database::Init(napi_env env, napi_value exports) {
 		{ "getSync", nullptr, GetSync, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "getUserSharedBuffer", nullptr, GetUserSharedBuffer, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "hasLock", nullptr, HasLock, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "ingest", nullptr, Ingest, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "ingestSync", nullptr, IngestSync, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "listeners", nullptr, Listeners, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "listLogs", nullptr, ListLogs, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "mergeSync", nullptr, MergeSync, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "notify", nullptr, Notify, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "open", nullptr, Open, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "opened", nullptr, nullptr, IsOpen, nullptr, nullptr, napi_default, nullptr },
+		{ "parkRead", nullptr, ParkRead, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "populateVersion", nullptr, PopulateVersion, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "purgeLogs", nullptr, PurgeLogs, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "putSync", nullptr, PutSync, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "removeListener", nullptr, RemoveListener, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "removeRange", nullptr, RemoveRange, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "removeRangeSync", nullptr, RemoveRangeSync, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "removeSync", nullptr, RemoveSync, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "setDefaultValueBuffer", nullptr, SetDefaultValueBuffer, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "setDefaultKeyBuffer", nullptr, SetDefaultKeyBuffer, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "setIteratorState", nullptr, SetIteratorState, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "setTtl", nullptr, SetTtl, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "tryLock", nullptr, TryLock, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "unlock", nullptr, Unlock, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "useLog", nullptr, UseLog, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "verifyVersion", nullptr, VerifyVersion, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "verifyVersions", nullptr, VerifyVersions, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "withLock", nullptr, WithLock, nullptr, nullptr, nullptr, napi_default, nullptr }
 	};
 
@@ -2,11 +2,14 @@
 #define __DATABASE_H__
 
 #include <cstring>
+#include <vector>
 #include <node_api.h>
 #include "rocksdb/db.h"
 #include "rocksdb/status.h"
 #include "database/db_handle.h"
+#include "database/db_settings.h"
 #include "napi/macros.h"
+#include "core/encoding.h"
 #include "core/platform.h"
 #include "napi/helpers.h"
 #include "napi/async.h"
@@ -32,6 +35,35 @@ inline bool parseExpectedVersion(napi_env env, napi_value arg, uint64_t& out) {
 	return true;
 }
 
+/**
+ * Splits a buffer of keys, each prefixed with its length as a big-endian
+ * uint32, into `keys` (views into `packed`). Returns false when the buffer
+ * does not hold exactly `count` keys.
+ */
+inline bool parsePackedKeys(
+	const char* packed,
+	size_t packedLength,
+	size_t count,
+	std::vector<rocksdb::Slice>& keys
+) {
+	keys.clear();
+	keys.reserve(count);
+	size_t offset = 0;
+	while (offset < packedLength && keys.size() < count) {
+		if (packedLength - offset < 4) {
+			break;
+		}
+		uint32_t keyLength = readUint32BE(packed + offset);
+		offset += 4;
+		if (packedLength - offset < keyLength) {
+			break;
+		}
+		keys.emplace_back(packed + offset, keyLength);
+		offset += keyLength;
+	}
+	return keys.size() == count && offset == packedLength;
+}
+
 /**
  * Returns the verification-table slot for (dbHandle, key), or nullptr if the
  * table pointer is null or the slot maps outside the table bounds.
@@ -49,6 +81,32 @@ inline std::atomic<uint64_t>* vtSlotFor(
 	return vt->slotFor(dbId, cfId, key);
 }
 
+/**
+ * Returns the verification-table partition the store's slots are tagged with
+ * (see VerificationTable::partitionFor).
+ */
+inline uint8_t vtPartitionFor(const std::shared_ptr<DBHandle>& dbHandle) {
+	return VerificationTable::partitionFor(
+		dbHandle->descriptor->vtEpoch,
+		dbHandle->getColumnFamilyHandle()->GetID()
+	);
+}
+
+/**
+ * Observes a slot before a cold read: loads the clear generation of the
+ * handle's partition, then the slot value, for the populate CAS after the read
+ * (see VerificationTable::populateVersionIfUnchanged).
+ */
+inline uint64_t vtObserve(
+	const std::shared_ptr<DBHandle>& dbHandle,
+	VerificationTable* vt,
+	std::atomic<uint64_t>* slot,
+	uint64_t& clearGen
+) {
+	clearGen = vt->clearGeneration(vtPartitionFor(dbHandle));
+	return slot->load(std::memory_order_acquire);
+}
+
 /**
  * Publishes a key's *latest committed* version into the verification-table slot
  * — making it cacheable — but only when that version is the single accessible
@@ -88,7 +146,8 @@ inline void vtPopulateIfSettled(
 	const rocksdb::Slice& key,
 	uint64_t readVersion,
 	const rocksdb::Snapshot* readSnapshot,
-	uint64_t observedSlot
+	uint64_t observedSlot,
+	uint64_t observedClearGen
 ) {
 	if (!slot) return;
 	// No usable version in the value the caller read (too short, or lock-tagged
@@ -170,7 +229,8 @@ inline void vtPopulateIfSettled(
 	}
 	// Conditional CAS from the value observed before the read: a no-op if any
 	// write cycle intervened, so a stale/superseded version is never published.
-	VerificationTable::populateVersionIfUnchanged(slot, observedSlot, version);
+	VerificationTable* vt = DBSettings::getInstance().getVerificationTableRaw();
+	if (vt) vt->populateVersionIfUnchanged(slot, vtPartitionFor(dbHandle), observedSlot, observedClearGen, version);
 }
 
 #define ONLY_IF_IN_MEMORY_CACHE_FLAG 0x40000000
@@ -281,9 +341,12 @@ struct Database final {
 	static napi_value Compact(napi_env env, napi_callback_info info);
 	static napi_value CompactSync(napi_env env, napi_callback_info info);
 	static napi_value CreateCheckpoint(napi_env env, napi_callback_info info);
+	static napi_value FinishBulkLoad(napi_env env, napi_callback_info info);
+	static napi_value FinishBulkLoadSync(napi_env env, napi_callback_info info);
 	static napi_value Flush(napi_env env, napi_callback_info info);
 	static napi_value FlushSync(napi_env env, napi_callback_info info);
 	static napi_value Get(napi_env env, napi_callback_info info);
+	static napi_value GetConflictStats(napi_env env, napi_callback_info info);
 	static napi_value GetCount(napi_env env, napi_callback_info info);
 	static napi_value GetDBIntProperty(napi_env env, napi_callback_info info);
 	static napi_value GetDBProperty(napi_env env, napi_callback_info info);
@@ -294,23 +357,31 @@ struct Database final {
 	static napi_value GetSync(napi_env env, napi_callback_info info);
 	static napi_value GetUserSharedBuffer(napi_env env, napi_callback_info info);
 	static napi_value HasLock(napi_env env, napi_callback_info info);
+	static napi_value Ingest(napi_env env, napi_callback_info info);
+	static napi_value IngestSync(napi_env env, napi_callback_info info);
 	static napi_value IsOpen(napi_env env, napi_callback_info info);
 	static napi_value Listeners(napi_env env, napi_callback_info info);
 	static napi_value ListLogs(napi_env env, napi_callback_info info);
+	static napi_value MergeSync(napi_env env, napi_callback_info info);
 	static napi_value Notify(napi_env env, napi_callback_info info);
 	static napi_value Open(napi_env env, napi_callback_info info);
+	static napi_value ParkRead(napi_env env, napi_callback_info info);
 	static napi_value PopulateVersion(napi_env env, napi_callback_info info);
 	static napi_value PurgeLogs(napi_env env, napi_callback_info info);
 	static napi_value PutSync(napi_env env, napi_callback_info info);
 	static napi_value RemoveListener(napi_env env, napi_callback_info info);
+	static napi_value RemoveRange(napi_env env, napi_callback_info info);
+	static napi_value RemoveRangeSync(napi_env env, napi_callback_info info);
 	static napi_value RemoveSync(napi_env env, napi_callback_info info);
 	static napi_value SetDefaultValueBuffer(napi_env env, napi_callback_info info);
 	static napi_value SetDefaultKeyBuffer(napi_env env, napi_callback_info info);
 	static napi_value SetIteratorState(napi_env env, napi_callback_info info);
+	static napi_value SetTtl(napi_env env, napi_callback_info info);
 	static napi_value TryLock(napi_env env, napi_callback_info info);
 	static napi_value Unlock(napi_env env, napi_callback_info info);
 	static napi_value UseLog(napi_env env, napi_callback_info info);
 	static napi_value VerifyVersion(napi_env env, napi_callback_info info);
+	static napi_value VerifyVersions(napi_env env, napi_callback_info info);
 	static napi_value WithLock(napi_env env, napi_callback_info info);
 
 	static void Init(napi_env env, napi_value exports);
@@ -356,6 +427,47 @@ struct AsyncFlushState final : BaseAsyncState<std::shared_ptr<DBHandle>> {
 		BaseAsyncState<std::shared_ptr<DBHandle>>(env, handle) {}
 };
 
+/**
+ * State for the `FinishBulkLoad` async work.
+ */
+struct AsyncFinishBulkLoadState final : BaseAsyncState<std::shared_ptr<DBHandle>> {
+	AsyncFinishBulkLoadState(
+		napi_env env,
+		std::shared_ptr<DBHandle> handle
+	) :
+		BaseAsyncState<std::shared_ptr<DBHandle>>(env, handle) {}
+};
+
+/**
+ * State for the `RemoveRange` async work.
+ */
+struct AsyncRemoveRangeState final : BaseAsyncState<std::shared_ptr<DBHandle>> {
+	std::string startKey;
+	std::string endKey;
+	bool compact = false;
+
+	AsyncRemoveRangeState(napi_env env, std::shared_ptr<DBHandle> handle)
+		: BaseAsyncState<std::shared_ptr<DBHandle>>(env, handle) {}
+};
+
+/**
+ * State for the `Ingest` async work.
+ */
+struct AsyncIngestState final : BaseAsyncState<std::shared_ptr<DBHandle>> {
+	AsyncIngestState(
+		napi_env env,
+		std::shared_ptr<DBHandle> handle,
+		std::vector<std::string> files,
+		bool moveFiles
+	) :
+		BaseAsyncState<std::shared_ptr<DBHandle>>(env, handle),
+		files(std::move(files)),
+		moveFiles(moveFiles) {}
+
+	std::vector<std::string> files;
+	bool moveFiles;
+};
+
 /**
  * State for the `Get` async work. This is used for both `DBHandle` and
  * `TransactionHandle`.
@@ -388,9 +500,13 @@ struct AsyncGetState final : BaseAsyncState<T> {
 	uint64_t expectedVersion = 0;
 	bool wantsPopulate = false;
 	std::atomic<uint64_t>* vtSlot = nullptr;
+	// Partition the slot is tagged with on populate (see vtPartitionFor).
+	uint8_t vtPartition = VT_PARTITION_NONE;
 	// Slot value observed before the async read was queued; the post-read CAS
 	// publishes only if the slot is still this (no write cycle intervened).
 	uint64_t vtObserved = 0;
+	// Clear generation of the slot's partition loaded with vtObserved.
+	uint64_t vtClearGen = 0;
 };
 
 napi_value resolveGetSyncResult(
@@ -412,7 +528,8 @@ void resolveGetResult(
 	NAPI_STATUS_THROWS_VOID(::napi_get_global(env, &global));
 
 	if (state->status.IsNotFound() || state->status.ok()) {
-		if (state->status.ok() && state->vtSlot) {
+		VerificationTable* vt = state->vtSlot ? DBSettings::getInstance().getVerificationTableRaw() : nullptr;
+		if (state->status.ok() && vt) {
 			// VT check and populate for the async read result.
 			rocksdb::Slice valueSlice(state->value.data(), state->value.size());
 			uint64_t extracted = VerificationTable::extractVersionFromValue(valueSlice);
@@ -420,14 +537,15 @@ void resolveGetResult(
 				// Soft miss: value still carries the expected version — signal FRESH.
 				// Conditional CAS from the value observed before the read (no-op if
 				// a write cycle intervened) so we never publish a superseded version.
-				VerificationTable::populateVersionIfUnchanged(state->vtSlot, state->vtObserved, state->expectedVersion);
+				vtCount(VTCounter::SoftMiss);
+				vt->populateVersionIfUnchanged(state->vtSlot, state->vtPartition, state->vtObserved, state->vtClearGen, state->expectedVersion);
 				napi_value freshResult;
 				::napi_create_int32(env, FRESH_VERSION_FLAG, &freshResult);
 				state->callResolve(freshResult);
 				return;
 			}
 			if ((state->wantsPopulate || state->hasExpectedVersion) && extracted != 0) {
-				VerificationTable::populateVersionIfUnchanged(state->vtSlot, state->vtObserved, extracted);
+				vt->populateVersionIfUnchanged(state->vtSlot, state->vtPartition, state->vtObserved, state->vtClearGen, extracted);
 			}
 		}
 		napi_value result;
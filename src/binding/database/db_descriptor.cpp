@@ -1,8 +1,10 @@
+#include "core/merge_operators.h"
 #include "core/platform.h"
 #include "database/db_descriptor.h"
 #include "database/db_settings.h"
 #include "transaction_log/transaction_log_store_registry.h"
 #include "rocksdb/listener.h"
+#include "rocksdb/memtablerep.h"
 #include <algorithm>
 #include <memory>
 
@@ -133,8 +135,18 @@ DBDescriptor::DBDescriptor(
 	readOnly(options.readOnly),
 	db(db),
 	columns(std::move(columns)),
-	statistics(statistics)
-{}
+	statistics(statistics),
+	parallelismThreads(options.parallelismThreads),
+	transactionPoolSize(options.transactionPoolSize)
+{
+	// Assign shared commit lanes (if enabled) once, at open, so every commit of
+	// this database runs through the same FIFO lane for its lifetime. The log
+	// lane sits next to the commit lane so the two-lane stages can overlap.
+	CommitExecutor& executor = CommitExecutor::getInstance();
+	uint64_t hash = CommitExecutor::hashKey(path);
+	this->sharedCommitLane = executor.acquireLane(hash, 0, this->commitLaneIndex);
+	this->sharedLogLane = executor.acquireLane(hash, 1, this->logLaneIndex);
+}
 
 /**
  * Destroy the database descriptor and any resources associated to it
@@ -159,6 +171,30 @@ void DBDescriptor::close() {
 	this->finishClose();
 }
 
+void DBDescriptor::enqueueCommitTask(std::function<void()> task) {
+	if (this->sharedCommitLane) {
+		this->laneTracker->enqueue(this->sharedCommitLane, std::move(task));
+	} else {
+		this->commitWorker.enqueue(std::move(task));
+	}
+}
+
+void DBDescriptor::enqueueLogTask(std::function<void()> task) {
+	if (this->sharedLogLane) {
+		this->laneTracker->enqueue(this->sharedLogLane, std::move(task));
+	} else {
+		this->logWorker.enqueue(std::move(task));
+	}
+}
+
+size_t DBDescriptor::commitQueueDepth() {
+	return this->sharedCommitLane ? this->sharedCommitLane->depth() : this->commitWorker.depth();
+}
+
+size_t DBDescriptor::logQueueDepth() {
+	return this->sharedLogLane ? this->sharedLogLane->depth() : this->logWorker.depth();
+}
+
 void DBDescriptor::finishClose() {
 	DEBUG_LOG("%p DBDescriptor::close Closing \"%s\" (mode=%s read-only=%s closables=%zu columns=%zu transactions=%zu)\n",
 		this, this->path.c_str(), this->mode == DBMode::Optimistic ? "optimistic" : "pessimistic", this->readOnly ? "true" : "false", this->closables.size(), this->columns.size(), this->transactions.size());
@@ -176,9 +212,16 @@ void DBDescriptor::finishClose() {
 	// Drain the commit pipeline before flushing so its data is included in
 	// the flush. The log lane feeds the commit lane, so it must drain first;
 	// its final tasks enqueue onto the still-running commit lane (or run
-	// inline once that lane stops).
+	// inline once that lane stops). Shared executor lanes keep running for
+	// other databases, so only this database's queued tasks are waited for.
 	this->logWorker.shutdown();
 	this->commitWorker.shutdown();
+	this->laneTracker->drain();
+
+	// Stop compacting tombstone ranges; a running compaction is canceled.
+	if (this->tombstoneCompactor) {
+		this->tombstoneCompactor->shutdown();
+	}
 
 	// Release any remaining per-env commit-completion tsfns. An in-flight
 	// commit pins this descriptor (state -> txnHandle -> dbHandle -> descriptor),
@@ -260,6 +303,17 @@ void DBDescriptor::finishClose() {
 		}
 	}
 
+	// Every transaction handle is closed, so the pool now holds all remaining
+	// RocksDB transactions; they must be destroyed before the database is.
+	{
+		std::lock_guard<std::mutex> lock(this->transactionPoolMutex);
+		for (auto* txn : this->transactionPool) {
+			delete txn;
+		}
+		this->transactionPool.clear();
+		this->transactionPoolClosed = true;
+	}
+
 	// Unregister from transaction log store registry - this will clean up stores
 	// when the last descriptor for this path is closed
 	TransactionLogStoreRegistry::Unregister(this->path);
@@ -795,6 +849,7 @@ std::shared_ptr<DBDescriptor> DBDescriptor::open(const std::string& path, const
 	} else {
 		tableOptions.block_cache = settings.getBlockCache();
 	}
+	setTableOptions(tableOptions, options);
 
 	// set the database options
 	rocksdb::Options dbOptions;
@@ -811,7 +866,34 @@ std::shared_ptr<DBDescriptor> DBDescriptor::open(const std::string& path, const
 	if (auto wbm = settings.getWriteBufferManager()) {
 		dbOptions.write_buffer_manager = wbm;
 	}
-	dbOptions.IncreaseParallelism(options.parallelismThreads);
+	// write path: how the writers of a write group share the work
+	dbOptions.allow_concurrent_memtable_write = options.allowConcurrentMemtableWrite;
+	dbOptions.write_thread_max_yield_usec = options.writeThreadMaxYieldUsec;
+	if (settings.hasSharedBackgroundThreads()) {
+		// config({ backgroundThreads }) sized a process-wide pool; resizing it
+		// here would undo it. A pool left at 0 is still sized the way
+		// IncreaseParallelism() would: one flush thread and
+		// `parallelismThreads` compaction threads.
+		rocksdb::Env* defaultEnv = rocksdb::Env::Default();
+		if (settings.getBackgroundThreadsHigh() == 0) {
+			defaultEnv->SetBackgroundThreads(1, rocksdb::Env::Priority::HIGH);
+		}
+		if (settings.getBackgroundThreadsLow() == 0) {
+			defaultEnv->SetBackgroundThreads(static_cast<int>(options.parallelismThreads), rocksdb::Env::Priority::LOW);
+		}
+		dbOptions.max_background_jobs = std::max(1,
+			defaultEnv->GetBackgroundThreads(rocksdb::Env::Priority::HIGH) +
+			defaultEnv->GetBackgroundThreads(rocksdb::Env::Priority::LOW)
+		);
+	} else {
+		dbOptions.IncreaseParallelism(options.parallelismThreads);
+	}
+	// Attach the process-wide rate limiter (if configured) so the flushes and
+	// compactions of every database share one I/O budget.
+	if (auto rateLimiter = settings.getRateLimiter()) {
+		dbOptions.rate_limiter = rateLimiter;
+	}
+	dbOptions.listeners.push_back(settings.getBackgroundJobListener());
 	// Bound how many table files RocksDB holds open: with the RocksDB default
 	// (-1, every SST open forever) compaction lag under sustained ingest can
 	// run the process out of fds (HarperFast/harper#1785 environment).
@@ -829,19 +911,59 @@ std::shared_ptr<DBDescriptor> DBDescriptor::open(const std::string& path, const
 
 	// Define base ColumnFamilyOptions that include blob settings
 	rocksdb::ColumnFamilyOptions cfOptions;
-	cfOptions.enable_blob_files = true;
-	cfOptions.min_blob_size = 2048;
-	cfOptions.enable_blob_garbage_collection = true;
+	setBlobOptions(cfOptions, options);
 	cfOptions.write_buffer_size = static_cast<size_t>(options.writeBufferSize);
 	cfOptions.max_write_buffer_number = options.maxWriteBufferNumber;
 	cfOptions.max_write_buffer_size_to_maintain = options.maxWriteBufferSizeToMaintain;
 	cfOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+	// every column family gets the built-in operators; each operand names its own
+	cfOptions.merge_operator = rocksdb_js::getBuiltinMergeOperator();
+	// every column family gets the TTL filter factory too; it only creates a
+	// filter for the column families that have a rule
+	auto ttlRules = std::make_shared<TtlRules>();
+	cfOptions.compaction_filter_factory = std::make_shared<TtlCompactionFilterFactory>(ttlRules);
+	dbOptions.listeners.push_back(std::make_shared<TtlEventListener>(ttlRules));
+
+	if (options.bulkLoad && !options.readOnly) {
+		// Appending to a vector and sorting it once on flush beats inserting
+		// into a skiplist when nothing reads the memtable. The memtable
+		// factory cannot be changed with SetOptions(), so it stays after
+		// finishBulkLoad() until the database is reopened, which the docs ask
+		// for. The vector memtable does not support concurrent inserts.
+		cfOptions.memtable_factory = std::make_shared<rocksdb::VectorRepFactory>();
+		dbOptions.allow_concurrent_memtable_write = false;
+	}
 
 	// create a shared pointer to hold the weak descriptor reference for the event listener
 	auto descriptorWeakPtr = std::make_shared<std::weak_ptr<DBDescriptor>>();
 	auto eventListener = std::make_shared<TransactionLogEventListener>(descriptorWeakPtr);
 	dbOptions.listeners.push_back(eventListener);
 
+	// mark deletion-heavy files for compaction and compact the ranges
+	// iterators find full of tombstones
+	std::shared_ptr<TombstoneCompactor> tombstoneCompactor;
+	if (options.tombstoneCompaction && !options.readOnly) {
+		cfOptions.table_properties_collector_factories.push_back(newTombstoneCollectorFactory());
+		tombstoneCompactor = std::make_shared<TombstoneCompactor>(
+			options.tombstoneCompactionThreshold,
+			options.tombstoneCompactionBytesPerSecond,
+			[descriptorWeakPtr](
+				uint32_t cfId,
+				const std::string& start,
+				const std::string& end,
+				std::atomic<bool>* canceled,
+				uint64_t& bytes
+			) {
+				auto descriptor = descriptorWeakPtr->lock();
+				if (!descriptor || descriptor->isClosing()) {
+					return rocksdb::Status::Aborted("Database closed");
+				}
+				return descriptor->compactTombstones(cfId, start, end, canceled, bytes);
+			}
+		);
+		dbOptions.listeners.push_back(std::make_shared<TombstoneEventListener>(tombstoneCompactor));
+	}
+
 	// prepare the column family stuff - first check if database exists
 	std::vector<rocksdb::ColumnFamilyDescriptor> cfDescriptors;
 	std::vector<std::string> columnFamilyNames;
@@ -918,7 +1040,7 @@ std::shared_ptr<DBDescriptor> DBDescriptor::open(const std::string& path, const
 		}
 	}
 	if (!columnExists) {
-		auto column = rocksdb_js::createRocksDBColumnFamily(db, options.name);
+		auto column = rocksdb_js::createRocksDBColumnFamily(db, options.name, options);
 		auto columnDescriptor = std::make_shared<ColumnFamilyDescriptor>(column);
 		columns[options.name] = columnDescriptor;
 	}
@@ -926,6 +1048,9 @@ std::shared_ptr<DBDescriptor> DBDescriptor::open(const std::string& path, const
 	DEBUG_LOG("DBDescriptor::open Creating DBDescriptor for \"%s\"\n", path.c_str());
 	auto descriptor = std::shared_ptr<DBDescriptor>(new DBDescriptor(path, options, db, std::move(columns), dbOptions.statistics));
 
+	descriptor->ttlRules = ttlRules;
+	descriptor->tombstoneCompactor = tombstoneCompactor;
+
 	// set the weak pointer for the event listener
 	*descriptorWeakPtr = descriptor;
 
@@ -959,7 +1084,7 @@ std::shared_ptr<TransactionHandle> DBDescriptor::transactionGet(uint32_t id) {
 	auto it = this->transactions.find(id);
 	if (it != this->transactions.end()) {
 		auto txnHandle = it->second;
-		if (txnHandle && txnHandle->txn) {
+		if (txnHandle && txnHandle->active()) {
 			return txnHandle;
 		}
 	}
@@ -989,6 +1114,54 @@ uint32_t DBDescriptor::transactionGetNextId() {
 	return ++this->nextTransactionId;
 }
 
+/**
+ * Begins a RocksDB transaction. `oldTxn`, or else a pooled transaction, is
+ * re-initialized in place rather than allocating a new one.
+ */
+rocksdb::Transaction* DBDescriptor::transactionBegin(const rocksdb::WriteOptions& writeOptions, rocksdb::Transaction* oldTxn) {
+	if (!oldTxn) {
+		std::lock_guard<std::mutex> lock(this->transactionPoolMutex);
+		if (!this->transactionPool.empty()) {
+			oldTxn = this->transactionPool.back();
+			this->transactionPool.pop_back();
+		}
+	}
+
+	if (this->mode == DBMode::Pessimistic) {
+		auto* tdb = static_cast<rocksdb::TransactionDB*>(this->db.get());
+		rocksdb::TransactionOptions txnOptions;
+		return tdb->BeginTransaction(writeOptions, txnOptions, oldTxn);
+	}
+	if (this->mode == DBMode::Optimistic) {
+		auto* odb = static_cast<rocksdb::OptimisticTransactionDB*>(this->db.get());
+		rocksdb::OptimisticTransactionOptions txnOptions;
+		return odb->BeginTransaction(writeOptions, txnOptions, oldTxn);
+	}
+
+	delete oldTxn;
+	throw rocksdb_js::DBException("Invalid database");
+}
+
+/**
+ * Returns a closed transaction to the pool, or deletes it if the pool is full
+ * or the descriptor is closing.
+ */
+void DBDescriptor::transactionRecycle(rocksdb::Transaction* txn) {
+	// A handle can close without committing or rolling back (GC, database
+	// close). Roll back so a pooled pessimistic transaction does not keep its
+	// key locks until it is reused; this is a no-op error for a committed one.
+	txn->Rollback().PermitUncheckedError();
+	txn->ClearSnapshot();
+	{
+		std::lock_guard<std::mutex> lock(this->transactionPoolMutex);
+		if (!this->transactionPoolClosed && this->transactionPool.size() < this->transactionPoolSize) {
+			this->transactionPool.push_back(txn);
+			return;
+		}
+	}
+	delete txn;
+}
+
 /**
  * Removes a dropped column family from the columns map so a later open-by-name
  * creates a fresh column family instead of reusing the dangling dropped
@@ -1603,6 +1776,71 @@ rocksdb::Status DBDescriptor::flush() {
 	);
 }
 
+/**
+ * The mutable column family options changed for a bulk load.
+ */
+static const std::unordered_map<std::string, std::string> bulkLoadOptions = {
+	{ "disable_auto_compactions", "true" },
+	{ "level0_file_num_compaction_trigger", "1073741824" },
+	{ "level0_slowdown_writes_trigger", "1073741824" },
+	{ "level0_stop_writes_trigger", "1073741824" },
+	{ "soft_pending_compaction_bytes_limit", "0" },
+	{ "hard_pending_compaction_bytes_limit", "0" }
+};
+
+rocksdb::Status DBDescriptor::beginBulkLoad(rocksdb::ColumnFamilyHandle* column) {
+	DEBUG_LOG("%p DBDescriptor::beginBulkLoad Applying bulk load options\n", this);
+	std::lock_guard<std::mutex> lock(this->bulkLoadMutex);
+	// another handle may already have the column family in a bulk load, in
+	// which case the settings to restore are the ones it captured
+	bool captured = this->bulkLoadPriorOptions.count(column->GetID()) > 0;
+	std::unordered_map<std::string, std::string> prior;
+	if (!captured) {
+		rocksdb::ColumnFamilyOptions current = this->db->GetOptions(column);
+		prior = {
+			{ "disable_auto_compactions", current.disable_auto_compactions ? "true" : "false" },
+			{ "level0_file_num_compaction_trigger", std::to_string(current.level0_file_num_compaction_trigger) },
+			{ "level0_slowdown_writes_trigger", std::to_string(current.level0_slowdown_writes_trigger) },
+			{ "level0_stop_writes_trigger", std::to_string(current.level0_stop_writes_trigger) },
+			{ "soft_pending_compaction_bytes_limit", std::to_string(current.soft_pending_compaction_bytes_limit) },
+			{ "hard_pending_compaction_bytes_limit", std::to_string(current.hard_pending_compaction_bytes_limit) }
+		};
+	}
+	rocksdb::Status status = this->db->SetOptions(column, bulkLoadOptions);
+	if (status.ok() && !captured) {
+		this->bulkLoadPriorOptions.emplace(column->GetID(), std::move(prior));
+	}
+	return status;
+}
+
+rocksdb::Status DBDescriptor::finishBulkLoad(rocksdb::ColumnFamilyHandle* column) {
+	std::unordered_map<std::string, std::string> prior;
+	{
+		std::lock_guard<std::mutex> lock(this->bulkLoadMutex);
+		auto it = this->bulkLoadPriorOptions.find(column->GetID());
+		if (it == this->bulkLoadPriorOptions.end()) {
+			// never in a bulk load, or another handle already finished it
+			return rocksdb::Status::OK();
+		}
+		prior = std::move(it->second);
+		this->bulkLoadPriorOptions.erase(it);
+	}
+
+	std::lock_guard<std::mutex> lock(this->compactMutex);
+	DEBUG_LOG("%p DBDescriptor::finishBulkLoad Compacting with %u subcompactions\n", this, this->parallelismThreads);
+
+	// flushes the memtable, then merges every L0 file into sorted levels
+	rocksdb::CompactRangeOptions compactOptions;
+	compactOptions.max_subcompactions = this->parallelismThreads;
+	compactOptions.bottommost_level_compaction = rocksdb::BottommostLevelCompaction::kForceOptimized;
+	rocksdb::Status status = this->db->CompactRange(compactOptions, column, nullptr, nullptr);
+
+	// revert even if the compaction failed, so background compactions can
+	// catch up instead of leaving the column family in bulk load mode
+	rocksdb::Status revertStatus = this->db->SetOptions(column, prior);
+	return status.ok() ? revertStatus : status;
+}
+
 rocksdb::Status DBDescriptor::compactRange(
 	rocksdb::ColumnFamilyHandle* column,
 	const rocksdb::Slice* start,
@@ -1618,4 +1856,52 @@ rocksdb::Status DBDescriptor::compactRange(
 	);
 }
 
+rocksdb::Status DBDescriptor::compactTombstones(
+	uint32_t cfId,
+	const std::string& start,
+	const std::string& end,
+	std::atomic<bool>* canceled,
+	uint64_t& bytes
+) {
+	std::shared_ptr<rocksdb::ColumnFamilyHandle> column;
+	{
+		std::lock_guard<std::mutex> columnsLock(this->columnsMutex);
+		for (const auto& [name, columnDesc] : this->columns) {
+			if (columnDesc && columnDesc->column && columnDesc->column->GetID() == cfId) {
+				column = columnDesc->column;
+				break;
+			}
+		}
+	}
+	if (!column) {
+		return rocksdb::Status::NotFound("Column family was dropped");
+	}
+
+	rocksdb::Slice startSlice(start);
+	rocksdb::Slice endSlice(end);
+	bytes = 0;
+	if (end.empty()) {
+		// no end key to size the range with, so assume all of it
+		this->db->GetIntProperty(column.get(), "rocksdb.total-sst-files-size", &bytes);
+	} else {
+		rocksdb::Range range(startSlice, endSlice);
+		rocksdb::SizeApproximationOptions sizeOptions;
+		sizeOptions.include_files = true;
+		sizeOptions.include_memtables = true;
+		this->db->GetApproximateSizes(sizeOptions, column.get(), &range, 1, &bytes);
+	}
+
+	DEBUG_LOG("%p DBDescriptor::compactTombstones Compacting range of ~%llu bytes\n", this, static_cast<unsigned long long>(bytes));
+	rocksdb::CompactRangeOptions compactOptions;
+	compactOptions.exclusive_manual_compaction = false;
+	compactOptions.bottommost_level_compaction = rocksdb::BottommostLevelCompaction::kForceOptimized;
+	compactOptions.canceled = canceled;
+	return this->db->CompactRange(
+		compactOptions,
+		column.get(),
+		start.empty() ? nullptr : &startSlice,
+		end.empty() ? nullptr : &endSlice
+	);
+}
+
 } // namespace rocksdb_js
@@ -8,6 +8,7 @@
 #include <queue>
 #include <set>
 #include <unordered_map>
+#include <vector>
 #include <functional>
 #include "rocksdb/db.h"
 #include "rocksdb/statistics.h"
@@ -15,10 +16,15 @@
 #include "rocksdb/utilities/optimistic_transaction_db.h"
 #include "rocksdb/utilities/options_util.h"
 #include "options/db_options.h"
+#include "database/commit_executor.h"
+#include "database/commit_mode.h"
 #include "database/commit_worker.h"
 #include "transaction/transaction_handle.h"
 #include "transaction_log/transaction_log_store_registry.h"
+#include "core/conflict_profiler.h"
 #include "core/platform.h"
+#include "core/tombstone_compactor.h"
+#include "core/ttl_compaction_filter.h"
 #include "napi/event_emitter.h"
 #include "napi/helpers.h"
 #include "napi/async.h"
@@ -136,6 +142,39 @@ struct DBDescriptor final : public std::enable_shared_from_this<DBDescriptor> {
 	 */
 	std::mutex txnsMutex;
 
+	/**
+	 * The most closed transactions kept in `transactionPool`, from the
+	 * `transactionPoolSize` option. 0 disables the pool.
+	 */
+	const size_t transactionPoolSize;
+
+	/**
+	 * RocksDB transactions returned by closed transaction handles. Passing one
+	 * to `BeginTransaction()` re-initializes it in place, reusing its write
+	 * batch and key-tracking allocations instead of allocating a new
+	 * transaction. Drained when the descriptor closes, before the database is
+	 * released.
+	 */
+	std::vector<rocksdb::Transaction*> transactionPool;
+
+	/**
+	 * Mutex to protect `transactionPool`. Transactions are recycled from
+	 * whichever thread closes their handle (JS or commit lane).
+	 */
+	std::mutex transactionPoolMutex;
+
+	/**
+	 * Set once the pool is drained on close; later recycled transactions are
+	 * deleted instead of pooled.
+	 */
+	bool transactionPoolClosed = false;
+
+	/**
+	 * The keys transactions conflict on, enabled by the `conflictStatsSize`
+	 * open option and read by `getConflictStats()`.
+	 */
+	ConflictProfiler conflictProfiler;
+
 	/**
 	 * Set of closables to be closed when the descriptor is closed.
 	 */
@@ -169,6 +208,20 @@ struct DBDescriptor final : public std::enable_shared_from_this<DBDescriptor> {
 	 */
 	std::mutex compactMutex;
 
+	/**
+	 * The mutable column family options in effect before `beginBulkLoad()`, by
+	 * column family id, restored by `finishBulkLoad()`. Guarded by
+	 * `bulkLoadMutex`.
+	 */
+	std::unordered_map<uint32_t, std::unordered_map<std::string, std::string>> bulkLoadPriorOptions;
+	std::mutex bulkLoadMutex;
+
+	/**
+	 * The number of background threads the database was opened with. Used as
+	 * the subcompaction count for the compaction that finishes a bulk load.
+	 */
+	uint32_t parallelismThreads;
+
 	/**
 	 * Per-database event emitter. Listeners attached here only fire for events
 	 * emitted on this descriptor. Cleaned up per-DBHandle on close and fully
@@ -181,7 +234,8 @@ struct DBDescriptor final : public std::enable_shared_from_this<DBDescriptor> {
 	 * threadpool, shared by all envs/handles on this database. In the default
 	 * single-lane mode only commitWorker runs: each commit executes its log
 	 * write and RocksDB commit back to back in dispatch order (logWorker is
-	 * never started). In two-lane mode (ROCKSDB_JS_COMMIT_THREAD=2) the log
+	 * never started). In two-lane mode (ROCKSDB_JS_COMMIT_THREAD=2, or while
+	 * the adaptive mode measures expensive stages — see commitMode) the log
 	 * lane writes the transaction-log batch (a pass-through no-op for txns
 	 * with no log entries, preserving total order), then forwards to the
 	 * commit lane, letting the stages overlap across transactions while each
@@ -195,6 +249,47 @@ struct DBDescriptor final : public std::enable_shared_from_this<DBDescriptor> {
 	CommitWorker commitWorker{"rocksdb-commit"};
 	CommitWorker logWorker{"rocksdb-txnlog"};
 
+	/**
+	 * Shared lanes from the process-wide CommitExecutor, assigned when the
+	 * database is opened with `config({ commitLanes })` > 0. When set, they are
+	 * used in place of commitWorker/logWorker (which then never start). The
+	 * lane indexes are -1 when the dedicated workers are in use.
+	 */
+	std::shared_ptr<CommitWorker> sharedCommitLane;
+	std::shared_ptr<CommitWorker> sharedLogLane;
+	int32_t commitLaneIndex = -1;
+	int32_t logLaneIndex = -1;
+
+	/**
+	 * Counts this database's tasks on the shared lanes so close can drain them.
+	 */
+	std::shared_ptr<CommitLaneTracker> laneTracker = std::make_shared<CommitLaneTracker>();
+
+	/**
+	 * Commit stage timings, per-mode commit counters and, in adaptive mode
+	 * (ROCKSDB_JS_COMMIT_THREAD=auto), the current single/two-lane choice.
+	 */
+	CommitModeTracker commitMode;
+
+	/**
+	 * Recycled transaction log entry arenas. A transaction's batch takes one
+	 * when its first log entry is added and returns it once the batch has been
+	 * written (or the transaction is reset), usually from the commit thread.
+	 */
+	std::shared_ptr<TransactionLogArenaPool> logArenaPool = std::make_shared<TransactionLogArenaPool>();
+
+	/**
+	 * The TTL rules of each column family, read by the compaction filter
+	 * factory every column family was opened with. Set with `db.setTtl()`.
+	 */
+	std::shared_ptr<TtlRules> ttlRules = std::make_shared<TtlRules>();
+
+	/**
+	 * Compacts the key ranges iterators find full of tombstones. Set when the
+	 * database was opened with `tombstoneCompaction`, otherwise null.
+	 */
+	std::shared_ptr<TombstoneCompactor> tombstoneCompactor;
+
 	/**
 	 * Per-env commit-completion plumbing. The commit thread is shared across
 	 * every env that opened this database, but each async commit's completion
@@ -226,6 +321,20 @@ struct DBDescriptor final : public std::enable_shared_from_this<DBDescriptor> {
 	// racing the close falls back to the legacy libuv path instead.
 	bool commitCompletionsClosed = false;
 
+	/**
+	 * Enqueues a task on this database's commit (or log) lane: the shared
+	 * executor lane when assigned, otherwise the dedicated worker.
+	 */
+	void enqueueCommitTask(std::function<void()> task);
+	void enqueueLogTask(std::function<void()> task);
+
+	/**
+	 * Queue depth of this database's commit (or log) lane. With shared lanes
+	 * this includes other databases' tasks queued on the same lane.
+	 */
+	size_t commitQueueDepth();
+	size_t logQueueDepth();
+
 	/**
 	 * JS thread. Ensures a completion tsfn exists for `env` (created with
 	 * `callJs`) and accounts a newly dispatched commit, ref-ing the tsfn as the
@@ -338,6 +447,8 @@ public:
 	std::shared_ptr<TransactionHandle> transactionGet(uint32_t id);
 	void transactionRemove(std::shared_ptr<TransactionHandle> txnHandle);
 	uint32_t transactionGetNextId();
+	rocksdb::Transaction* transactionBegin(const rocksdb::WriteOptions& writeOptions, rocksdb::Transaction* oldTxn = nullptr);
+	void transactionRecycle(rocksdb::Transaction* txn);
 
 	/**
 	 * Removes a dropped column family from the columns map (under
@@ -394,6 +505,36 @@ public:
 		const rocksdb::Slice* start,
 		const rocksdb::Slice* end
 	);
+
+	/**
+	 * Compacts a key range of the column family with id `cfId` for the
+	 * tombstone compactor, down to the bottommost level so its tombstones are
+	 * dropped. Unlike `compactRange()`, it does not take the compact mutex or
+	 * block automatic compactions, and stops when `canceled` is set. An empty
+	 * `start` or `end` is unbounded. Sets `bytes` to the estimated size of the
+	 * range.
+	 */
+	rocksdb::Status compactTombstones(
+		uint32_t cfId,
+		const std::string& start,
+		const std::string& end,
+		std::atomic<bool>* canceled,
+		uint64_t& bytes
+	);
+
+	/**
+	 * Switches a column family to the bulk load settings: auto compactions
+	 * disabled and the L0 compaction and write stall triggers raised out of
+	 * reach. The settings they replace are kept for `finishBulkLoad()`.
+	 */
+	rocksdb::Status beginBulkLoad(rocksdb::ColumnFamilyHandle* column);
+
+	/**
+	 * Compacts the entire column family using `parallelismThreads`
+	 * subcompactions, then restores the settings `beginBulkLoad()` replaced.
+	 * Does nothing when the column family is not in a bulk load.
+	 */
+	rocksdb::Status finishBulkLoad(rocksdb::ColumnFamilyHandle* column);
 };
 
 /**
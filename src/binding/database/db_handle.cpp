@@ -1,3 +1,5 @@
+#include <cstdlib>
+#include <map>
 #include "transaction_log/transaction_log_store.h"
 #include "database/db_handle.h"
 #include "database/db_descriptor.h"
@@ -5,6 +7,7 @@
 #include "database/db_settings.h"
 #include "transaction_log/transaction_log_store_registry.h"
 #include "core/verification_table.h"
+#include "rocksdb/cache.h"
 
 namespace rocksdb_js {
 
@@ -13,6 +16,20 @@ namespace {
 // Commit-pipeline queue-depth gauges (see docs/stats.md).
 constexpr const char* COMMIT_PIPELINE_LOG_QUEUE_DEPTH_KEY = "commitPipeline.logQueueDepth";
 constexpr const char* COMMIT_PIPELINE_COMMIT_QUEUE_DEPTH_KEY = "commitPipeline.commitQueueDepth";
+constexpr const char* COMMIT_PIPELINE_COMMIT_LANE_KEY = "commitPipeline.commitLane";
+
+// Commit-pipeline mode counters and stage timings (see CommitModeTracker).
+struct CommitModeStat {
+	const char* key;
+	std::atomic<uint64_t> CommitModeTracker::* field;
+};
+constexpr CommitModeStat COMMIT_MODE_STATS[] = {
+	{ "commitPipeline.commitStageNs", &CommitModeTracker::commitStageNs },
+	{ "commitPipeline.logStageNs", &CommitModeTracker::logStageNs },
+	{ "commitPipeline.modeSwitches", &CommitModeTracker::modeSwitches },
+	{ "commitPipeline.singleLaneCommits", &CommitModeTracker::singleLaneCommits },
+	{ "commitPipeline.twoLaneCommits", &CommitModeTracker::twoLaneCommits },
+};
 
 bool lookupTxnlogSummaryStat(
 	const std::string& statName,
@@ -34,6 +51,86 @@ bool lookupTxnlogSummaryStat(
 	return false;
 }
 
+void setVerificationTableStatsOnObject(napi_env env, napi_value result) {
+	VerificationTableStats stats = VerificationTable::collectStats(
+		DBSettings::getInstance().getVerificationTableRaw()
+	);
+#define X(key, field) \
+	do { \
+		napi_value _vtValue; \
+		if (::napi_create_double(env, stats.field, &_vtValue) == napi_ok) { \
+			::napi_set_named_property(env, result, key, _vtValue); \
+		} \
+	} while (0);
+	VERIFICATION_TABLE_STATS(X)
+#undef X
+}
+
+/**
+ * The `blockCache.*` statistics, the bytes each kind of block holds in the
+ * block cache, as an X-macro — `X(jsKey, rocksdb::CacheEntryRole)`.
+ */
+#define BLOCK_CACHE_ENTRY_STATS(X) \
+	X("blockCache.dataBlockBytes", kDataBlock) \
+	X("blockCache.filterBlockBytes", kFilterBlock) \
+	X("blockCache.filterMetaBlockBytes", kFilterMetaBlock) \
+	X("blockCache.indexBlockBytes", kIndexBlock)
+
+/**
+ * Reads the block cache entry stats of a column family's block cache. RocksDB
+ * collects them by scanning the cache, reusing the last scan when it is
+ * recent, so they can briefly lag behind. Returns false when the column
+ * family has no block cache.
+ */
+bool getBlockCacheEntryStats(
+	rocksdb::DB* db,
+	rocksdb::ColumnFamilyHandle* column,
+	std::map<std::string, std::string>& stats
+) {
+	return db->GetMapProperty(column, rocksdb::DB::Properties::kBlockCacheEntryStats, &stats);
+}
+
+double getBlockCacheUsedBytes(const std::map<std::string, std::string>& stats, rocksdb::CacheEntryRole role) {
+	auto it = stats.find(rocksdb::BlockCacheEntryStatsMapKeys::UsedBytes(role));
+	return it == stats.end() ? 0 : std::strtod(it->second.c_str(), nullptr);
+}
+
+void setBlockCacheEntryStatsOnObject(napi_env env, napi_value result, rocksdb::DB* db, rocksdb::ColumnFamilyHandle* column) {
+	std::map<std::string, std::string> stats;
+	if (!getBlockCacheEntryStats(db, column, stats)) {
+		return;
+	}
+#define X(key, role) \
+	do { \
+		napi_value _blockCacheValue; \
+		if (::napi_create_double(env, getBlockCacheUsedBytes(stats, rocksdb::CacheEntryRole::role), &_blockCacheValue) == napi_ok) { \
+			::napi_set_named_property(env, result, key, _blockCacheValue); \
+		} \
+	} while (0);
+	BLOCK_CACHE_ENTRY_STATS(X)
+#undef X
+}
+
+void setTombstoneCompactionStatsOnObject(
+	napi_env env,
+	napi_value result,
+	const std::shared_ptr<TombstoneCompactor>& compactor
+) {
+	if (!compactor) {
+		return;
+	}
+	TombstoneCompactionStats stats = compactor->getStats();
+#define X(key, field) \
+	do { \
+		napi_value _tombstoneValue; \
+		if (::napi_create_double(env, stats.field, &_tombstoneValue) == napi_ok) { \
+			::napi_set_named_property(env, result, key, _tombstoneValue); \
+		} \
+	} while (0);
+	TOMBSTONE_COMPACTION_STATS(X)
+#undef X
+}
+
 void addTxnlogStoreStats(TransactionLogStoreStats& total, const TransactionLogStoreStats& s) {
 #define X(key, field) total.field += s.field;
 	TRANSACTION_LOG_SUMMARY_STATS(X)
@@ -105,23 +202,152 @@ rocksdb::Status DBHandle::clear() {
 	rocksdb::Status clearStatus = rocksdb::DeleteFilesInRange(
 		this->descriptor->db.get(), this->columnDescriptor->column.get(), nullptr, nullptr
 	);
-	// After data is deleted, advance all non-lock VT slots to fresh
+	// After data is deleted, advance this store's non-lock VT slots to fresh
 	// settled-empty generations. This prevents stale pre-clear versions from
-	// being re-published via a concurrent populate CAS. The sweep is coarse
-	// (covers all slots in the process-global table) since slot provenance is
-	// not tracked for non-lock slots; the cost is spurious cache misses for
-	// other stores, which is acceptable given clear() is already a rare,
-	// expensive operation. Lock slots are skipped — the write-intent lifecycle
-	// handles them independently. We sweep regardless of clearStatus: if the
-	// delete partially succeeded, any keys that were removed must not remain
-	// cacheable via stale VT entries.
+	// being re-published via a concurrent populate CAS. Only the store's
+	// partition is swept (slots are tagged with the partition that populated
+	// them), so other stores keep their cached versions. Lock slots are skipped
+	// — the write-intent lifecycle handles them independently. We sweep
+	// regardless of clearStatus: if the delete partially succeeded, any keys
+	// that were removed must not remain cacheable via stale VT entries.
 	if (this->enableVerificationTable) {
 		VerificationTable* vt = DBSettings::getInstance().getVerificationTableRaw();
-		if (vt) vt->settleAllSlots();
+		if (vt) {
+			vt->settlePartition(VerificationTable::partitionFor(
+				this->descriptor->vtEpoch, this->getColumnFamilyHandle()->GetID()
+			));
+		}
 	}
 	return clearStatus;
 }
 
+rocksdb::Status DBHandle::ingest(const std::vector<std::string>& files, bool moveFiles) {
+	if (!this->opened() || this->isCancelled()) {
+		return rocksdb::Status::Aborted("Database closed during ingest operation");
+	}
+
+	rocksdb::IngestExternalFileOptions options;
+	// hard link the files into the database instead of copying them; falls
+	// back to a copy across filesystems
+	options.move_files = moveFiles;
+	rocksdb::Status status = this->descriptor->db->IngestExternalFile(
+		this->columnDescriptor->column.get(), files, options
+	);
+
+	// The ingested files shadow every key they contain, so a version cached
+	// before the ingest must not verify afterwards. The files' keys are not
+	// enumerated, so the whole partition is settled, as clear() does. Only on
+	// success: a failed ingest leaves the column family untouched.
+	if (status.ok() && this->enableVerificationTable) {
+		VerificationTable* vt = DBSettings::getInstance().getVerificationTableRaw();
+		if (vt) {
+			vt->settlePartition(VerificationTable::partitionFor(
+				this->descriptor->vtEpoch, this->getColumnFamilyHandle()->GetID()
+			));
+		}
+	}
+	return status;
+}
+
+rocksdb::Status DBHandle::finishBulkLoad() {
+	if (!this->opened() || this->isCancelled()) {
+		return rocksdb::Status::Aborted("Database closed during finish bulk load operation");
+	}
+
+	// nothing to finish unless this handle was opened with `bulkLoad`
+	if (!this->bulkLoad.exchange(false)) {
+		return rocksdb::Status::OK();
+	}
+
+	rocksdb::Status status = this->descriptor->finishBulkLoad(this->getColumnFamilyHandle());
+	// the compaction flushed everything written without the WAL
+	this->disableWAL = this->disableWALOption;
+	return status;
+}
+
+rocksdb::Status DBHandle::removeRange(const rocksdb::Slice& start, const rocksdb::Slice& end, bool compact) {
+	if (!this->opened() || this->isCancelled()) {
+		return rocksdb::Status::Aborted("Database closed during remove range operation");
+	}
+
+	auto column = this->columnDescriptor->column.get();
+	rocksdb::WriteOptions writeOptions;
+	writeOptions.disableWAL = this->disableWAL;
+	rocksdb::Status status;
+	if (this->descriptor->mode == DBMode::Pessimistic) {
+		// TransactionDB rejects DeleteRange(), and its Write() rejects a batch
+		// holding a range deletion since it cannot lock a range. Skipping
+		// concurrency control writes the batch straight to the database; the
+		// range is not locked, as it is not conflict checked in optimistic mode.
+		rocksdb::WriteBatch batch;
+		status = batch.DeleteRange(column, start, end);
+		if (status.ok()) {
+			rocksdb::TransactionDBWriteOptimizations optimizations;
+			optimizations.skip_concurrency_control = true;
+			status = static_cast<rocksdb::TransactionDB*>(this->descriptor->db.get())->Write(writeOptions, optimizations, &batch);
+		}
+	} else {
+		status = this->descriptor->db->DeleteRange(writeOptions, column, start, end);
+	}
+	if (!status.ok()) {
+		return status;
+	}
+
+	// The removed keys are not enumerated, so, as clear() does, the whole
+	// partition is settled rather than the slots of the keys in the range.
+	if (this->enableVerificationTable) {
+		VerificationTable* vt = DBSettings::getInstance().getVerificationTableRaw();
+		if (vt) {
+			vt->settlePartition(VerificationTable::partitionFor(
+				this->descriptor->vtEpoch, this->getColumnFamilyHandle()->GetID()
+			));
+		}
+	}
+
+	if (compact) {
+		// A compaction keeps the keys a snapshot still needs, where
+		// DeleteFilesInRange() would drop them from under open transactions
+		// and iterators.
+		status = this->descriptor->compactRange(column, &start, &end);
+	}
+	return status;
+}
+
+rocksdb::Status DBHandle::encodeMergeOperand(const rocksdb::Slice& payload, std::string& operand) const {
+	if (this->mergeOperator == MergeOperatorKind::None) {
+		return rocksdb::Status::NotSupported("Database was not opened with a merge operator");
+	}
+	if (this->mergeOperator == MergeOperatorKind::Add && payload.size() != 8) {
+		return rocksdb::Status::InvalidArgument("An add operand must be an 8-byte delta");
+	}
+	operand = rocksdb_js::encodeMergeOperand(this->mergeOperator, this->mergeAppendLimit, payload);
+	return rocksdb::Status::OK();
+}
+
+rocksdb::Status DBHandle::setTtl(double ttl, std::vector<std::pair<std::string, double>>&& prefixExpiry) {
+	if (!this->opened() || this->isCancelled()) {
+		return rocksdb::Status::Aborted("Database closed during set TTL operation");
+	}
+
+	uint32_t cfId = this->getColumnFamilyHandle()->GetID();
+	if (ttl <= 0 && prefixExpiry.empty()) {
+		this->descriptor->ttlRules->set(cfId, nullptr);
+		return rocksdb::Status::OK();
+	}
+
+	auto rule = std::make_shared<TtlRule>();
+	rule->ttl = ttl;
+	rule->prefixExpiry = std::move(prefixExpiry);
+	if (this->enableVerificationTable) {
+		// materializes the table: the rule keeps the pointer, and a table
+		// created by a later read would otherwise never see the dropped keys
+		rule->vt = DBSettings::getInstance().getVerificationTable();
+		rule->vtEpoch = this->descriptor->vtEpoch;
+	}
+	this->descriptor->ttlRules->set(cfId, std::move(rule));
+	return rocksdb::Status::OK();
+}
+
 /**
  * Closes the DBHandle.
  */
@@ -171,12 +397,21 @@ napi_value DBHandle::getStat(napi_env env, const std::string& statName) {
 	if (statName.rfind("commitPipeline.", 0) == 0) {
 		napi_value jsValue;
 		if (statName == COMMIT_PIPELINE_LOG_QUEUE_DEPTH_KEY) {
-			NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(this->descriptor->logWorker.depth()), &jsValue));
+			NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(this->descriptor->logQueueDepth()), &jsValue));
 		} else if (statName == COMMIT_PIPELINE_COMMIT_QUEUE_DEPTH_KEY) {
-			NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(this->descriptor->commitWorker.depth()), &jsValue));
+			NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(this->descriptor->commitQueueDepth()), &jsValue));
+		} else if (statName == COMMIT_PIPELINE_COMMIT_LANE_KEY) {
+			NAPI_STATUS_THROWS(::napi_create_int32(env, this->descriptor->commitLaneIndex, &jsValue));
 		} else {
 			// unknown commitPipeline.* key: never a RocksDB ticker/property
 			NAPI_STATUS_THROWS(::napi_get_undefined(env, &jsValue));
+			for (const auto& stat : COMMIT_MODE_STATS) {
+				if (statName == stat.key) {
+					uint64_t value = (this->descriptor->commitMode.*stat.field).load(std::memory_order_relaxed);
+					NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(value), &jsValue));
+					break;
+				}
+			}
 		}
 		return jsValue;
 	}
@@ -201,6 +436,55 @@ napi_value DBHandle::getStat(napi_env env, const std::string& statName) {
 		return jsValue;
 	}
 
+	// verification table counters and occupancy estimates (process-global)
+	if (statName.rfind("verificationTable.", 0) == 0) {
+		VerificationTableStats stats = VerificationTable::collectStats(
+			DBSettings::getInstance().getVerificationTableRaw()
+		);
+		napi_value jsValue;
+		NAPI_STATUS_THROWS(::napi_get_undefined(env, &jsValue));
+#define X(key, field) \
+		if (statName == key) { \
+			NAPI_STATUS_THROWS(::napi_create_double(env, stats.field, &jsValue)); \
+		}
+		VERIFICATION_TABLE_STATS(X)
+#undef X
+		return jsValue;
+	}
+
+	// tombstone compaction counters; undefined unless `tombstoneCompaction` is set
+	if (statName.rfind("tombstoneCompaction.", 0) == 0) {
+		auto& compactor = this->descriptor->tombstoneCompactor;
+		napi_value jsValue;
+		NAPI_STATUS_THROWS(::napi_get_undefined(env, &jsValue));
+		if (compactor) {
+			TombstoneCompactionStats stats = compactor->getStats();
+#define X(key, field) \
+			if (statName == key) { \
+				NAPI_STATUS_THROWS(::napi_create_double(env, stats.field, &jsValue)); \
+			}
+			TOMBSTONE_COMPACTION_STATS(X)
+#undef X
+		}
+		return jsValue;
+	}
+
+	// bytes per kind of block in the block cache; undefined without one
+	if (statName.rfind("blockCache.", 0) == 0) {
+		std::map<std::string, std::string> stats;
+		napi_value jsValue;
+		NAPI_STATUS_THROWS(::napi_get_undefined(env, &jsValue));
+		if (getBlockCacheEntryStats(this->descriptor->db.get(), this->getColumnFamilyHandle(), stats)) {
+#define X(key, role) \
+			if (statName == key) { \
+				NAPI_STATUS_THROWS(::napi_create_double(env, getBlockCacheUsedBytes(stats, rocksdb::CacheEntryRole::role), &jsValue)); \
+			}
+			BLOCK_CACHE_ENTRY_STATS(X)
+#undef X
+		}
+		return jsValue;
+	}
+
 	// check if this is an internal stat first?
 	uint64_t value = 0;
 	bool success = this->descriptor->db->GetIntProperty(this->getColumnFamilyHandle(), statName, &value);
@@ -230,6 +514,18 @@ napi_value DBHandle::getStat(napi_env env, const std::string& statName) {
 		} \
 	} while (0)
 
+// Like SET_INTERNAL_STAT, but leaves the key out when the property does not
+// apply to the column family.
+#define SET_OPTIONAL_INTERNAL_STAT(result, name) \
+	do { \
+		uint64_t value = 0; \
+		napi_value jsValue; \
+		if (this->descriptor->db->GetIntProperty(this->getColumnFamilyHandle(), name, &value) && \
+			::napi_create_int64(env, value, &jsValue) == napi_ok) { \
+			::napi_set_named_property(env, result, name, jsValue); \
+		} \
+	} while (0)
+
 napi_value DBHandle::getStats(napi_env env, bool all) {
 	napi_value result;
 	NAPI_STATUS_THROWS(::napi_create_object(env, &result));
@@ -264,6 +560,9 @@ napi_value DBHandle::getStats(napi_env env, bool all) {
 	SET_INTERNAL_STAT(result, "rocksdb.block-cache-capacity");
 	SET_INTERNAL_STAT(result, "rocksdb.block-cache-usage");
 	SET_INTERNAL_STAT(result, "rocksdb.block-cache-pinned-usage");
+	setBlockCacheEntryStatsOnObject(env, result, this->descriptor->db.get(), this->getColumnFamilyHandle());
+	// index and filter blocks held by table readers, outside the block cache
+	SET_INTERNAL_STAT(result, "rocksdb.estimate-table-readers-mem");
 
 	// snapshots
 	SET_INTERNAL_STAT(result, "rocksdb.num-live-versions");
@@ -274,6 +573,12 @@ napi_value DBHandle::getStats(napi_env env, bool all) {
 	SET_INTERNAL_STAT(result, "rocksdb.num-blob-files");
 	SET_INTERNAL_STAT(result, "rocksdb.total-blob-file-size");
 	SET_INTERNAL_STAT(result, "rocksdb.live-blob-file-size");
+	SET_INTERNAL_STAT(result, "rocksdb.live-blob-file-garbage-size");
+
+	// blob cache, absent unless the column family has one
+	SET_OPTIONAL_INTERNAL_STAT(result, "rocksdb.blob-cache-capacity");
+	SET_OPTIONAL_INTERNAL_STAT(result, "rocksdb.blob-cache-usage");
+	SET_OPTIONAL_INTERNAL_STAT(result, "rocksdb.blob-cache-pinned-usage");
 
 	// transaction log summary, aggregated across all of this database's logs.
 	// This is independent of the RocksDB statistics gate above, so it appears
@@ -287,17 +592,33 @@ napi_value DBHandle::getStats(napi_env env, bool all) {
 		setTxnlogSummaryStatsOnObject(env, result, total, logCount);
 	}
 
-	// commit-pipeline queue depths
+	// commit-pipeline queue depths, lane and mode counters
 	{
 		napi_value jsValue;
-		if (::napi_create_double(env, static_cast<double>(this->descriptor->logWorker.depth()), &jsValue) == napi_ok) {
+		if (::napi_create_double(env, static_cast<double>(this->descriptor->logQueueDepth()), &jsValue) == napi_ok) {
 			::napi_set_named_property(env, result, COMMIT_PIPELINE_LOG_QUEUE_DEPTH_KEY, jsValue);
 		}
-		if (::napi_create_double(env, static_cast<double>(this->descriptor->commitWorker.depth()), &jsValue) == napi_ok) {
+		if (::napi_create_double(env, static_cast<double>(this->descriptor->commitQueueDepth()), &jsValue) == napi_ok) {
 			::napi_set_named_property(env, result, COMMIT_PIPELINE_COMMIT_QUEUE_DEPTH_KEY, jsValue);
 		}
+		if (::napi_create_int32(env, this->descriptor->commitLaneIndex, &jsValue) == napi_ok) {
+			::napi_set_named_property(env, result, COMMIT_PIPELINE_COMMIT_LANE_KEY, jsValue);
+		}
+		for (const auto& stat : COMMIT_MODE_STATS) {
+			uint64_t value = (this->descriptor->commitMode.*stat.field).load(std::memory_order_relaxed);
+			if (::napi_create_double(env, static_cast<double>(value), &jsValue) == napi_ok) {
+				::napi_set_named_property(env, result, stat.key, jsValue);
+			}
+		}
 	}
 
+	// verification table counters and occupancy estimates; the table is shared
+	// by every database in the process, so these are process-wide
+	setVerificationTableStatsOnObject(env, result);
+
+	// tombstone compaction counters, only when `tombstoneCompaction` is set
+	setTombstoneCompactionStatsOnObject(env, result, this->descriptor->tombstoneCompactor);
+
 	return result;
 }
 
@@ -332,8 +653,32 @@ void DBHandle::open(const std::string& path, const DBOptions& options) {
 	auto handleParams = DBRegistry::OpenDB(path, options);
 	this->columnDescriptor = std::move(handleParams->columnDescriptor);
 	this->descriptor = std::move(handleParams->descriptor);
-	this->disableWAL = options.disableWAL;
+	this->disableWALOption = options.disableWAL;
+	this->disableWAL = options.disableWAL || (options.bulkLoad && !options.readOnly);
 	this->enableVerificationTable = options.verificationTable;
+	this->mergeOperator = options.mergeOperator;
+	this->mergeAppendLimit = options.mergeAppendLimit;
+
+	if (options.bulkLoad && !options.readOnly) {
+		rocksdb::Status status = this->descriptor->beginBulkLoad(this->getColumnFamilyHandle());
+		if (!status.ok()) {
+			// OpenDB() already registered the descriptor, so after letting go of
+			// it, purge the registry entry or the RocksDB instance stays open
+			std::string descriptorPath = this->descriptor->path;
+			bool readOnly = this->descriptor->readOnly;
+			this->columnDescriptor.reset();
+			this->descriptor.reset();
+			DBRegistry::PurgeIfUnreferenced(descriptorPath, readOnly);
+			throw rocksdb_js::DBException("Failed to enable bulk load: " + status.ToString());
+		}
+		this->bulkLoad = true;
+	}
+
+	// the profiler is shared by every column family of the database, so the
+	// largest size any of them asked for wins
+	if (options.conflictStatsSize > this->descriptor->conflictProfiler.getCapacity()) {
+		this->descriptor->conflictProfiler.setCapacity(options.conflictStatsSize);
+	}
 
 	// Note: We cannot attach this handle to the descriptor because we don't
 	// have the smart pointer to the dbHandle instance, so the caller needs to
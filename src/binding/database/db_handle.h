@@ -45,9 +45,21 @@ struct DBHandle final : Closable, AsyncWorkHandle, public std::enable_shared_fro
 	std::string path;
 
 	/**
-	 * Whether to disable WAL.
+	 * Whether to disable WAL. Atomic since `finishBulkLoad()` turns the WAL
+	 * back on while transactions may be reading it on worker threads.
 	 */
-	bool disableWAL = false;
+	std::atomic<bool> disableWAL{false};
+
+	/**
+	 * Whether the handle was opened with `bulkLoad` and the bulk load has not
+	 * been finished yet.
+	 */
+	std::atomic<bool> bulkLoad{false};
+
+	/**
+	 * The `disableWAL` open option, restored when the bulk load finishes.
+	 */
+	bool disableWALOption = false;
 
 	/**
 	 * Whether to register writes from this column family into the
@@ -60,6 +72,13 @@ struct DBHandle final : Closable, AsyncWorkHandle, public std::enable_shared_fro
 	 */
 	bool enableVerificationTable = false;
 
+	/**
+	 * The built-in merge operator `merge()` writes operands for, and the size
+	 * cap passed along with `append` operands.
+	 */
+	MergeOperatorKind mergeOperator = MergeOperatorKind::None;
+	uint32_t mergeAppendLimit = 0;
+
 	/**
 	 * The node environment.
 	 */
@@ -118,6 +137,41 @@ struct DBHandle final : Closable, AsyncWorkHandle, public std::enable_shared_fro
 	rocksdb::ColumnFamilyHandle* getColumnFamilyHandle() const;
 	std::string getColumnFamilyName() const;
 
+	/**
+	 * Ingests externally built SST files into the column family with
+	 * `IngestExternalFile`, then settles the store's verification-table
+	 * partition since the files may replace any cached key.
+	 */
+	rocksdb::Status ingest(const std::vector<std::string>& files, bool moveFiles);
+
+	/**
+	 * Removes the keys from `start` (inclusive) to `end` (exclusive) with a
+	 * single `DeleteRange` tombstone and settles the store's
+	 * verification-table partition. With `compact`, the range is then
+	 * compacted to reclaim the space.
+	 */
+	rocksdb::Status removeRange(const rocksdb::Slice& start, const rocksdb::Slice& end, bool compact);
+
+	/**
+	 * Builds the operand `Merge()` writes for `payload` with the handle's
+	 * merge operator. Fails when the handle was opened without one, or when
+	 * an `add` payload is not an 8-byte delta.
+	 */
+	rocksdb::Status encodeMergeOperand(const rocksdb::Slice& payload, std::string& operand) const;
+
+	/**
+	 * Replaces the column family's TTL rule, applied by the compactions that
+	 * start afterwards. A `ttl` of 0 without prefixes removes the rule.
+	 */
+	rocksdb::Status setTtl(double ttl, std::vector<std::pair<std::string, double>>&& prefixExpiry);
+
+	/**
+	 * Compacts the column family and reverts the bulk load settings applied
+	 * when the handle was opened with `bulkLoad`, including the WAL. Does
+	 * nothing for a handle that was not opened with `bulkLoad`.
+	 */
+	rocksdb::Status finishBulkLoad();
+
 	napi_value getStat(napi_env env, const std::string& statName);
 	napi_value getStats(napi_env env, bool all);
 
@@ -333,10 +333,17 @@ std::unique_ptr<DBHandleParams> DBRegistry::OpenDB(const std::string& path, cons
 				throw rocksdb_js::DBException("Column family \"" + name + "\" not found: cannot create column family in read-only mode");
 			}
 			DEBUG_LOG("%p DBRegistry::OpenDB Creating column family \"%s\"\n", instance.get(), name.c_str());
-			auto column = rocksdb_js::createRocksDBColumnFamily(entry.descriptor->db, name);
+			auto column = rocksdb_js::createRocksDBColumnFamily(entry.descriptor->db, name, options);
 			auto columnDescriptor = std::make_shared<ColumnFamilyDescriptor>(column);
 			columns[name] = columnDescriptor;
 			entry.descriptor->columns[name] = columnDescriptor;
+		} else if (!entry.descriptor->readOnly) {
+			// the column family was opened with the database, possibly by
+			// another handle, so apply this handle's blob file options
+			rocksdb::Status status = rocksdb_js::updateBlobOptions(entry.descriptor->db.get(), columns[name]->column.get(), options);
+			if (!status.ok()) {
+				throw rocksdb_js::DBException(status.ToString());
+			}
 		}
 	} else {
 		try {
@@ -5,6 +5,9 @@
 #include "napi/helpers.h"
 #include "napi/async.h"
 #include "rocksdb/advanced_cache.h"
+#include "core/value_cache.h"
+#include "database/commit_executor.h"
+#include "transaction_log/transaction_log_file.h"
 
 namespace rocksdb_js {
 
@@ -30,6 +33,12 @@ DBSettings::DBSettings():
 	writeBufferManagerAllowStall(false),
 	writeBufferManager(nullptr),
 	compactOnClose(false),
+	backgroundThreadsHigh(0),
+	backgroundThreadsLow(0),
+	ioRateLimitBytesPerSec(0), // disabled by default
+	ioRateLimitAutoTune(false),
+	rateLimiter(nullptr),
+	backgroundJobListener(std::make_shared<BackgroundJobListener>()),
 	verificationTableEntries(128 * 1024), // 128K slots = 1 MB at 8 bytes per slot
 	verificationTableSeed(generateSeed()),
 	verificationTable(nullptr)
@@ -96,6 +105,36 @@ std::shared_ptr<rocksdb::WriteBufferManager> DBSettings::getWriteBufferManager()
 	return writeBufferManager;
 }
 
+/**
+ * Get the rate limiter shared by every database, lazily creating it on first
+ * request.
+ *
+ * Like the WriteBufferManager, it is never recreated: each open database holds
+ * a reference to it. Rate changes go through `SetBytesPerSecond()`.
+ *
+ * @returns The rate limiter, or `nullptr` if disabled (rate == 0).
+ */
+std::shared_ptr<rocksdb::RateLimiter> DBSettings::getRateLimiter() {
+	if (ioRateLimitBytesPerSec.load(std::memory_order_relaxed) == 0) {
+		return nullptr;
+	}
+	std::lock_guard<std::mutex> lock(rateLimiterMutex);
+	const int64_t rate = ioRateLimitBytesPerSec.load(std::memory_order_relaxed);
+	if (rate == 0) {
+		return nullptr;
+	}
+	if (!rateLimiter) {
+		rateLimiter.reset(rocksdb::NewGenericRateLimiter(
+			rate,
+			100 * 1000, // refill period, in microseconds (RocksDB default)
+			10, // fairness (RocksDB default)
+			rocksdb::RateLimiter::Mode::kWritesOnly,
+			ioRateLimitAutoTune.load(std::memory_order_relaxed)
+		));
+	}
+	return rateLimiter;
+}
+
 /**
  * Get the global verification table instance, materializing it on first call.
  * After the first call, the table is fixed in size for the process lifetime.
@@ -106,6 +145,8 @@ VerificationTable* DBSettings::getVerificationTable() {
 		verificationTable = std::make_unique<VerificationTable>(
 			verificationTableEntries, verificationTableSeed
 		);
+		// Feeds the occupancy and collision estimates in `getStats()`.
+		verificationTable->startSampler();
 	}
 	return verificationTable.get();
 }
@@ -213,6 +254,96 @@ napi_value DBSettings::Config(napi_env env, napi_callback_info info) {
 
 	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, params, "compactOnClose", settings.compactOnClose, false));
 
+	// the default Env's pools are process-wide; resizing one takes effect
+	// right away for every open database
+	bool hasBackgroundThreads = false;
+	NAPI_STATUS_THROWS(::napi_has_named_property(env, params, "backgroundThreads", &hasBackgroundThreads));
+	if (hasBackgroundThreads) {
+		napi_value backgroundThreads;
+		NAPI_STATUS_THROWS(::napi_get_named_property(env, params, "backgroundThreads", &backgroundThreads));
+		int32_t high = 0;
+		int32_t low = 0;
+		const bool highProvided = rocksdb_js::getProperty(env, backgroundThreads, "high", high, true) == napi_ok;
+		const bool lowProvided = rocksdb_js::getProperty(env, backgroundThreads, "low", low, true) == napi_ok;
+		if ((highProvided && (high < 0 || high > BACKGROUND_THREADS_MAX)) ||
+			(lowProvided && (low < 0 || low > BACKGROUND_THREADS_MAX))) {
+			::napi_throw_range_error(env, nullptr, "Background threads must be an integer between 0 and 1024");
+			return nullptr;
+		}
+		rocksdb::Env* defaultEnv = rocksdb::Env::Default();
+		if (highProvided) {
+			settings.backgroundThreadsHigh.store(high, std::memory_order_relaxed);
+			if (high > 0) {
+				defaultEnv->SetBackgroundThreads(high, rocksdb::Env::Priority::HIGH);
+			}
+		}
+		if (lowProvided) {
+			settings.backgroundThreadsLow.store(low, std::memory_order_relaxed);
+			if (low > 0) {
+				defaultEnv->SetBackgroundThreads(low, rocksdb::Env::Priority::LOW);
+			}
+		}
+	}
+
+	int64_t ioRateLimitBytesPerSec = 0;
+	const bool rateProvided =
+		rocksdb_js::getProperty(env, params, "ioRateLimitBytesPerSec", ioRateLimitBytesPerSec, true) == napi_ok;
+	if (rateProvided && ioRateLimitBytesPerSec < 0) {
+		::napi_throw_range_error(env, nullptr, "IO rate limit must be a positive integer or 0 to disable");
+		return nullptr;
+	}
+	bool newAutoTune = settings.ioRateLimitAutoTune.load(std::memory_order_relaxed);
+	const bool autoTuneProvided = rocksdb_js::getProperty(env, params, "autoTune", newAutoTune, true) == napi_ok;
+	{
+		std::lock_guard<std::mutex> lock(settings.rateLimiterMutex);
+		if (settings.rateLimiter && autoTuneProvided &&
+			newAutoTune != settings.ioRateLimitAutoTune.load(std::memory_order_relaxed)) {
+			::napi_throw_error(env, nullptr,
+				"autoTune cannot be changed after the rate limiter has been created; set it on the first config() call that sets ioRateLimitBytesPerSec");
+			return nullptr;
+		}
+		settings.ioRateLimitAutoTune.store(newAutoTune, std::memory_order_relaxed);
+		if (rateProvided) {
+			settings.ioRateLimitBytesPerSec.store(ioRateLimitBytesPerSec, std::memory_order_relaxed);
+			// as with the WriteBufferManager, 0 stops attaching the rate
+			// limiter to new databases but leaves open ones limited
+			if (ioRateLimitBytesPerSec > 0 && settings.rateLimiter) {
+				settings.rateLimiter->SetBytesPerSecond(ioRateLimitBytesPerSec);
+			}
+		}
+	}
+
+	int64_t commitLanes = 0;
+	if (rocksdb_js::getProperty(env, params, "commitLanes", commitLanes, true) == napi_ok) {
+		if (commitLanes < 0 || commitLanes > COMMIT_EXECUTOR_MAX_LANES) {
+			::napi_throw_range_error(env, nullptr, "Commit lanes must be an integer between 0 and 256");
+			return nullptr;
+		}
+		// only databases opened after this call pick up the new lane count
+		CommitExecutor::getInstance().setLaneCount(static_cast<uint32_t>(commitLanes));
+	}
+
+	// transaction log memory map hints are process-global flags read by
+	// TransactionLogFile whenever a map is created or a scan is advised
+	bool transactionLogReadAhead = TransactionLogFile::readAheadEnabled.load(std::memory_order_relaxed);
+	if (rocksdb_js::getProperty(env, params, "transactionLogReadAhead", transactionLogReadAhead, true) == napi_ok) {
+		TransactionLogFile::readAheadEnabled.store(transactionLogReadAhead, std::memory_order_relaxed);
+	}
+	bool transactionLogHugePages = TransactionLogFile::hugePagesEnabled.load(std::memory_order_relaxed);
+	if (rocksdb_js::getProperty(env, params, "transactionLogHugePages", transactionLogHugePages, true) == napi_ok) {
+		TransactionLogFile::hugePagesEnabled.store(transactionLogHugePages, std::memory_order_relaxed);
+	}
+
+	int64_t valueCacheSize = 0;
+	if (rocksdb_js::getProperty(env, params, "valueCacheSize", valueCacheSize, true) == napi_ok) {
+		if (valueCacheSize < 0) {
+			::napi_throw_range_error(env, nullptr, "Value cache size must be a positive integer or 0 to disable caching");
+			return nullptr;
+		}
+		// resizes (and, at 0, empties) the live cache in place
+		ValueCache::getInstance().setCapacity(static_cast<size_t>(valueCacheSize));
+	}
+
 	int64_t verificationTableEntries = 0;
 	status = rocksdb_js::getProperty(env, params, "verificationTableEntries", verificationTableEntries, true);
 	if (status == napi_ok) {
@@ -233,7 +364,67 @@ napi_value DBSettings::Config(napi_env env, napi_callback_info info) {
 }
 
 /**
- * Exports the `config()` function to JavaScript.
+ * The `backgroundStats()` JavaScript function. Returns the size, queue length
+ * and completed jobs of the high (flush) and low (compaction) priority thread
+ * pools, and the bytes and requests the rate limiter let through at each
+ * priority.
+ *
+ * @example
+ * ```js
+ * const { high, low, ioRateLimitBytesPerSec } = rocksdb.backgroundStats();
+ * ```
+ */
+napi_value DBSettings::GetBackgroundStats(napi_env env, napi_callback_info info) {
+	DBSettings& settings = DBSettings::getInstance();
+	rocksdb::Env* defaultEnv = rocksdb::Env::Default();
+	std::shared_ptr<rocksdb::RateLimiter> rateLimiter;
+	{
+		std::lock_guard<std::mutex> lock(settings.rateLimiterMutex);
+		rateLimiter = settings.rateLimiter;
+	}
+
+	napi_value result;
+	NAPI_STATUS_THROWS(::napi_create_object(env, &result));
+
+#define SET_BACKGROUND_STAT(obj, name, value) \
+	do { \
+		napi_value _statValue; \
+		NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(value), &_statValue)); \
+		NAPI_STATUS_THROWS(::napi_set_named_property(env, obj, name, _statValue)); \
+	} while (0)
+
+	struct Pool {
+		const char* name;
+		rocksdb::Env::Priority priority;
+		rocksdb::Env::IOPriority ioPriority;
+		BackgroundJobStats jobs;
+	};
+	const Pool pools[] = {
+		{ "high", rocksdb::Env::Priority::HIGH, rocksdb::Env::IO_HIGH, settings.backgroundJobListener->getFlushStats() },
+		{ "low", rocksdb::Env::Priority::LOW, rocksdb::Env::IO_LOW, settings.backgroundJobListener->getCompactionStats() },
+	};
+	for (const auto& pool : pools) {
+		napi_value poolObj;
+		NAPI_STATUS_THROWS(::napi_create_object(env, &poolObj));
+		SET_BACKGROUND_STAT(poolObj, "threads", defaultEnv->GetBackgroundThreads(pool.priority));
+		SET_BACKGROUND_STAT(poolObj, "queued", defaultEnv->GetThreadPoolQueueLen(pool.priority));
+		SET_BACKGROUND_STAT(poolObj, "completed", pool.jobs.completed);
+		SET_BACKGROUND_STAT(poolObj, "busyMs", pool.jobs.busyMs);
+		SET_BACKGROUND_STAT(poolObj, "rateLimitedBytes", rateLimiter ? rateLimiter->GetTotalBytesThrough(pool.ioPriority) : 0);
+		SET_BACKGROUND_STAT(poolObj, "rateLimitedRequests", rateLimiter ? rateLimiter->GetTotalRequests(pool.ioPriority) : 0);
+		NAPI_STATUS_THROWS(::napi_set_named_property(env, result, pool.name, poolObj));
+	}
+
+	// the live rate differs from the configured one while auto-tuned
+	const int64_t configuredRate = settings.ioRateLimitBytesPerSec.load(std::memory_order_relaxed);
+	SET_BACKGROUND_STAT(result, "ioRateLimitBytesPerSec", rateLimiter && configuredRate > 0 ? rateLimiter->GetBytesPerSecond() : configuredRate);
+#undef SET_BACKGROUND_STAT
+
+	return result;
+}
+
+/**
+ * Exports the `config()` and `backgroundStats()` functions to JavaScript.
  *
  * @param env The Node.js environment.
  * @param exports The exports object.
@@ -250,6 +441,18 @@ void DBSettings::Init(napi_env env, napi_value exports) {
 	));
 
 	NAPI_STATUS_THROWS_VOID(::napi_set_named_property(env, exports, "config", configFn));
+
+	napi_value backgroundStatsFn;
+	NAPI_STATUS_THROWS_VOID(::napi_create_function(
+		env,
+		"backgroundStats",
+		NAPI_AUTO_LENGTH,
+		DBSettings::GetBackgroundStats,
+		nullptr,
+		&backgroundStatsFn
+	));
+
+	NAPI_STATUS_THROWS_VOID(::napi_set_named_property(env, exports, "backgroundStats", backgroundStatsFn));
 }
 
 }
@@ -5,11 +5,19 @@
 #include <mutex>
 #include <node_api.h>
 #include "rocksdb/cache.h"
+#include "rocksdb/env.h"
+#include "rocksdb/rate_limiter.h"
 #include "rocksdb/write_buffer_manager.h"
+#include "core/background_jobs.h"
 #include "core/verification_table.h"
 
 namespace rocksdb_js {
 
+/**
+ * The largest `config({ backgroundThreads })` pool size.
+ */
+constexpr int32_t BACKGROUND_THREADS_MAX = 1024;
+
 /**
  * Stores the global settings for RocksDB databases as well as various global
  * state.
@@ -50,6 +58,26 @@ private:
 
 	bool compactOnClose;
 
+	// Sizes of the default Env's high (flush) and low (compaction) priority
+	// thread pools, shared by every database in the process. 0 leaves a pool
+	// to the `parallelismThreads` of each database opened, which resizes it.
+	std::atomic<int> backgroundThreadsHigh;
+	std::atomic<int> backgroundThreadsLow;
+
+	// Bytes per second the flushes and compactions of every database share.
+	// 0 disables the rate limiter for databases opened afterwards.
+	std::atomic<int64_t> ioRateLimitBytesPerSec;
+
+	// When true, the rate limiter tunes its rate between 1/20 of
+	// `ioRateLimitBytesPerSec` and all of it, by how often requests wait.
+	// Fixed once the rate limiter is created, like `costToCache`.
+	std::atomic<bool> ioRateLimitAutoTune;
+
+	std::shared_ptr<rocksdb::RateLimiter> rateLimiter;
+	std::mutex rateLimiterMutex;
+
+	std::shared_ptr<BackgroundJobListener> backgroundJobListener;
+
 	// Number of slots requested for the verification table. Default 128K
 	// (1 MB at 8 bytes per slot). 0 disables the table. Configurable via
 	// RocksDatabase.config({ verificationTableEntries }) only before the
@@ -94,6 +122,38 @@ public:
 		return compactOnClose;
 	}
 
+	/**
+	 * Returns whether `config({ backgroundThreads })` sized a shared pool, in
+	 * which case databases only size the pools left at 0.
+	 */
+	bool hasSharedBackgroundThreads() const {
+		return backgroundThreadsHigh.load(std::memory_order_relaxed) > 0 ||
+			backgroundThreadsLow.load(std::memory_order_relaxed) > 0;
+	}
+
+	int getBackgroundThreadsHigh() const {
+		return backgroundThreadsHigh.load(std::memory_order_relaxed);
+	}
+
+	int getBackgroundThreadsLow() const {
+		return backgroundThreadsLow.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Returns the shared rate limiter, lazily creating it on first request, or
+	 * null when `ioRateLimitBytesPerSec` is 0.
+	 */
+	std::shared_ptr<rocksdb::RateLimiter> getRateLimiter();
+
+	std::shared_ptr<BackgroundJobListener> getBackgroundJobListener() const {
+		return backgroundJobListener;
+	}
+
+	/**
+	 * The `backgroundStats()` JavaScript function.
+	 */
+	static napi_value GetBackgroundStats(napi_env env, napi_callback_info info);
+
 	/**
 	 * Returns the global verification table, materializing it on first call.
 	 * After the first call, the table size is fixed for the process lifetime.
@@ -0,0 +1,284 @@
+#include <filesystem>
+#include <vector>
+#include "database/database.h"
+#include "database/db_descriptor.h"
+#include "database/db_handle.h"
+#include "database/sst_writer.h"
+#include "core/exception.h"
+#include "napi/helpers.h"
+#include "napi/macros.h"
+
+#define UNWRAP_SST_WRITER_HANDLE(fnName) \
+	SstWriterHandle* sstHandle = nullptr; \
+	do { \
+		NAPI_STATUS_THROWS(::napi_unwrap(env, jsThis, reinterpret_cast<void**>(&sstHandle))); \
+		if (!sstHandle || !sstHandle->writer) { \
+			::napi_throw_error(env, nullptr, fnName " failed: SST writer has already been finished"); \
+			return nullptr; \
+		} \
+	} while (0)
+
+namespace rocksdb_js {
+
+/**
+ * The sorter's default memory budget before it spills a run to disk.
+ */
+static constexpr size_t DEFAULT_SORT_MEMORY = 64 * 1024 * 1024;
+
+SstWriterHandle::SstWriterHandle(
+	const std::shared_ptr<DBHandle>& dbHandle,
+	std::string path,
+	bool sort,
+	size_t sortMemory
+) : path(std::move(path)) {
+	auto column = dbHandle->getColumnFamilyHandle();
+	// build the file with the column family's options (comparator,
+	// compression, table format) so it can be ingested as is
+	rocksdb::Options options = dbHandle->descriptor->db->GetOptions(column);
+	this->writer = std::make_unique<rocksdb::SstFileWriter>(rocksdb::EnvOptions(options), options, column);
+	if (sort) {
+		this->sorter = std::make_unique<ExternalSorter>(this->path + ".sort", sortMemory);
+	}
+}
+
+SstWriterHandle::~SstWriterHandle() {
+	if (this->writer) {
+		this->abort();
+	}
+}
+
+rocksdb::Status SstWriterHandle::open() {
+	return this->writer->Open(this->path);
+}
+
+rocksdb::Status SstWriterHandle::put(const rocksdb::Slice& key, const rocksdb::Slice& value) {
+	if (!this->sorter) {
+		return this->writer->Put(key, value);
+	}
+	try {
+		this->sorter->add(std::string_view(key.data(), key.size()), std::string_view(value.data(), value.size()));
+	} catch (const DBException& e) {
+		return rocksdb::Status::IOError(e.what());
+	}
+	return rocksdb::Status::OK();
+}
+
+rocksdb::Status SstWriterHandle::finish(rocksdb::ExternalSstFileInfo& info) {
+	if (this->sorter) {
+		rocksdb::Status status;
+		try {
+			this->sorter->finish([this, &status](std::string_view key, std::string_view value) {
+				if (status.ok()) {
+					status = this->writer->Put(
+						rocksdb::Slice(key.data(), key.size()),
+						rocksdb::Slice(value.data(), value.size())
+					);
+				}
+			});
+		} catch (const DBException& e) {
+			status = rocksdb::Status::IOError(e.what());
+		}
+		this->sorter.reset();
+		if (!status.ok()) {
+			this->abort();
+			return status;
+		}
+	}
+
+	rocksdb::Status status = this->writer->Finish(&info);
+	if (!status.ok()) {
+		this->abort();
+		return status;
+	}
+	this->writer.reset();
+	return status;
+}
+
+void SstWriterHandle::abort() {
+	this->sorter.reset();
+	this->writer.reset();
+	std::error_code ec;
+	std::filesystem::remove(this->path, ec);
+}
+
+/**
+ * Constructor for the `NativeSstWriter` class. Creates the SST file at `path`
+ * with the options of the database's column family.
+ *
+ * @example
+ * ```typescript
+ * const writer = new binding.SstWriter(db, '/tmp/bulk.sst', { sort: true, sortMemory: 256 * 1024 * 1024 });
+ * ```
+ */
+napi_value SstWriter::Constructor(napi_env env, napi_callback_info info) {
+	NAPI_CONSTRUCTOR_ARGV_WITH_DATA("SstWriter", 3);
+
+	napi_ref exportsRef = reinterpret_cast<napi_ref>(data);
+	NAPI_GET_DB_HANDLE(argv[0], exportsRef, dbHandle, "Invalid argument, expected Database instance");
+
+	if (!(*dbHandle)->opened()) {
+		::napi_throw_error(env, nullptr, "Database not open");
+		return nullptr;
+	}
+
+	NAPI_GET_STRING(argv[1], path, "SST file path is required");
+
+	bool sort = false;
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, argv[2], "sort", sort));
+	size_t sortMemory = DEFAULT_SORT_MEMORY;
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, argv[2], "sortMemory", sortMemory));
+
+	auto sstHandle = new SstWriterHandle(*dbHandle, path, sort, sortMemory);
+	rocksdb::Status status = sstHandle->open();
+	if (!status.ok()) {
+		delete sstHandle;
+		napi_value error;
+		rocksdb_js::createRocksDBError(env, status, "Failed to create SST file", error);
+		::napi_throw(env, error);
+		return nullptr;
+	}
+
+	DEBUG_LOG("SstWriter::Constructor Creating NativeSstWriter SstWriterHandle=%p path=%s\n", sstHandle, path.c_str());
+
+	NAPI_STATUS_THROWS(::napi_wrap(
+		env,
+		jsThis,
+		reinterpret_cast<void*>(sstHandle),
+		[](napi_env env, void* data, void* hint) {
+			DEBUG_LOG("SstWriter::Constructor NativeSstWriter GC'd SstWriterHandle=%p\n", data);
+			delete static_cast<SstWriterHandle*>(data);
+		},
+		nullptr, // finalize_hint
+		nullptr  // result
+	));
+
+	return jsThis;
+}
+
+/**
+ * Discards the writer and deletes the partially written file. Does nothing
+ * after `finish()`.
+ *
+ * @example
+ * ```typescript
+ * writer.abort();
+ * ```
+ */
+napi_value SstWriter::Abort(napi_env env, napi_callback_info info) {
+	NAPI_METHOD();
+	SstWriterHandle* sstHandle = nullptr;
+	NAPI_STATUS_THROWS(::napi_unwrap(env, jsThis, reinterpret_cast<void**>(&sstHandle)));
+	// a no-op once the file is finished; it belongs to the caller now
+	if (sstHandle && sstHandle->writer) {
+		sstHandle->abort();
+	}
+	NAPI_RETURN_UNDEFINED();
+}
+
+/**
+ * Writes any sorted entries and finalizes the file, returning its metadata.
+ * The file is ready to be ingested once this returns.
+ *
+ * @example
+ * ```typescript
+ * const { path, entries, fileSize, smallestKey, largestKey } = writer.finish();
+ * ```
+ */
+napi_value SstWriter::Finish(napi_env env, napi_callback_info info) {
+	NAPI_METHOD();
+	UNWRAP_SST_WRITER_HANDLE("Finish");
+
+	rocksdb::ExternalSstFileInfo fileInfo;
+	rocksdb::Status status = sstHandle->finish(fileInfo);
+	if (!status.ok()) {
+		napi_value error;
+		rocksdb_js::createRocksDBError(env, status, "SST writer finish failed", error);
+		::napi_throw(env, error);
+		return nullptr;
+	}
+
+	napi_value result;
+	napi_value value;
+	NAPI_STATUS_THROWS(::napi_create_object(env, &result));
+	NAPI_STATUS_THROWS(::napi_create_string_utf8(env, fileInfo.file_path.c_str(), fileInfo.file_path.size(), &value));
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, result, "path", value));
+	NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(fileInfo.num_entries), &value));
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, result, "entries", value));
+	NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(fileInfo.file_size), &value));
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, result, "fileSize", value));
+	NAPI_STATUS_THROWS(::napi_create_buffer_copy(env, fileInfo.smallest_key.size(), fileInfo.smallest_key.data(), nullptr, &value));
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, result, "smallestKey", value));
+	NAPI_STATUS_THROWS(::napi_create_buffer_copy(env, fileInfo.largest_key.size(), fileInfo.largest_key.data(), nullptr, &value));
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, result, "largestKey", value));
+	return result;
+}
+
+/**
+ * Adds a batch of entries packed as a uint32 big-endian key length, the key,
+ * a uint32 big-endian value length and the value, `count` times. Unless the
+ * writer sorts, keys must be strictly ascending across every batch.
+ *
+ * @example
+ * ```typescript
+ * writer.putBatch(packed, 2);
+ * ```
+ */
+napi_value SstWriter::PutBatch(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(2);
+	UNWRAP_SST_WRITER_HANDLE("Put");
+
+	char* packed = nullptr;
+	size_t packedLength = 0;
+	NAPI_STATUS_THROWS(::napi_get_buffer_info(env, argv[0], reinterpret_cast<void**>(&packed), &packedLength));
+	uint32_t count = 0;
+	NAPI_STATUS_THROWS(::napi_get_value_uint32(env, argv[1], &count));
+
+	// keys and values alternate, each with the same length prefix
+	std::vector<rocksdb::Slice> slices;
+	if (!parsePackedKeys(packed, packedLength, static_cast<size_t>(count) * 2, slices)) {
+		::napi_throw_range_error(env, nullptr, "Packed entries do not match the number of entries");
+		return nullptr;
+	}
+
+	for (size_t i = 0; i < slices.size(); i += 2) {
+		rocksdb::Status status = sstHandle->put(slices[i], slices[i + 1]);
+		if (!status.ok()) {
+			napi_value error;
+			rocksdb_js::createRocksDBError(env, status, "SST writer put failed", error);
+			::napi_throw(env, error);
+			return nullptr;
+		}
+	}
+
+	NAPI_RETURN_UNDEFINED();
+}
+
+void SstWriter::Init(napi_env env, napi_value exports) {
+	napi_property_descriptor properties[] = {
+		{ "abort", nullptr, Abort, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "finish", nullptr, Finish, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "putBatch", nullptr, PutBatch, nullptr, nullptr, nullptr, napi_default, nullptr }
+	};
+
+	auto className = "SstWriter";
+	constexpr size_t len = sizeof("SstWriter") - 1;
+
+	napi_ref exportsRef;
+	NAPI_STATUS_THROWS_VOID(::napi_create_reference(env, exports, 1, &exportsRef));
+
+	napi_value ctor;
+	NAPI_STATUS_THROWS_VOID(::napi_define_class(
+		env,
+		className,              // className
+		len,                    // length of class name
+		SstWriter::Constructor, // constructor
+		(void*)exportsRef,      // constructor arg
+		sizeof(properties) / sizeof(napi_property_descriptor), // number of properties
+		properties,             // properties array
+		&ctor                   // [out] constructor
+	));
+
+	NAPI_STATUS_THROWS_VOID(::napi_set_named_property(env, exports, className, ctor));
+}
+
+} // namespace rocksdb_js
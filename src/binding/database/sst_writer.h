@@ -0,0 +1,88 @@
+#ifndef __SST_WRITER_H__
+#define __SST_WRITER_H__
+
+#include <memory>
+#include <string>
+#include <node_api.h>
+#include "core/external_sorter.h"
+#include "rocksdb/sst_file_writer.h"
+
+namespace rocksdb_js {
+
+struct DBHandle;
+
+/**
+ * The state behind a `NativeSstWriter`: a RocksDB `SstFileWriter` opened with
+ * the options of the column family the file will be ingested into.
+ *
+ * Entries must reach the `SstFileWriter` in strictly ascending key order.
+ * When the writer is created with `sort`, they are routed through an
+ * `ExternalSorter` instead and only written, in order, by `finish()`.
+ */
+struct SstWriterHandle final {
+	SstWriterHandle(
+		const std::shared_ptr<DBHandle>& dbHandle,
+		std::string path,
+		bool sort,
+		size_t sortMemory
+	);
+	~SstWriterHandle();
+
+	/**
+	 * Opens the file. Called once, right after construction.
+	 */
+	rocksdb::Status open();
+
+	rocksdb::Status put(const rocksdb::Slice& key, const rocksdb::Slice& value);
+
+	/**
+	 * Drains the sorter (if any) and finalizes the file.
+	 */
+	rocksdb::Status finish(rocksdb::ExternalSstFileInfo& info);
+
+	/**
+	 * Discards the writer and removes the partially written file.
+	 */
+	void abort();
+
+	/**
+	 * The path of the SST file.
+	 */
+	std::string path;
+
+	/**
+	 * The writer, released once the file is finished or aborted.
+	 */
+	std::unique_ptr<rocksdb::SstFileWriter> writer;
+
+	/**
+	 * Sorts entries written to an unsorted writer.
+	 */
+	std::unique_ptr<ExternalSorter> sorter;
+};
+
+/**
+ * The `NativeSstWriter` JavaScript class implementation.
+ *
+ * @example
+ * ```js
+ * const db = new binding.NativeDatabase();
+ * db.open('/tmp/testdb');
+ * const writer = new binding.SstWriter(db, '/tmp/bulk.sst', { sort: true });
+ * writer.putBatch(packedEntries, count);
+ * writer.finish();
+ * await new Promise((resolve, reject) => db.ingest(resolve, reject, ['/tmp/bulk.sst']));
+ * ```
+ */
+struct SstWriter final {
+	static napi_value Constructor(napi_env env, napi_callback_info info);
+	static napi_value Abort(napi_env env, napi_callback_info info);
+	static napi_value Finish(napi_env env, napi_callback_info info);
+	static napi_value PutBatch(napi_env env, napi_callback_info info);
+
+	static void Init(napi_env env, napi_value exports);
+};
+
+} // namespace rocksdb_js
+
+#endif
@@ -265,6 +265,7 @@ napi_value DBIterator::Next(napi_env env, napi_callback_info info) {
 
 	auto& it = *itHandle;
 	napi_value result;
+	SkippedTombstoneCounter counter(it->skippedTombstones, it->tombstoneCompactor != nullptr);
 
 	if (!it->iterator->Valid()) {
 		if (!it->iterator->status().ok()) {
@@ -272,6 +273,9 @@ napi_value DBIterator::Next(napi_env env, napi_callback_info info) {
 		} else {
 			DEBUG_LOG("%p DBIterator::Next iterator no keys found in range\n", it.get());
 		}
+		// an exhausted iterator may not be closed until it is collected
+		counter.flush();
+		it->reportSkippedTombstones();
 		NAPI_STATUS_THROWS(::napi_create_uint32(env, ITERATOR_RESULT_DONE, &result));
 		return result;
 	}
@@ -321,22 +325,14 @@ napi_value DBIterator::Next(napi_env env, napi_callback_info info) {
 			::memcpy(valueBuffer, valueSlice.data(), valueSlice.size());
 			state[1] = static_cast<uint32_t>(valueSlice.size());
 		}
-		if (it->reverse) {
-			it->iterator->Prev();
-		} else {
-			it->iterator->Next();
-		}
+		it->advance(counter);
 		NAPI_STATUS_THROWS(::napi_create_uint32(env, ITERATOR_RESULT_FAST, &result));
 		return result;
 	}
 
 	// Slow path: at least one of key or value can't go in the shared buffer.
 	napi_value slowResult = buildSlowResult(env, keySlice, it->values, valueSlice);
-	if (it->reverse) {
-		it->iterator->Prev();
-	} else {
-		it->iterator->Next();
-	}
+	it->advance(counter);
 	return slowResult;
 }
 
@@ -17,6 +17,8 @@ DBIteratorHandle::DBIteratorHandle(
 {
 	DEBUG_LOG("%p DBIteratorHandle::Constructor dbHandle=%p\n", this, dbHandle.get());
 	this->init(options);
+	this->tombstoneCompactor = this->dbHandle->descriptor->tombstoneCompactor;
+	this->cfId = this->dbHandle->getColumnFamilyHandle()->GetID();
 
 	this->iterator = std::unique_ptr<rocksdb::Iterator>(
 		dbHandle->descriptor->db->NewIterator(
@@ -42,9 +44,11 @@ DBIteratorHandle::DBIteratorHandle(
 {
 	DEBUG_LOG("DBIteratorHandle::Constructor txnHandle=%p dbDescriptor=%p\n", txnHandle, dbHandle->descriptor.get());
 	this->init(options);
+	this->tombstoneCompactor = this->dbHandle->descriptor->tombstoneCompactor;
+	this->cfId = this->dbHandle->getColumnFamilyHandle()->GetID();
 
 	this->iterator = std::unique_ptr<rocksdb::Iterator>(
-		txnHandle->txn->GetIterator(
+		txnHandle->newIterator(
 			options.readOptions,
 			this->dbHandle->getColumnFamilyHandle()
 		)
@@ -60,6 +64,7 @@ DBIteratorHandle::~DBIteratorHandle() {
 void DBIteratorHandle::close() {
 	DEBUG_LOG("%p DBIteratorHandle::close dbHandle=%p dbDescriptor=%p\n", this, this->dbHandle.get(), this->dbHandle->descriptor.get());
 	if (this->iterator) {
+		this->reportSkippedTombstones();
 		this->iterator->Reset();
 		this->iterator.reset();
 	}
@@ -92,21 +97,87 @@ void DBIteratorHandle::init(DBIteratorOptions& options) {
 	}
 }
 
+void DBIteratorHandle::reportSkippedTombstones() {
+	if (this->tombstoneCompactor && this->skippedTombstones > 0) {
+		// tombstones skipped outside a tracked move (e.g. the reverse
+		// exclusiveStart peek) fall back to the requested bounds
+		this->tombstoneCompactor->report(
+			this->cfId,
+			this->hasSkippedRange ? this->skippedStartStr : this->startKeyStr,
+			this->hasSkippedRange ? this->skippedEndStr : this->endKeyStr,
+			this->skippedTombstones
+		);
+		this->skippedTombstones = 0;
+		this->hasSkippedRange = false;
+	}
+}
+
+void DBIteratorHandle::advance(SkippedTombstoneCounter& counter) {
+	if (!this->tombstoneCompactor) {
+		if (this->reverse) {
+			this->iterator->Prev();
+		} else {
+			this->iterator->Next();
+		}
+		return;
+	}
+
+	counter.flush();
+	uint64_t skippedBefore = this->skippedTombstones;
+	rocksdb::Slice from = this->iterator->key();
+	this->advanceFromStr.assign(from.data(), from.size());
+	if (this->reverse) {
+		this->iterator->Prev();
+	} else {
+		this->iterator->Next();
+	}
+	counter.flush();
+	this->coverSkipped(skippedBefore, &this->advanceFromStr);
+}
+
+void DBIteratorHandle::coverSkipped(uint64_t skippedBefore, const std::string* from) {
+	if (this->skippedTombstones == skippedBefore) {
+		return;
+	}
+
+	// the move went from `from` (or the bound it started at) to the current key
+	// (or the bound it ran into); in reverse those are the high and low ends
+	const std::string& nearBound = this->reverse ? this->endKeyStr : this->startKeyStr;
+	const std::string& farBound = this->reverse ? this->startKeyStr : this->endKeyStr;
+	std::string to = this->iterator->Valid() ? this->iterator->key().ToString() : farBound;
+	const std::string& fromKey = from ? *from : nearBound;
+	const std::string& low = this->reverse ? to : fromKey;
+	const std::string& high = this->reverse ? fromKey : to;
+
+	if (!this->hasSkippedRange) {
+		this->skippedStartStr = low;
+		this->skippedEndStr = high;
+		this->hasSkippedRange = true;
+		return;
+	}
+	if (!this->skippedStartStr.empty() && (low.empty() || low < this->skippedStartStr)) {
+		this->skippedStartStr = low;
+	}
+	if (!this->skippedEndStr.empty() && (high.empty() || high > this->skippedEndStr)) {
+		this->skippedEndStr = high;
+	}
+}
+
 void DBIteratorHandle::seek(DBIteratorOptions& options) {
+	SkippedTombstoneCounter counter(this->skippedTombstones, this->tombstoneCompactor != nullptr);
+
 	if (options.reverse) {
 		this->iterator->SeekToLast();
 	} else {
 		this->iterator->SeekToFirst();
 	}
+	counter.flush();
+	this->coverSkipped(0, nullptr);
 
 	if (options.exclusiveStart && options.startKeyStr != nullptr && this->iterator->Valid()) {
 		rocksdb::Slice currentKey = this->iterator->key();
 		if (currentKey.compare(this->startKey) == 0) {
-			if (options.reverse) {
-				this->iterator->Prev();
-			} else {
-				this->iterator->Next();
-			}
+			this->advance(counter);
 		}
 	}
 }
@@ -52,6 +52,18 @@ struct DBIteratorHandle final : Closable, public std::enable_shared_from_this<DB
 	 */
 	void init(DBIteratorOptions& options);
 
+	/**
+	 * Reports the tombstones skipped so far, and the range they were found in,
+	 * to the database's tombstone compactor, if any.
+	 */
+	void reportSkippedTombstones();
+
+	/**
+	 * Moves the iterator past the current key in iteration order. `counter`
+	 * must be counting this iterator's skipped tombstones.
+	 */
+	void advance(SkippedTombstoneCounter& counter);
+
 	std::shared_ptr<DBHandle> dbHandle;
 	bool exclusiveStart;
 	bool inclusiveEnd;
@@ -64,7 +76,29 @@ struct DBIteratorHandle final : Closable, public std::enable_shared_from_this<DB
 	rocksdb::Slice startKey;
 	rocksdb::Slice endKey;
 
+	// set when the database compacts tombstone-heavy ranges; the tombstones
+	// this iterator skipped are reported to it once it is exhausted or closed
+	std::shared_ptr<TombstoneCompactor> tombstoneCompactor;
+	uint32_t cfId = 0;
+	uint64_t skippedTombstones = 0;
+
 private:
+	/**
+	 * Widens the range the skipped tombstones were found in to cover a move
+	 * from `from` to the current key, if the move skipped any since
+	 * `skippedBefore`. A null `from` stands for the bound the move started at,
+	 * and an exhausted iterator for the bound it ran into.
+	 */
+	void coverSkipped(uint64_t skippedBefore, const std::string* from);
+
+	// the keys around the tombstones skipped since the last report, where
+	// empty means unbounded
+	bool hasSkippedRange = false;
+	std::string skippedStartStr;
+	std::string skippedEndStr;
+	// the key an advance started from, reused to avoid an allocation per move
+	std::string advanceFromStr;
+
 	/**
 	 * Seeks the iterator to the first or last key, or the start key if
 	 * `exclusiveStart` is true.
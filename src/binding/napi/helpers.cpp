@@ -9,10 +9,13 @@
 #include <string>
 #include <sstream>
 #include <thread>
+#include <unordered_map>
 #include "core/debug.h"
 #include "core/exception.h"
+#include "core/merge_operators.h"
 #include "napi/helpers.h"
 #include "napi/macros.h"
+#include "rocksdb/filter_policy.h"
 #include "rocksdb/utilities/options_util.h"
 #include "database/db_settings.h"
 
@@ -229,16 +232,21 @@ std::string getNapiExtendedError(napi_env env, napi_status& status, const char*
 	return std::string(errorStr);
 }
 
-std::shared_ptr<rocksdb::ColumnFamilyHandle> createRocksDBColumnFamily(const std::shared_ptr<rocksdb::DB> db, const std::string& name) {
+std::shared_ptr<rocksdb::ColumnFamilyHandle> createRocksDBColumnFamily(const std::shared_ptr<rocksdb::DB> db, const std::string& name, const DBOptions& options) {
 	rocksdb::ColumnFamilyHandle* cfHandle;
 	rocksdb::BlockBasedTableOptions tableOptions;
 	DBSettings& settings = DBSettings::getInstance();
 	tableOptions.block_cache = settings.getBlockCache();
+	setTableOptions(tableOptions, options);
 	rocksdb::ColumnFamilyOptions cfOptions;
-	cfOptions.enable_blob_files = true;
-	cfOptions.min_blob_size = 2048;
-	cfOptions.enable_blob_garbage_collection = true;
+	setBlobOptions(cfOptions, options);
 	cfOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+	cfOptions.merge_operator = rocksdb_js::getBuiltinMergeOperator();
+	// shares the database's TTL rules, looked up by column family id
+	rocksdb::ColumnFamilyOptions defaultOptions = db->GetOptions(db->DefaultColumnFamily());
+	cfOptions.compaction_filter_factory = defaultOptions.compaction_filter_factory;
+	// and the tombstone collector, when the database was opened with one
+	cfOptions.table_properties_collector_factories = defaultOptions.table_properties_collector_factories;
 
 	rocksdb::Status status = db->CreateColumnFamily(cfOptions, name, &cfHandle);
 	if (!status.ok()) {
@@ -247,6 +255,77 @@ std::shared_ptr<rocksdb::ColumnFamilyHandle> createRocksDBColumnFamily(const std
 	return std::shared_ptr<rocksdb::ColumnFamilyHandle>(cfHandle);
 }
 
+void setBlobOptions(rocksdb::ColumnFamilyOptions& cfOptions, const DBOptions& options) {
+	cfOptions.enable_blob_files = true;
+	cfOptions.min_blob_size = options.minBlobSize.value_or(2048);
+	cfOptions.enable_blob_garbage_collection = true;
+	if (options.blobFileSize) {
+		cfOptions.blob_file_size = *options.blobFileSize;
+	}
+	if (options.blobGarbageCollectionAgeCutoff) {
+		cfOptions.blob_garbage_collection_age_cutoff = *options.blobGarbageCollectionAgeCutoff;
+	}
+	if (options.blobCompactionReadaheadSize) {
+		cfOptions.blob_compaction_readahead_size = *options.blobCompactionReadaheadSize;
+	}
+
+	if (options.blobCacheShared) {
+		// blobs and blocks compete for the same memory; may be nullptr if the
+		// block cache is disabled
+		cfOptions.blob_cache = DBSettings::getInstance().getBlockCache();
+	} else if (options.blobCacheSize > 0) {
+		cfOptions.blob_cache = rocksdb::NewLRUCache(static_cast<size_t>(options.blobCacheSize));
+	}
+}
+
+void setTableOptions(rocksdb::BlockBasedTableOptions& tableOptions, const DBOptions& options) {
+	if (options.bloomFilterBitsPerKey > 0) {
+		tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(options.bloomFilterBitsPerKey));
+	}
+
+	if (options.partitionedIndexFilters) {
+		tableOptions.index_type = rocksdb::BlockBasedTableOptions::IndexType::kTwoLevelIndexSearch;
+		// filters can only be partitioned along with a two-level index
+		tableOptions.partition_filters = tableOptions.filter_policy != nullptr;
+	}
+
+	if (options.cacheIndexAndFilterBlocks) {
+		tableOptions.cache_index_and_filter_blocks = true;
+		tableOptions.cache_index_and_filter_blocks_with_high_priority = true;
+		// the pinning tiers supersede the pin_l0_filter_and_index_blocks_in_cache
+		// and pin_top_level_index_and_filter flags
+		auto& pinning = tableOptions.metadata_cache_options;
+		pinning.top_level_index_pinning = options.pinTopLevelIndexAndFilter.value_or(true) ? rocksdb::PinningTier::kAll : rocksdb::PinningTier::kNone;
+		if (options.pinL0FilterAndIndexBlocksInCache) {
+			pinning.partition_pinning = rocksdb::PinningTier::kFlushedAndSimilar;
+			pinning.unpartitioned_pinning = rocksdb::PinningTier::kFlushedAndSimilar;
+		} else {
+			pinning.partition_pinning = rocksdb::PinningTier::kNone;
+			pinning.unpartitioned_pinning = rocksdb::PinningTier::kNone;
+		}
+	}
+}
+
+rocksdb::Status updateBlobOptions(rocksdb::DB* db, rocksdb::ColumnFamilyHandle* column, const DBOptions& options) {
+	std::unordered_map<std::string, std::string> blobOptions;
+	if (options.minBlobSize) {
+		blobOptions["min_blob_size"] = std::to_string(*options.minBlobSize);
+	}
+	if (options.blobFileSize) {
+		blobOptions["blob_file_size"] = std::to_string(*options.blobFileSize);
+	}
+	if (options.blobGarbageCollectionAgeCutoff) {
+		blobOptions["blob_garbage_collection_age_cutoff"] = std::to_string(*options.blobGarbageCollectionAgeCutoff);
+	}
+	if (options.blobCompactionReadaheadSize) {
+		blobOptions["blob_compaction_readahead_size"] = std::to_string(*options.blobCompactionReadaheadSize);
+	}
+	if (blobOptions.empty()) {
+		return rocksdb::Status::OK();
+	}
+	return db->SetOptions(column, blobOptions);
+}
+
 static const char* errorCodeStrings[] = {
 	"ERR_UNKNOWN",
 	"ERR_NOT_FOUND",
@@ -9,7 +9,9 @@
 #include "core/exception.h"
 #include "napi/binding.h"
 #include "napi/status_macros.h"
+#include "options/db_options.h"
 #include "rocksdb/db.h"
+#include "rocksdb/table.h"
 
 namespace rocksdb_js {
 
@@ -25,7 +27,25 @@ namespace rocksdb_js {
 
 void createJSError(napi_env env, const char* code, const char* message, napi_value& error);
 
-std::shared_ptr<rocksdb::ColumnFamilyHandle> createRocksDBColumnFamily(const std::shared_ptr<rocksdb::DB> db, const std::string& name);
+std::shared_ptr<rocksdb::ColumnFamilyHandle> createRocksDBColumnFamily(const std::shared_ptr<rocksdb::DB> db, const std::string& name, const DBOptions& options);
+
+/**
+ * Sets the blob file and blob cache options of a column family about to be
+ * opened or created. Blob files are always enabled, with garbage collection.
+ */
+void setBlobOptions(rocksdb::ColumnFamilyOptions& cfOptions, const DBOptions& options);
+
+/**
+ * Sets the bloom filter and the index and filter block options of a column
+ * family's table options. The block cache is left to the caller.
+ */
+void setTableOptions(rocksdb::BlockBasedTableOptions& tableOptions, const DBOptions& options);
+
+/**
+ * Applies the blob file options set in `options` to an open column family.
+ * The blob cache cannot be changed once the column family is open.
+ */
+rocksdb::Status updateBlobOptions(rocksdb::DB* db, rocksdb::ColumnFamilyHandle* column, const DBOptions& options);
 
 void createRocksDBError(napi_env env, rocksdb::Status status, const char* msg, napi_value& error);
 
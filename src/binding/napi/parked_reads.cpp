@@ -0,0 +1,85 @@
+#include "napi/parked_reads.h"
+#include "core/debug.h"
+
+namespace rocksdb_js {
+
+/**
+ * TSFN callback: hands the woken park id to the env's JS wake function.
+ */
+static void parkedReadCallJs(napi_env env, napi_value jsCallback, void* context, void* data) {
+	// env and jsCallback are nullptr when the env is tearing down; the parked
+	// read dies with it.
+	if (env == nullptr || jsCallback == nullptr) {
+		return;
+	}
+	napi_value global;
+	napi_value id;
+	if (::napi_get_global(env, &global) != napi_ok ||
+		::napi_create_uint32(env, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(data)), &id) != napi_ok
+	) {
+		return;
+	}
+	::napi_call_function(env, global, jsCallback, 1, &id, nullptr);
+}
+
+napi_status ParkedReads::registerEnv(napi_env env, napi_value onWake) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	if (this->wakers.find(env) != this->wakers.end()) {
+		return napi_ok;
+	}
+
+	napi_value resourceName;
+	napi_status status = ::napi_create_string_latin1(env, "rocksdb-js.parkedRead", NAPI_AUTO_LENGTH, &resourceName);
+	if (status != napi_ok) {
+		return status;
+	}
+
+	napi_threadsafe_function tsfn;
+	status = ::napi_create_threadsafe_function(
+		env,
+		onWake,    // func
+		nullptr,   // async_resource
+		resourceName,
+		0,         // unlimited queue
+		1,         // initial thread count: released by releaseByEnv
+		nullptr,   // finalize data
+		nullptr,   // finalize cb
+		nullptr,   // context
+		parkedReadCallJs,
+		&tsfn
+	);
+	if (status != napi_ok) {
+		return status;
+	}
+	// Never keeps the event loop alive on its own; see the class comment.
+	status = ::napi_unref_threadsafe_function(env, tsfn);
+	if (status != napi_ok) {
+		::napi_release_threadsafe_function(tsfn, napi_tsfn_release);
+		return status;
+	}
+
+	DEBUG_LOG("ParkedReads::registerEnv env=%p tsfn=%p\n", env, tsfn);
+	this->wakers.emplace(env, tsfn);
+	return napi_ok;
+}
+
+void ParkedReads::dispatch(napi_env env, uint32_t id) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	auto it = this->wakers.find(env);
+	if (it == this->wakers.end()) {
+		return;
+	}
+	::napi_call_threadsafe_function(it->second, reinterpret_cast<void*>(static_cast<uintptr_t>(id)), napi_tsfn_nonblocking);
+}
+
+void ParkedReads::releaseByEnv(napi_env env) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	auto it = this->wakers.find(env);
+	if (it != this->wakers.end()) {
+		DEBUG_LOG("ParkedReads::releaseByEnv env=%p tsfn=%p\n", env, it->second);
+		::napi_release_threadsafe_function(it->second, napi_tsfn_release);
+		this->wakers.erase(it);
+	}
+}
+
+} // namespace rocksdb_js
@@ -0,0 +1,66 @@
+#ifndef __NAPI_PARKED_READS_H__
+#define __NAPI_PARKED_READS_H__
+
+#include <node_api.h>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace rocksdb_js {
+
+/**
+ * Process-wide, per-env delivery of parked-read wake-ups.
+ *
+ * An async `get()` with `waitForWrite` that finds its verification table slot
+ * lock-tagged registers a wake callback on the slot's `LockTracker` instead
+ * of reading right away. The tracker is woken by whichever thread releases
+ * the last write intent (usually a commit thread), so the wake-up is
+ * marshalled back to the reader's env through a single threadsafe function
+ * per env, carrying only the JS-assigned park id — no per-read tsfn and no
+ * per-read JS reference.
+ *
+ * The registry is keyed by env rather than hung off `DBDescriptor` because
+ * the table is process-wide: a slot can be locked by another database's
+ * writer, and wake callbacks run under the table's writer mutex, where they
+ * must not be the last owner of a descriptor.
+ *
+ * `mutex` guards both the tsfn call (`dispatch`) and its release
+ * (`releaseByEnv`, run from the module env-cleanup hook) — the same
+ * discipline `DBDescriptor::dispatchCommitCompletion` uses. The tsfns are
+ * unref'd: the JS side's bounded-wait timer is what keeps the event loop
+ * alive while a read is parked.
+ */
+class ParkedReads final {
+public:
+	static ParkedReads& getInstance() {
+		static ParkedReads instance;
+		return instance;
+	}
+
+	/**
+	 * JS thread. Ensures `env` has a wake tsfn that calls `onWake(id)`. The
+	 * first registration per env wins; later calls reuse its tsfn.
+	 */
+	napi_status registerEnv(napi_env env, napi_value onWake);
+
+	/**
+	 * Any thread (a LockTracker wake callback). Queues `onWake(id)` on `env`.
+	 * A no-op if the env has gone away; the reader's timeout resumes it.
+	 */
+	void dispatch(napi_env env, uint32_t id);
+
+	/**
+	 * Module env-cleanup hook. Releases and forgets a dying env's wake tsfn.
+	 */
+	void releaseByEnv(napi_env env);
+
+private:
+	ParkedReads() = default;
+
+	std::mutex mutex;
+	std::unordered_map<napi_env, napi_threadsafe_function> wakers;
+};
+
+} // namespace rocksdb_js
+
+#endif
@@ -2,8 +2,10 @@
 #define __DB_OPTIONS_H__
 
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <thread>
+#include "core/merge_operators.h"
 
 namespace rocksdb_js {
 
@@ -20,6 +22,35 @@ enum class DBMode {
  * values passed in from public `open()` method.
  */
 struct DBOptions final {
+	// Lets the writers of a write group insert into the memtable in parallel
+	// once the leader has written the WAL. `bulkLoad` turns it off, since its
+	// vector memtable does not support concurrent inserts.
+	bool allowConcurrentMemtableWrite = true;
+	// Caches uncompressed blob values in a dedicated LRU cache of this many
+	// bytes, or in the process-wide block cache with `blobCacheShared`. The
+	// cache is fixed when a column family is opened with the database or
+	// created; 0 leaves blob reads uncached.
+	uint64_t blobCacheSize = 0;
+	bool blobCacheShared = false;
+	// Blob file settings (see `setBlobOptions()` in napi/helpers.h). Unset
+	// values keep the column family's current setting, or the default for
+	// one being opened.
+	std::optional<uint64_t> blobCompactionReadaheadSize;
+	std::optional<uint64_t> blobFileSize;
+	std::optional<double> blobGarbageCollectionAgeCutoff;
+	// Bits per key of the bloom filter built for each SST file. 0 builds none.
+	double bloomFilterBitsPerKey = 0;
+	// Opens the database for a one-off bulk load: auto compactions off, L0
+	// triggers raised out of reach, a vector memtable and no WAL, until
+	// `finishBulkLoad()` compacts everything and reverts.
+	bool bulkLoad = false;
+	// Loads index and filter blocks through the block cache, at high priority,
+	// instead of holding them in the table readers for as long as the file is
+	// open. The pin options below only apply with it.
+	bool cacheIndexAndFilterBlocks = false;
+	// Number of keys the conflict profiler tracks (see
+	// core/conflict_profiler.h). 0 leaves it disabled.
+	uint32_t conflictStatsSize = 0;
 	// Global memtable size trigger across all column families. When the sum of
 	// all memtables reaches this size, the largest memtable is flushed. With
 	// `atomic_flush = true`, this triggers flushes across every CF. 0 disables
@@ -42,20 +73,49 @@ struct DBOptions final {
 	// (see `deriveMaxOpenFiles`); -1 = unlimited (every SST held open — can
 	// exhaust the process fd limit under compaction lag); >0 = explicit cap.
 	int32_t maxOpenFiles = 0;
+	// Size cap in bytes for values built by the `append` merge operator; the
+	// oldest elements are dropped past it. 0 is unbounded.
+	uint32_t mergeAppendLimit = 0;
+	// The built-in merge operator `merge()` writes operands for (see
+	// core/merge_operators.h). `None` rejects merges.
+	MergeOperatorKind mergeOperator = MergeOperatorKind::None;
+	// Values at least this large are stored in blob files.
+	std::optional<uint64_t> minBlobSize;
 	DBMode mode = DBMode::Optimistic;
 	std::string name;
 	bool noBlockCache = false;
+	// Splits index and filter blocks into partitions behind a small
+	// top-level index, so only the partitions a lookup needs are cached.
+	bool partitionedIndexFilters = false;
+	// Keeps the index and filter blocks of L0 files, and the top-level index
+	// of partitioned ones, pinned in the block cache.
+	bool pinL0FilterAndIndexBlocksInCache = false;
+	// Unset means pinned; only set with `cacheIndexAndFilterBlocks`.
+	std::optional<bool> pinTopLevelIndexAndFilter;
 	bool readOnly = false;
 	uint32_t parallelismThreads = std::max<uint32_t>(1, std::thread::hardware_concurrency() / 2);
 	uint8_t statsLevel = rocksdb::StatsLevel::kExceptDetailedTimers;
+	// Compacts deletion-heavy SST files, and the key ranges iterators find
+	// full of tombstones, in the background (see core/tombstone_compactor.h).
+	bool tombstoneCompaction = false;
+	// Estimated bytes per second the tombstone range compactions may rewrite.
+	// 0 is unlimited.
+	uint64_t tombstoneCompactionBytesPerSecond = 16 * 1024 * 1024; // 16MB/s
+	// Tombstones one iterator must skip before its range is compacted.
+	uint64_t tombstoneCompactionThreshold = 10000;
 	float transactionLogMaxAgeThreshold = 0.75f;
 	uint32_t transactionLogMaxSize = 16 * 1024 * 1024; // 16MB
 	uint32_t transactionLogRetentionMs = 3 * 24 * 60 * 60 * 1000; // 3 days
 	std::string transactionLogsPath;
+	// Closed RocksDB transactions kept for reuse; 0 disables the pool.
+	uint32_t transactionPoolSize = 32;
 	// Per-CF memtable size at which the memtable is sealed and flushed. Smaller
 	// values produce more frequent, faster flushes; larger values batch more
 	// writes per SST file.
 	uint64_t writeBufferSize = 16ULL * 1024 * 1024; // 16MB
+	// Microseconds a writer spins waiting for the write leader before it
+	// blocks on a condition variable.
+	uint64_t writeThreadMaxYieldUsec = 100;
 	// Opt-in per-CF flag enabling Verification Table slot locking/tracking for
 	// this column family's writes (see core/verification_table.h).
 	bool verificationTable = false;
@@ -10,6 +10,7 @@
 #include "napi/macros.h"
 #include "transaction/transaction.h"
 #include "transaction/transaction_handle.h"
+#include "core/encoding.h"
 #include "core/platform.h"
 #include "core/test_seam.h"
 #include "napi/helpers.h"
@@ -86,12 +87,15 @@ napi_value Transaction::Constructor(napi_env env, napi_callback_info info) {
 	bool coordinatedRetry = false;
 	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, argv[1], "coordinatedRetry", coordinatedRetry));
 
+	bool readOnly = false;
+	NAPI_STATUS_THROWS(rocksdb_js::getProperty(env, argv[1], "readOnly", readOnly));
+
 	napi_ref jsDatabaseRef;
 	NAPI_STATUS_THROWS(::napi_create_reference(env, argv[0], 0, &jsDatabaseRef));
 
 	// create shared_ptr on heap so it persists after function returns
 	std::shared_ptr<TransactionHandle>* txnHandle = new std::shared_ptr<TransactionHandle>(
-		std::make_shared<TransactionHandle>(*dbHandle, env, jsDatabaseRef, disableSnapshot)
+		std::make_shared<TransactionHandle>(*dbHandle, env, jsDatabaseRef, disableSnapshot, readOnly)
 	);
 	(*txnHandle)->coordinatedRetry = coordinatedRetry;
 
@@ -152,7 +156,9 @@ napi_value Transaction::Abort(napi_env env, napi_callback_info info) {
 
 	(*txnHandle)->state = TransactionState::Aborted;
 
-	ROCKSDB_STATUS_THROWS_ERROR_LIKE((*txnHandle)->txn->Rollback(), "Transaction rollback failed");
+	if ((*txnHandle)->txn) {
+		ROCKSDB_STATUS_THROWS_ERROR_LIKE((*txnHandle)->txn->Rollback(), "Transaction rollback failed");
+	}
 	DEBUG_LOG("Transaction::Abort closing txnHandle=%p txnId=%u\n", (*txnHandle).get(), (*txnHandle)->id);
 	(*txnHandle)->close();
 
@@ -195,6 +201,8 @@ struct TransactionCommitState final : BaseAsyncState<std::shared_ptr<Transaction
 	bool hasLog;
 	// Slot pointers captured before releaseIntent() for coordinated-retry parking.
 	std::vector<std::atomic<uint64_t>*> savedSlots;
+	// Time spent in executeLogWork(), fed to the database's CommitModeTracker.
+	uint64_t logStageNs = 0;
 
 	TransactionCommitState(
 		napi_env env,
@@ -298,6 +306,12 @@ static void executeCommitWork(TransactionCommitState* state) {
 			if (!txnHandle->lockedVTSlots.empty()) {
 				txnHandle->releaseIntent();
 			}
+
+			// removed ranges hold no per-key intents; their partitions are
+			// settled once the range tombstone is visible
+			if (state->status.ok()) {
+				txnHandle->settleRangeRemovals();
+			}
 		}
 
 		// Publish the log entries (advance the committed-read watermark) only when the data
@@ -327,14 +341,18 @@ static void executeCommitWork(TransactionCommitState* state) {
 		} else if (state->status.IsBusy() || state->status.IsTryAgain()) {
 			DEBUG_LOG("%p Transaction::Commit ERROR: Commit failed with %s, resetting transaction\n",
 				txnHandle.get(), state->status.IsBusy() ? "IsBusy" : "TryAgain");
-			// Clear/delete the previous transaction and create a new one so the retry re-drives the
-			// commit. resetTransaction preserves committedPosition (the WAL batch stays write-once,
+			// Re-initialize the transaction in place so the retry re-drives the commit.
+			// resetTransaction preserves committedPosition (the WAL batch stays write-once,
 			// #668) but takes a fresh RocksDB snapshot: IsBusy converges by re-tracking keys at the
 			// current sequence, and TryAgain — whose snapshot was stranded outside the memtable
 			// window after a flush, so recommitting the same transaction re-checks the same lost
 			// history forever (harper#1695) — converges because the re-run reads and validates
 			// against current state instead. The caller must re-run the transaction body so the
 			// reads are re-taken on the new snapshot (db.transaction()'s retry loop does this).
+			if (state->status.IsBusy()) {
+				txnHandle->recordCommitConflict();
+				txnHandle->conflictRetries++;
+			}
 			txnHandle->resetTransaction();
 		}
 	}
@@ -507,8 +525,12 @@ static void commitCompletionCallJs(napi_env env, napi_value jsCallback, void* co
  *   stages overlap across transactions. Measured slower than single-lane on
  *   synthetic loads (the per-txn handoff outweighs the overlap for small
  *   commits); selectable for evaluation on real workloads.
+ * - `auto`: adaptive — each database measures its log-write and RocksDB-commit
+ *   stage times and splits commits across both lanes only while both stages
+ *   are expensive enough for the overlap to beat the handoff, otherwise runs
+ *   them single-lane (see CommitModeTracker).
  */
-enum class CommitThreadMode { Legacy, SingleLane, TwoLane };
+enum class CommitThreadMode { Legacy, SingleLane, TwoLane, Adaptive };
 
 static CommitThreadMode commitThreadMode() {
 	static const CommitThreadMode mode = []() {
@@ -519,11 +541,24 @@ static CommitThreadMode commitThreadMode() {
 		if (v != nullptr && ::strcmp(v, "2") == 0) {
 			return CommitThreadMode::TwoLane;
 		}
+		if (v != nullptr && ::strcmp(v, "auto") == 0) {
+			return CommitThreadMode::Adaptive;
+		}
 		return CommitThreadMode::SingleLane;
 	}();
 	return mode;
 }
 
+/**
+ * Runs the log stage of a commit-lane commit, recording how long it took.
+ */
+static void timeLogWork(TransactionCommitState* state) {
+	auto start = std::chrono::steady_clock::now();
+	executeLogWork(state);
+	state->logStageNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - start).count());
+}
+
 /**
  * Test-only seam: milliseconds the commit thread sleeps after executing the
  * commit and before calling back into JS. Widens the window in which env
@@ -563,6 +598,17 @@ napi_value Transaction::Commit(napi_env env, napi_callback_info info) {
 		delete state;
 		return nullptr;
 	}
+	if ((*txnHandle)->readOnly) {
+		// nothing to write, so there is nothing to hand to a commit lane:
+		// release the snapshot and resolve right away
+		delete state;
+		(*txnHandle)->state = TransactionState::Committed;
+		(*txnHandle)->close();
+		napi_value global;
+		NAPI_STATUS_THROWS(::napi_get_global(env, &global));
+		NAPI_STATUS_THROWS(::napi_call_function(env, global, resolve, 0, nullptr, nullptr));
+		return nullptr;
+	}
 	DEBUG_LOG("%p Transaction::Commit Setting state to committing\n", (*txnHandle).get(), (*txnHandle)->id);
 	(*txnHandle)->state = TransactionState::Committing;
 
@@ -587,10 +633,21 @@ napi_value Transaction::Commit(napi_env env, napi_callback_info info) {
 			// register the commit with the transaction handle so close() can wait
 			(*txnHandle)->registerAsyncWork();
 
+			// Splitting is decided per commit at dispatch. A commit only
+			// switches routes once every earlier commit on the other route is
+			// past the point where it could be overtaken, so log writes stay in
+			// commit order in either direction.
+			bool twoLane = descriptor->commitMode.dispatch(mode == CommitThreadMode::TwoLane ||
+				(mode == CommitThreadMode::Adaptive && descriptor->commitMode.preferTwoLane()));
+
 			// Commit-lane stage: RocksDB commit, then marshal the completion
 			// back to the originating env.
-			auto commitStage = [descriptor, state]() {
+			auto commitStage = [descriptor, state, twoLane]() {
+				auto start = std::chrono::steady_clock::now();
 				executeCommitWork(state);
+				auto commitNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now() - start).count();
+				descriptor->commitMode.record(state->logStageNs, static_cast<uint64_t>(commitNs), twoLane);
 				if (unsigned delay = commitDelayMs()) {
 					std::this_thread::sleep_for(std::chrono::milliseconds(delay));
 				}
@@ -607,19 +664,22 @@ napi_value Transaction::Commit(napi_env env, napi_callback_info info) {
 				}
 			};
 
-			if (mode == CommitThreadMode::TwoLane) {
+			if (twoLane) {
 				// Two-lane pipeline: the log lane writes the transaction-log
-				// batch, then forwards to the commit lane. Every commit passes
-				// through both lanes so total order is preserved.
-				descriptor->logWorker.enqueue([descriptor, state, commitStage]() {
-					executeLogWork(state);
-					descriptor->commitWorker.enqueue(commitStage);
+				// batch, then forwards to the commit lane. Each lane preserves
+				// order, so total order is preserved.
+				descriptor->commitMode.logStageInFlight.fetch_add(1);
+				descriptor->enqueueLogTask([descriptor, state, commitStage]() {
+					timeLogWork(state);
+					descriptor->enqueueCommitTask(commitStage);
+					descriptor->commitMode.logStageInFlight.fetch_sub(1);
 				});
 			} else {
 				// Single lane (default): both stages run back to back on the
 				// commit lane.
-				descriptor->commitWorker.enqueue([state, commitStage]() {
-					executeLogWork(state);
+				descriptor->enqueueCommitTask([descriptor, state, commitStage]() {
+					timeLogWork(state);
+					descriptor->commitMode.singleLaneInFlight.fetch_sub(1);
 					commitStage();
 				});
 			}
@@ -687,6 +747,11 @@ napi_value Transaction::CommitSync(napi_env env, napi_callback_info info) {
 	if (txnState == TransactionState::Committing || txnState == TransactionState::Committed) {
 		NAPI_RETURN_UNDEFINED();
 	}
+	if ((*txnHandle)->readOnly) {
+		(*txnHandle)->state = TransactionState::Committed;
+		(*txnHandle)->close();
+		NAPI_RETURN_UNDEFINED();
+	}
 	(*txnHandle)->state = TransactionState::Committing;
 
 	std::shared_ptr<TransactionLogStore> store = nullptr;
@@ -712,6 +777,9 @@ napi_value Transaction::CommitSync(napi_env env, napi_callback_info info) {
 	if (!(*txnHandle)->lockedVTSlots.empty()) {
 		(*txnHandle)->releaseIntent();
 	}
+	if (status.ok()) {
+		(*txnHandle)->settleRangeRemovals();
+	}
 
 	// Publish only on a real commit; IsBusy/TryAgain defer to the retry's eventual success, and on
 	// a hard error close()'s commitAborted stops the position pinning the watermark. See the async
@@ -741,6 +809,10 @@ napi_value Transaction::CommitSync(napi_env env, napi_callback_info info) {
 				(*txnHandle).get(), status.IsBusy() ? "IsBusy" : "TryAgain");
 			// Reset onto a fresh snapshot so the retry re-drives the commit against current state
 			// (committedPosition survives, keeping the WAL write-once, #668). See async Commit.
+			if (status.IsBusy()) {
+				(*txnHandle)->recordCommitConflict();
+				(*txnHandle)->conflictRetries++;
+			}
 			(*txnHandle)->resetTransaction();
 		}
 		if ((*txnHandle)->state == TransactionState::Committing) {
@@ -803,12 +875,117 @@ napi_value Transaction::Get(napi_env env, napi_callback_info info) {
 
 	std::atomic<uint64_t>* vtSlot = nullptr;
 	uint64_t vtObserved = 0;
+	uint64_t vtClearGen = 0;
 	if (hasExpectedVersion) {
-		vtSlot = vtSlotFor((*txnHandle)->dbHandle, DBSettings::getInstance().getVerificationTableRaw(), keySlice);
-		if (vtSlot) vtObserved = vtSlot->load(std::memory_order_acquire);
+		VerificationTable* vt = DBSettings::getInstance().getVerificationTableRaw();
+		vtSlot = vtSlotFor((*txnHandle)->dbHandle, vt, keySlice);
+		if (vtSlot) vtObserved = vtObserve((*txnHandle)->dbHandle, vt, vtSlot, vtClearGen);
+	}
+
+	return (*txnHandle)->get(env, key, resolve, reject, nullptr, vtSlot, vtObserved, vtClearGen, hasExpectedVersion, expectedVersion);
+}
+
+/**
+ * Synchronously gets a batch of values through the transaction in one
+ * `MultiGet`. `argv[0]` is a buffer of keys, each prefixed with its length as
+ * a big-endian uint32, `argv[1]` is the number of keys, `argv[2]` is the get
+ * flags (only `POPULATE_VERSION_FLAG` applies), and `argv[3]` reads with
+ * `MultiGetForUpdate` when true.
+ *
+ * Returns one buffer holding the values in key order, each prefixed with its
+ * length as a big-endian uint32, or `0xFFFFFFFF` (and no bytes) when the key
+ * was not found.
+ *
+ * @example
+ * ```typescript
+ * const txn = new NativeTransaction(db);
+ * const packedValues = txn.getMany(packedKeys, 3, 0, true);
+ * ```
+ */
+napi_value Transaction::GetMany(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(4);
+	UNWRAP_TRANSACTION_HANDLE("GetMany");
+
+	char* packed = nullptr;
+	size_t packedLength = 0;
+	NAPI_STATUS_THROWS(::napi_get_buffer_info(env, argv[0], reinterpret_cast<void**>(&packed), &packedLength));
+	uint32_t count = 0;
+	NAPI_STATUS_THROWS(::napi_get_value_uint32(env, argv[1], &count));
+	int32_t flags = 0;
+	NAPI_STATUS_THROWS(::napi_get_value_int32(env, argv[2], &flags));
+	bool forUpdate = false;
+	NAPI_STATUS_THROWS(::napi_get_value_bool(env, argv[3], &forUpdate));
+
+	std::vector<rocksdb::Slice> keys;
+	if (!parsePackedKeys(packed, packedLength, count, keys)) {
+		::napi_throw_range_error(env, nullptr, "Packed keys do not match the number of keys");
+		return nullptr;
 	}
 
-	return (*txnHandle)->get(env, key, resolve, reject, nullptr, vtSlot, vtObserved, hasExpectedVersion, expectedVersion);
+	// As in GetSync, pin the snapshot before observing the slots so a write
+	// cycle landing in between can't be published over by a stale read.
+	(*txnHandle)->ensureSnapshot();
+
+	std::vector<std::atomic<uint64_t>*> vtSlots;
+	std::vector<uint64_t> vtObserved;
+	uint64_t vtClearGen = 0;
+	VerificationTable* vt = DBSettings::getInstance().getVerificationTableRaw();
+	if ((flags & POPULATE_VERSION_FLAG) && vt && (*txnHandle)->dbHandle) {
+		vtSlots.resize(count);
+		vtObserved.resize(count);
+		// every key is in the same partition, so one clear generation, loaded
+		// before any slot, covers them all
+		vtClearGen = vt->clearGeneration(vtPartitionFor((*txnHandle)->dbHandle));
+		for (size_t i = 0; i < count; i++) {
+			vtSlots[i] = vtSlotFor((*txnHandle)->dbHandle, vt, keys[i]);
+			vtObserved[i] = vtSlots[i] ? vtSlots[i]->load(std::memory_order_acquire) : 0;
+		}
+	}
+
+	std::vector<rocksdb::PinnableSlice> values;
+	std::vector<rocksdb::Status> statuses;
+	rocksdb::ReadOptions readOptions;
+	rocksdb::Status readStatus = (*txnHandle)->getMany(keys, values, statuses, readOptions, forUpdate);
+
+	size_t totalLength = 0;
+	for (size_t i = 0; readStatus.ok() && i < count; i++) {
+		if (!statuses[i].ok() && !statuses[i].IsNotFound()) {
+			// e.g. a lock timeout or a conflicting write under forUpdate
+			readStatus = statuses[i];
+		}
+		totalLength += 4 + (statuses[i].ok() ? values[i].size() : 0);
+	}
+	if (!readStatus.ok()) {
+		napi_value error;
+		rocksdb_js::createRocksDBError(env, readStatus, "Transaction get many failed", error);
+		::napi_throw(env, error);
+		return nullptr;
+	}
+
+	if (!vtSlots.empty()) {
+		const rocksdb::Snapshot* readSnapshot = (*txnHandle)->readSnapshot();
+		for (size_t i = 0; i < count; i++) {
+			if (vtSlots[i] && statuses[i].ok()) {
+				uint64_t extracted = VerificationTable::extractVersionFromValue(values[i]);
+				vtPopulateIfSettled((*txnHandle)->dbHandle, vtSlots[i], keys[i], extracted, readSnapshot, vtObserved[i], vtClearGen);
+			}
+		}
+	}
+
+	napi_value result;
+	char* data = nullptr;
+	NAPI_STATUS_THROWS(::napi_create_buffer(env, totalLength, reinterpret_cast<void**>(&data), &result));
+	for (size_t i = 0; i < count; i++) {
+		if (statuses[i].ok()) {
+			writeUint32BE(data, static_cast<uint32_t>(values[i].size()));
+			::memcpy(data + 4, values[i].data(), values[i].size());
+			data += 4 + values[i].size();
+		} else {
+			writeUint32BE(data, UINT32_MAX);
+			data += 4;
+		}
+	}
+	return result;
 }
 
 /**
@@ -890,13 +1067,15 @@ napi_value Transaction::GetSync(napi_env env, napi_callback_info info) {
 	// Observe the slot after the snapshot is established; reused for the
 	// fast-path check and the post-read conditional CAS.
 	uint64_t vtObserved = 0;
+	uint64_t vtClearGen = 0;
 	if (hasExpectedVersion || wantsPopulate) {
-		vtSlot = vtSlotFor((*txnHandle)->dbHandle, DBSettings::getInstance().getVerificationTableRaw(), keySlice);
-		if (vtSlot) vtObserved = vtSlot->load(std::memory_order_acquire);
+		VerificationTable* vt = DBSettings::getInstance().getVerificationTableRaw();
+		vtSlot = vtSlotFor((*txnHandle)->dbHandle, vt, keySlice);
+		if (vtSlot) vtObserved = vtObserve((*txnHandle)->dbHandle, vt, vtSlot, vtClearGen);
 	}
 
 	// VT fast-path: caller-supplied version matches the table → return FRESH
-	if (vtSlot && hasExpectedVersion && vtObserved == expectedVersion) {
+	if (vtSlot && hasExpectedVersion && vtCheckVersion(vtObserved, expectedVersion)) {
 		// Snapshot already established above; no further action needed.
 		napi_value result;
 		NAPI_STATUS_THROWS(::napi_create_int32(env, FRESH_VERSION_FLAG, &result));
@@ -937,11 +1116,12 @@ napi_value Transaction::GetSync(napi_env env, napi_callback_info info) {
 		const rocksdb::Snapshot* readSnapshot = (*txnHandle)->readSnapshot();
 		if (hasExpectedVersion && extracted == expectedVersion) {
 			// Soft VT miss confirmed fresh: value carries the caller's expected version.
-			vtPopulateIfSettled((*txnHandle)->dbHandle, vtSlot, keySlice, extracted, readSnapshot, vtObserved);
+			vtCount(VTCounter::SoftMiss);
+			vtPopulateIfSettled((*txnHandle)->dbHandle, vtSlot, keySlice, extracted, readSnapshot, vtObserved, vtClearGen);
 			NAPI_STATUS_THROWS(::napi_create_int32(env, FRESH_VERSION_FLAG, &result));
 			return result;
 		}
-		vtPopulateIfSettled((*txnHandle)->dbHandle, vtSlot, keySlice, extracted, readSnapshot, vtObserved);
+		vtPopulateIfSettled((*txnHandle)->dbHandle, vtSlot, keySlice, extracted, readSnapshot, vtObserved, vtClearGen);
 	}
 
 	if (!(flags & ALWAYS_CREATE_NEW_BUFFER_FLAG) &&
@@ -992,6 +1172,50 @@ napi_value Transaction::Id(napi_env env, napi_callback_info info) {
 	return result;
 }
 
+/**
+ * Merges an operand into the value for the given key when the transaction
+ * commits, with the built-in merge operator the database was opened with.
+ *
+ * @example
+ * ```typescript
+ * const txn = new NativeTransaction(db);
+ * txn.mergeSync(Buffer.from('counter'), delta);
+ * ```
+ */
+napi_value Transaction::MergeSync(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(2);
+	NAPI_GET_BUFFER(argv[0], key, "Key is required");
+	NAPI_GET_BUFFER(argv[1], operand, "Operand is required");
+	UNWRAP_TRANSACTION_HANDLE("Merge");
+
+	rocksdb::Slice keySlice(key + keyStart, keyEnd - keyStart);
+	rocksdb::Slice payloadSlice(operand + operandStart, operandEnd - operandStart);
+
+	ROCKSDB_STATUS_THROWS_ERROR_LIKE((*txnHandle)->mergeSync(keySlice, payloadSlice), "Transaction merge failed");
+
+	NAPI_RETURN_UNDEFINED();
+}
+
+/**
+ * Removes the most recent savepoint without undoing the writes made since.
+ *
+ * @example
+ * ```typescript
+ * const txn = new NativeTransaction(db);
+ * txn.setSavepoint();
+ * txn.putSync('foo', 'bar');
+ * txn.popSavepoint(); // the put is kept
+ * ```
+ */
+napi_value Transaction::PopSavepoint(napi_env env, napi_callback_info info) {
+	NAPI_METHOD();
+	UNWRAP_TRANSACTION_HANDLE("PopSavepoint");
+
+	ROCKSDB_STATUS_THROWS_ERROR_LIKE((*txnHandle)->popSavepoint(), "Transaction pop savepoint failed");
+
+	NAPI_RETURN_UNDEFINED();
+}
+
 /**
  * Puts a value for the given key.
  */
@@ -1032,6 +1256,65 @@ napi_value Transaction::RemoveSync(napi_env env, napi_callback_info info) {
 	NAPI_RETURN_UNDEFINED();
 }
 
+/**
+ * Removes the keys from `start` (inclusive) to `end` (exclusive) when the
+ * transaction commits.
+ *
+ * @example
+ * ```typescript
+ * const txn = new NativeTransaction(db);
+ * txn.removeRangeSync(Buffer.from('a'), Buffer.from('m'));
+ * ```
+ */
+napi_value Transaction::RemoveRangeSync(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(2);
+	NAPI_GET_BUFFER(argv[0], start, "Start key is required");
+	NAPI_GET_BUFFER(argv[1], end, "End key is required");
+	UNWRAP_TRANSACTION_HANDLE("RemoveRange");
+
+	rocksdb::Slice startSlice(start + startStart, startEnd - startStart);
+	rocksdb::Slice endSlice(end + endStart, endEnd - endStart);
+
+	ROCKSDB_STATUS_THROWS_ERROR_LIKE((*txnHandle)->removeRangeSync(startSlice, endSlice), "Transaction remove range failed");
+
+	NAPI_RETURN_UNDEFINED();
+}
+
+/**
+ * Undoes the writes and log entries added since the most recent savepoint and
+ * removes that savepoint.
+ *
+ * @example
+ * ```typescript
+ * const txn = new NativeTransaction(db);
+ * txn.putSync('foo', 'bar');
+ * txn.setSavepoint();
+ * txn.putSync('baz', 'qux');
+ * txn.rollbackToSavepoint(); // only 'foo' is written on commit
+ * ```
+ */
+napi_value Transaction::RollbackToSavepoint(napi_env env, napi_callback_info info) {
+	NAPI_METHOD();
+	UNWRAP_TRANSACTION_HANDLE("RollbackToSavepoint");
+
+	ROCKSDB_STATUS_THROWS_ERROR_LIKE((*txnHandle)->rollbackToSavepoint(), "Transaction rollback to savepoint failed");
+
+	NAPI_RETURN_UNDEFINED();
+}
+
+/**
+ * Sets a savepoint that `rollbackToSavepoint()` can undo back to. Savepoints
+ * nest.
+ */
+napi_value Transaction::SetSavepoint(napi_env env, napi_callback_info info) {
+	NAPI_METHOD();
+	UNWRAP_TRANSACTION_HANDLE("SetSavepoint");
+
+	ROCKSDB_STATUS_THROWS_ERROR_LIKE((*txnHandle)->setSavepoint(), "Transaction set savepoint failed");
+
+	NAPI_RETURN_UNDEFINED();
+}
+
 /**
  * Sets the timestamp of the transaction.
  */
@@ -1070,6 +1353,10 @@ napi_value Transaction::UseLog(napi_env env, napi_callback_info info) {
 	NAPI_GET_STRING(argv[0], name, "Name is required");
 	UNWRAP_TRANSACTION_HANDLE("UseLog");
 
+	if ((*txnHandle)->readOnly) {
+		NAPI_THROW_JS_ERROR("ERR_NOT_SUPPORTED", "Transaction is read-only");
+	}
+
 	// check if transaction is already bound to a different log store
 	auto boundStore = (*txnHandle)->boundLogStore.lock();
 	if (boundStore && boundStore->name != name) {
@@ -1135,11 +1422,17 @@ void Transaction::Init(napi_env env, napi_value exports) {
 		{ "commitSync", nullptr, CommitSync, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "get", nullptr, Get, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "getCount", nullptr, GetCount, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "getMany", nullptr, GetMany, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "getSync", nullptr, GetSync, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "getTimestamp", nullptr, GetTimestamp, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "id", nullptr, nullptr, Id, nullptr, nullptr, napi_default, nullptr },
+		{ "mergeSync", nullptr, MergeSync, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "popSavepoint", nullptr, PopSavepoint, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "putSync", nullptr, PutSync, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "removeRangeSync", nullptr, RemoveRangeSync, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "removeSync", nullptr, RemoveSync, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "rollbackToSavepoint", nullptr, RollbackToSavepoint, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "setSavepoint", nullptr, SetSavepoint, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "setTimestamp", nullptr, SetTimestamp, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "useLog", nullptr, UseLog, nullptr, nullptr, nullptr, napi_default, nullptr }
 	};
@@ -24,11 +24,17 @@ struct Transaction final {
 	static napi_value CommitSync(napi_env env, napi_callback_info info);
 	static napi_value Get(napi_env env, napi_callback_info info);
 	static napi_value GetCount(napi_env env, napi_callback_info info);
+	static napi_value GetMany(napi_env env, napi_callback_info info);
 	static napi_value GetSync(napi_env env, napi_callback_info info);
 	static napi_value GetTimestamp(napi_env env, napi_callback_info info);
 	static napi_value Id(napi_env env, napi_callback_info info);
+	static napi_value MergeSync(napi_env env, napi_callback_info info);
+	static napi_value PopSavepoint(napi_env env, napi_callback_info info);
 	static napi_value PutSync(napi_env env, napi_callback_info info);
+	static napi_value RemoveRangeSync(napi_env env, napi_callback_info info);
 	static napi_value RemoveSync(napi_env env, napi_callback_info info);
+	static napi_value RollbackToSavepoint(napi_env env, napi_callback_info info);
+	static napi_value SetSavepoint(napi_env env, napi_callback_info info);
 	static napi_value SetTimestamp(napi_env env, napi_callback_info info);
 	static napi_value UseLog(napi_env env, napi_callback_info info);
 
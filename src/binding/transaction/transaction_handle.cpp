@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>
 #include <sstream>
 #include <thread>
@@ -43,6 +44,52 @@ struct ScopedAsyncWorkRegistration {
 	}
 };
 
+/**
+ * Collects the distinct keys a write batch touches, up to `MAX_KEYS`, so a
+ * commit conflict can be attributed to them.
+ */
+struct WriteBatchKeyCollector final : rocksdb::WriteBatch::Handler {
+	static constexpr size_t MAX_KEYS = 64;
+
+	std::vector<std::pair<uint32_t, std::string>> keys;
+
+	rocksdb::Status PutCF(uint32_t columnFamilyId, const rocksdb::Slice& key, const rocksdb::Slice&) override {
+		return this->add(columnFamilyId, key);
+	}
+
+	rocksdb::Status DeleteCF(uint32_t columnFamilyId, const rocksdb::Slice& key) override {
+		return this->add(columnFamilyId, key);
+	}
+
+	rocksdb::Status SingleDeleteCF(uint32_t columnFamilyId, const rocksdb::Slice& key) override {
+		return this->add(columnFamilyId, key);
+	}
+
+	rocksdb::Status MergeCF(uint32_t columnFamilyId, const rocksdb::Slice& key, const rocksdb::Slice&) override {
+		return this->add(columnFamilyId, key);
+	}
+
+	rocksdb::Status DeleteRangeCF(uint32_t, const rocksdb::Slice&, const rocksdb::Slice&) override {
+		// a range is not a key it could have conflicted on
+		return rocksdb::Status::OK();
+	}
+
+	bool Continue() override {
+		return this->keys.size() < MAX_KEYS;
+	}
+
+private:
+	rocksdb::Status add(uint32_t columnFamilyId, const rocksdb::Slice& key) {
+		for (const auto& [id, existing] : this->keys) {
+			if (id == columnFamilyId && key == existing) {
+				return rocksdb::Status::OK();
+			}
+		}
+		this->keys.emplace_back(columnFamilyId, key.ToString());
+		return rocksdb::Status::OK();
+	}
+};
+
 template<typename State>
 struct PendingAsyncState {
 	napi_env env;
@@ -76,19 +123,21 @@ struct PendingAsyncState {
 } // namespace
 
 /**
- * Creates a new RocksDB transaction, enables snapshots, and sets the
- * transaction id.
+ * Creates a new RocksDB transaction (unless read-only), enables snapshots, and
+ * sets the transaction id.
  */
 TransactionHandle::TransactionHandle(
 	std::shared_ptr<DBHandle> dbHandle,
 	napi_env env,
 	napi_ref jsDatabaseRef,
-	bool disableSnapshot
+	bool disableSnapshot,
+	bool readOnly
 ) :
 	dbHandle(dbHandle),
 	env(env),
 	jsDatabaseRef(jsDatabaseRef),
 	disableSnapshot(disableSnapshot),
+	readOnly(readOnly),
 	coordinatedRetry(false),
 	state(TransactionState::Pending),
 	txn(nullptr),
@@ -101,30 +150,24 @@ TransactionHandle::TransactionHandle(
 }
 
 void TransactionHandle::resetTransaction(){
-	// clear/delete the previous transaction and create a new transaction so that it can be retried
-	if (this->txn) {
-		this->txn->ClearSnapshot();
-		delete this->txn;
-	}
-
 	this->logEntryBatch.reset();
+	this->savepoints.clear();
+	this->rangeRemovalPartitions.clear();
+	this->hasRangeRemoval = false;
 	this->snapshotSet = false; // snapshot flag so it will be reapplied
 
-	auto dbHandle = this->dbHandle;
-	rocksdb::WriteOptions writeOptions;
-	writeOptions.disableWAL = dbHandle->disableWAL;
-
-	if (dbHandle->descriptor->mode == DBMode::Pessimistic) {
-		auto* tdb = static_cast<rocksdb::TransactionDB*>(dbHandle->descriptor->db.get());
-		rocksdb::TransactionOptions txnOptions;
-		this->txn = tdb->BeginTransaction(writeOptions, txnOptions);
-	} else if (dbHandle->descriptor->mode == DBMode::Optimistic) {
-		auto* odb = static_cast<rocksdb::OptimisticTransactionDB*>(dbHandle->descriptor->db.get());
-		rocksdb::OptimisticTransactionOptions txnOptions;
-		this->txn = odb->BeginTransaction(writeOptions, txnOptions);
-	} else {
-		throw rocksdb_js::DBException("Invalid database");
+	if (this->readOnly) {
+		// nothing to begin: reads pin their own snapshot via ensureSnapshot()
+		this->readOnlySnapshot.reset();
+		return;
 	}
+
+	rocksdb::WriteOptions writeOptions;
+	writeOptions.disableWAL = this->dbHandle->disableWAL;
+
+	// re-initialize the previous transaction in place so that it can be
+	// retried, or begin one (reusing a pooled transaction if available)
+	this->txn = this->dbHandle->descriptor->transactionBegin(writeOptions, this->txn);
 }
 
 /**
@@ -146,9 +189,13 @@ TransactionHandle::~TransactionHandle() {
  * });
  * ```
  */
-void TransactionHandle::addLogEntry(std::unique_ptr<TransactionLogEntry> entry) {
-	DEBUG_LOG("%p TransactionHandle::addLogEntry Adding log entry to store \"%s\" for transaction %u (size=%zu)\n",
-		this, entry->store->name.c_str(), this->id, entry->size);
+void TransactionHandle::addLogEntry(const std::shared_ptr<TransactionLogStore>& store, const char* data, uint32_t size) {
+	DEBUG_LOG("%p TransactionHandle::addLogEntry Adding log entry to store \"%s\" for transaction %u (size=%u)\n",
+		this, store->name.c_str(), this->id, size);
+
+	if (this->readOnly) {
+		throw rocksdb_js::DBException("Transaction " + std::to_string(this->id) + " is read-only");
+	}
 
 	// #668 (defense in depth): the write-ahead log is write-once per transaction. If
 	// committedPosition is already set, this transaction's batch was durably written by a
@@ -171,7 +218,7 @@ void TransactionHandle::addLogEntry(std::unique_ptr<TransactionLogEntry> entry)
 	auto currentBoundStore = this->boundLogStore.lock();
 	if (currentBoundStore) {
 		// transaction is already bound to a log store
-		if (currentBoundStore->name != entry->store->name) {
+		if (currentBoundStore->name != store->name) {
 			std::string errorMessage = "Transaction " + std::to_string(this->id) + " is already bound to the log store \"" + currentBoundStore->name + "\"";
 			throw rocksdb_js::DBException(errorMessage);
 		}
@@ -180,21 +227,24 @@ void TransactionHandle::addLogEntry(std::unique_ptr<TransactionLogEntry> entry)
 		// respect to tryClose()'s phase-3 check-and-mark-closing sequence.
 		// transactionBindMutex is never held during I/O, so this cannot stall the
 		// event loop the way holding writeMutex here would.
-		std::lock_guard<std::mutex> lock(entry->store->transactionBindMutex);
-		if (entry->store->isClosing.load(std::memory_order_relaxed)) {
+		std::lock_guard<std::mutex> lock(store->transactionBindMutex);
+		if (store->isClosing.load(std::memory_order_relaxed)) {
 			throw rocksdb_js::DBException("Transaction log store is closed");
 		}
-		this->boundLogStore = entry->store;
-		entry->store->pendingTransactionCount++;
+		this->boundLogStore = store;
+		store->pendingTransactionCount++;
 		DEBUG_LOG("%p TransactionHandle::addLogEntry Binding transaction %u to log store \"%s\"\n",
-			this, this->id, entry->store->name.c_str());
+			this, this->id, store->name.c_str());
 	}
 
 	if (!this->logEntryBatch) {
-		this->logEntryBatch = std::make_unique<TransactionLogEntryBatch>(this->startTimestamp);
+		this->logEntryBatch = std::make_unique<TransactionLogEntryBatch>(
+			this->startTimestamp,
+			this->dbHandle->descriptor->logArenaPool
+		);
 	}
 
-	this->logEntryBatch->addEntry(std::move(entry));
+	this->logEntryBatch->addEntry(data, size);
 }
 
 void TransactionHandle::lockVTSlot(
@@ -227,22 +277,172 @@ void TransactionHandle::lockVTSlot(
 	}
 }
 
-void TransactionHandle::releaseIntent() {
-	if (!lockedVTSlots.empty()) {
+void TransactionHandle::releaseIntent(size_t keep) {
+	if (lockedVTSlots.size() > keep) {
 		// The trackers were created via the VT, so it is materialized and
 		// getVerificationTableRaw() returns it. releaseWriteIntent drops this
 		// transaction's holder reference under the writer mutex; the slot is
 		// only cleared (and waiters woken) when the last holder releases.
 		auto* vt = DBSettings::getInstance().getVerificationTableRaw();
 		if (vt) {
-			for (size_t i = 0; i < lockedVTSlots.size(); i++) {
+			for (size_t i = keep; i < lockedVTSlots.size(); i++) {
 				vt->releaseWriteIntent(lockedVTSlots[i], heldTrackers[i]);
 			}
 		}
+		lockedVTSlots.resize(keep);
+		heldTrackers.resize(keep);
+	}
+}
+
+void TransactionHandle::recordCommitConflict() {
+	auto descriptor = this->dbHandle->descriptor;
+	if (!descriptor->conflictProfiler.enabled() || !this->txn) {
+		return;
+	}
+
+	WriteBatchKeyCollector collector;
+	this->txn->GetWriteBatch()->GetWriteBatch()->Iterate(&collector);
+
+	// resolve the column family ids in the batch, keeping the handles alive
+	// while the keys are re-read
+	std::vector<std::shared_ptr<rocksdb::ColumnFamilyHandle>> columns;
+	{
+		std::lock_guard<std::mutex> lock(descriptor->columnsMutex);
+		for (auto& [name, column] : descriptor->columns) {
+			columns.push_back(column->column);
+		}
+	}
+	auto findColumn = [&columns](uint32_t id) -> rocksdb::ColumnFamilyHandle* {
+		for (auto& column : columns) {
+			if (column->GetID() == id) {
+				return column.get();
+			}
+		}
+		return nullptr;
+	};
+
+	// keep the keys another transaction committed since our snapshot, which
+	// is what optimistic validation failed on
+	const rocksdb::Snapshot* snapshot = this->txn->GetSnapshot();
+	std::vector<std::string> names;
+	std::vector<const std::string*> keys;
+	names.reserve(collector.keys.size());
+	for (auto& [columnFamilyId, key] : collector.keys) {
+		rocksdb::ColumnFamilyHandle* column = findColumn(columnFamilyId);
+		if (!column) {
+			continue;
+		}
+		if (snapshot) {
+			rocksdb::ReadOptions readOptions;
+			readOptions.snapshot = snapshot;
+			std::string before, after;
+			rocksdb::Status beforeStatus = descriptor->db->Get(readOptions, column, key, &before);
+			rocksdb::Status afterStatus = descriptor->db->Get(rocksdb::ReadOptions(), column, key, &after);
+			if (beforeStatus.code() == afterStatus.code() && before == after) {
+				continue;
+			}
+		}
+		names.push_back(column->GetName());
+		keys.push_back(&key);
 	}
 
-	lockedVTSlots.clear();
-	heldTrackers.clear();
+	std::vector<ConflictKey> conflictKeys;
+	conflictKeys.reserve(keys.size());
+	for (size_t i = 0; i < keys.size(); i++) {
+		conflictKeys.push_back({ names[i], *keys[i] });
+	}
+	descriptor->conflictProfiler.record(conflictKeys, this->conflictRetries);
+}
+
+void TransactionHandle::recordWriteConflict(const std::shared_ptr<DBHandle>& dbHandle, const rocksdb::Slice& key) {
+	auto& profiler = dbHandle->descriptor->conflictProfiler;
+	if (!profiler.enabled()) {
+		return;
+	}
+	std::string name = dbHandle->getColumnFamilyHandle()->GetName();
+	profiler.record({ { name, std::string_view(key.data(), key.size()) } }, this->conflictRetries);
+}
+
+rocksdb::Status TransactionHandle::setSavepoint() {
+	if (!this->active()) {
+		return rocksdb::Status::Aborted("Transaction is closed");
+	}
+	if (this->state != TransactionState::Pending) {
+		return rocksdb::Status::Aborted("Transaction is not in pending state");
+	}
+
+	if (this->txn) {
+		this->txn->SetSavePoint();
+	}
+	this->savepoints.push_back({
+		this->logEntryBatch ? this->logEntryBatch->entries().size() : 0,
+		this->lockedVTSlots.size()
+	});
+	return rocksdb::Status::OK();
+}
+
+rocksdb::Status TransactionHandle::rollbackToSavepoint() {
+	if (!this->active()) {
+		return rocksdb::Status::Aborted("Transaction is closed");
+	}
+	if (this->state != TransactionState::Pending) {
+		return rocksdb::Status::Aborted("Transaction is not in pending state");
+	}
+	if (this->savepoints.empty()) {
+		return rocksdb::Status::NotFound("No savepoint has been set");
+	}
+	if (this->hasRangeRemoval) {
+		// rolling back rebuilds the write batch index, which cannot index the
+		// range tombstone
+		return rocksdb::Status::NotSupported("Cannot roll back to a savepoint after removing a range");
+	}
+
+	if (this->txn) {
+		rocksdb::Status status = this->txn->RollbackToSavePoint();
+		if (!status.ok()) {
+			return status;
+		}
+	}
+
+	TransactionSavepoint savepoint = this->savepoints.back();
+	this->savepoints.pop_back();
+
+	if (this->logEntryBatch) {
+		if (savepoint.logEntryCount == 0) {
+			// don't commit an empty batch; the store binding is released on close
+			this->logEntryBatch.reset();
+		} else {
+			this->logEntryBatch->truncate(savepoint.logEntryCount);
+		}
+	}
+
+	// Write intents are appended once per write, so those past the savepoint's
+	// count belong to the writes just undone. A slot also written before the
+	// savepoint keeps this transaction's earlier holder reference.
+	this->releaseIntent(savepoint.lockedVTSlotCount);
+
+	return rocksdb::Status::OK();
+}
+
+rocksdb::Status TransactionHandle::popSavepoint() {
+	if (!this->active()) {
+		return rocksdb::Status::Aborted("Transaction is closed");
+	}
+	if (this->state != TransactionState::Pending) {
+		return rocksdb::Status::Aborted("Transaction is not in pending state");
+	}
+	if (this->savepoints.empty()) {
+		return rocksdb::Status::NotFound("No savepoint has been set");
+	}
+
+	if (this->txn) {
+		rocksdb::Status status = this->txn->PopSavePoint();
+		if (!status.ok()) {
+			return status;
+		}
+	}
+	this->savepoints.pop_back();
+	return rocksdb::Status::OK();
 }
 
 /**
@@ -262,7 +462,7 @@ void TransactionHandle::close() {
 		this->dbHandle->descriptor->transactionRemove(shared_from_this());
 	}
 
-	if (!this->txn) {
+	if (!this->txn && !this->readOnly) {
 		return;
 	}
 
@@ -317,10 +517,18 @@ void TransactionHandle::close() {
 		this->releaseIntent();
 	}
 
-	// destroy the RocksDB transaction
-	this->txn->ClearSnapshot();
-	delete this->txn;
-	this->txn = nullptr;
+	// return the RocksDB transaction to the descriptor's pool, or release the
+	// read-only snapshot
+	if (this->txn) {
+		if (this->dbHandle && this->dbHandle->descriptor) {
+			this->dbHandle->descriptor->transactionRecycle(this->txn);
+		} else {
+			this->txn->ClearSnapshot();
+			delete this->txn;
+		}
+		this->txn = nullptr;
+	}
+	this->readOnlySnapshot.reset();
 
 	if (this->jsDatabaseRef != nullptr) {
 		if (std::this_thread::get_id() == this->envThreadId) {
@@ -358,6 +566,7 @@ napi_value TransactionHandle::get(
 	std::shared_ptr<DBHandle> dbHandleOverride,
 	std::atomic<uint64_t>* vtSlot,
 	uint64_t observedSlot,
+	uint64_t observedClearGen,
 	bool hasExpectedVersion,
 	uint64_t expectedVersion,
 	bool wantsPopulate
@@ -367,7 +576,7 @@ napi_value TransactionHandle::get(
 	// the middle of this setup. Async fallback transfers this registration to its
 	// state; synchronous and failed setup paths release it on return.
 	ScopedAsyncWorkRegistration transactionRegistration(this);
-	if (this->isCancelled() || !this->txn) {
+	if (this->isCancelled() || !this->active()) {
 		::napi_throw_error(env, nullptr, "Transaction is closed");
 		return nullptr;
 	}
@@ -378,12 +587,21 @@ napi_value TransactionHandle::get(
 		return nullptr;
 	}
 
-	if (!this->disableSnapshot && !this->snapshotSet) {
-		this->snapshotSet = true;
-		this->txn->SetSnapshot();
-	}
+	this->ensureSnapshot();
 
 	napi_value returnStatus;
+	// Same check as getSync, counted the same way: the caller's version matches
+	// the table, so resolve FRESH without a read.
+	if (vtSlot && hasExpectedVersion && vtCheckVersion(observedSlot, expectedVersion)) {
+		napi_value global;
+		napi_value freshResult;
+		NAPI_STATUS_THROWS(::napi_get_global(env, &global));
+		NAPI_STATUS_THROWS(::napi_create_int32(env, FRESH_VERSION_FLAG, &freshResult));
+		NAPI_STATUS_THROWS(::napi_call_function(env, global, resolve, 1, &freshResult, nullptr));
+		NAPI_STATUS_THROWS(::napi_create_uint32(env, 0, &returnStatus));
+		return returnStatus;
+	}
+
 	std::string value;
 	std::shared_ptr<DBHandle> dbHandle = dbHandleOverride ? dbHandleOverride : this->dbHandle;
 	// Cross-column-family reads enter through another DBHandle. Register against
@@ -397,12 +615,10 @@ napi_value TransactionHandle::get(
 	auto readColumnDescriptor = dbHandle->columnDescriptor;
 
 	rocksdb::ReadOptions readOptions;
-	if (this->snapshotSet) {
-		readOptions.snapshot = this->txn->GetSnapshot();
-	}
+	readOptions.snapshot = this->readSnapshot();
 	readOptions.read_tier = rocksdb::kBlockCacheTier;
 
-	rocksdb::Status status = this->txn->Get(
+	rocksdb::Status status = this->readValue(
 		readOptions,
 		readColumnDescriptor->column.get(),
 		key,
@@ -420,7 +636,8 @@ napi_value TransactionHandle::get(
 			uint64_t extracted = VerificationTable::extractVersionFromValue(valueSlice);
 			const rocksdb::Snapshot* readSnapshot = this->readSnapshot();
 			if (hasExpectedVersion && extracted != 0 && extracted == expectedVersion) {
-				vtPopulateIfSettled(dbHandle, vtSlot, rocksdb::Slice(key.data(), key.size()), extracted, readSnapshot, observedSlot);
+				vtCount(VTCounter::SoftMiss);
+				vtPopulateIfSettled(dbHandle, vtSlot, rocksdb::Slice(key.data(), key.size()), extracted, readSnapshot, observedSlot, observedClearGen);
 				napi_value global, freshResult;
 				::napi_get_global(env, &global);
 				::napi_create_int32(env, FRESH_VERSION_FLAG, &freshResult);
@@ -429,7 +646,7 @@ napi_value TransactionHandle::get(
 				return returnStatus;
 			}
 			if ((hasExpectedVersion || wantsPopulate) && extracted != 0) {
-				vtPopulateIfSettled(dbHandle, vtSlot, rocksdb::Slice(key.data(), key.size()), extracted, readSnapshot, observedSlot);
+				vtPopulateIfSettled(dbHandle, vtSlot, rocksdb::Slice(key.data(), key.size()), extracted, readSnapshot, observedSlot, observedClearGen);
 			}
 		}
 		return resolveGetSyncResult(env, "Transaction get failed", status, value, resolve, reject);
@@ -452,9 +669,15 @@ napi_value TransactionHandle::get(
 	// Resolve and pin the caller's column family on the JS thread. The worker
 	// releases this descriptor before signaling completion so the native column
 	// family handle cannot outlive its RocksDB database during teardown.
+	if (vtSlot) {
+		state->vtPartition = VerificationTable::partitionFor(
+			dbHandle->descriptor->vtEpoch, readColumnDescriptor->column->GetID()
+		);
+	}
 	state->readColumnDescriptor = std::move(readColumnDescriptor);
 	state->vtSlot = vtSlot;
 	state->vtObserved = observedSlot;
+	state->vtClearGen = observedClearGen;
 	state->hasExpectedVersion = hasExpectedVersion;
 	state->expectedVersion = expectedVersion;
 	state->wantsPopulate = wantsPopulate;
@@ -470,7 +693,7 @@ napi_value TransactionHandle::get(
 			if (!state->handle || state->handle->isCancelled()) {
 				state->status = rocksdb::Status::Aborted("Database closed during transaction get operation");
 			} else {
-				state->status = state->handle->txn->Get(
+				state->status = state->handle->readValue(
 					state->readOptions,
 					state->readColumnDescriptor->column.get(),
 					state->key,
@@ -515,7 +738,7 @@ void TransactionHandle::getCount(
 ) {
 	this->ensureSnapshot();
 	if (this->snapshotSet) {
-		itOptions.readOptions.snapshot = this->txn->GetSnapshot();
+		itOptions.readOptions.snapshot = this->readSnapshot();
 	}
 
 	std::unique_ptr<DBIteratorHandle> itHandle =
@@ -534,7 +757,7 @@ rocksdb::Status TransactionHandle::getSync(
 	rocksdb::ReadOptions& readOptions,
 	std::shared_ptr<DBHandle> dbHandleOverride
 ) {
-	if (!this->txn) {
+	if (!this->active()) {
 		return rocksdb::Status::Aborted("Transaction is closed");
 	}
 
@@ -546,23 +769,124 @@ rocksdb::Status TransactionHandle::getSync(
 	this->ensureSnapshot();
 
 	if (this->snapshotSet) {
-		readOptions.snapshot = this->txn->GetSnapshot();
+		readOptions.snapshot = this->readSnapshot();
 	}
 
 	std::shared_ptr<DBHandle> dbHandle = dbHandleOverride ? dbHandleOverride : this->dbHandle;
 	auto column = dbHandle->getColumnFamilyHandle();
 
 	// TODO: should this be GetForUpdate?
-	return this->txn->Get(readOptions, column, key, &result);
+	return this->readValue(readOptions, column, key, &result);
+}
+
+/**
+ * Get a batch of values in one read through the transaction.
+ */
+rocksdb::Status TransactionHandle::getMany(
+	const std::vector<rocksdb::Slice>& keys,
+	std::vector<rocksdb::PinnableSlice>& values,
+	std::vector<rocksdb::Status>& statuses,
+	rocksdb::ReadOptions& readOptions,
+	bool forUpdate
+) {
+	if (!this->active()) {
+		return rocksdb::Status::Aborted("Transaction is closed");
+	}
+
+	if (this->state != TransactionState::Pending) {
+		DEBUG_LOG("%p TransactionHandle::getMany Transaction is not in pending state (state=%d)\n", this, this->state);
+		return rocksdb::Status::Aborted("Transaction is not in pending state");
+	}
+
+	if (forUpdate && this->readOnly) {
+		return rocksdb::Status::NotSupported("Transaction is read-only");
+	}
+
+	this->ensureSnapshot();
+
+	if (this->snapshotSet) {
+		readOptions.snapshot = this->readSnapshot();
+	}
+
+	auto column = this->dbHandle->getColumnFamilyHandle();
+	values.resize(keys.size());
+	statuses.resize(keys.size());
+
+	if (forUpdate) {
+		// MultiGetForUpdate has no PinnableSlice overload, so pin the copies
+		std::vector<rocksdb::ColumnFamilyHandle*> columns(keys.size(), column);
+		std::vector<std::string> copies;
+		statuses = this->txn->MultiGetForUpdate(readOptions, columns, keys, &copies);
+		for (size_t i = 0; i < keys.size(); i++) {
+			if (statuses[i].ok()) {
+				values[i].PinSelf(copies[i]);
+			} else if (statuses[i].IsBusy() || statuses[i].IsTimedOut()) {
+				this->recordWriteConflict(this->dbHandle, keys[i]);
+			}
+		}
+	} else if (this->readOnly) {
+		this->dbHandle->descriptor->db->MultiGet(
+			readOptions, column, keys.size(), keys.data(), values.data(), statuses.data()
+		);
+	} else {
+		this->txn->MultiGet(
+			readOptions, column, keys.size(), keys.data(), values.data(), statuses.data()
+		);
+	}
+
+	return rocksdb::Status::OK();
 }
 
 void TransactionHandle::ensureSnapshot() {
-	if (this->txn && !this->disableSnapshot && !this->snapshotSet) {
-		this->snapshotSet = true;
+	if (!this->active() || this->disableSnapshot || this->snapshotSet) {
+		return;
+	}
+	this->snapshotSet = true;
+	if (this->readOnly) {
+		this->readOnlySnapshot = std::make_unique<rocksdb::ManagedSnapshot>(this->dbHandle->descriptor->db.get());
+	} else {
 		this->txn->SetSnapshot();
 	}
 }
 
+rocksdb::Status TransactionHandle::readValue(
+	const rocksdb::ReadOptions& readOptions,
+	rocksdb::ColumnFamilyHandle* column,
+	const rocksdb::Slice& key,
+	std::string* value
+) {
+	if (this->readOnly) {
+		return this->dbHandle->descriptor->db->Get(readOptions, column, key, value);
+	}
+	return this->txn->Get(readOptions, column, key, value);
+}
+
+rocksdb::Status TransactionHandle::readValue(
+	const rocksdb::ReadOptions& readOptions,
+	rocksdb::ColumnFamilyHandle* column,
+	const rocksdb::Slice& key,
+	rocksdb::PinnableSlice* value
+) {
+	if (this->readOnly) {
+		return this->dbHandle->descriptor->db->Get(readOptions, column, key, value);
+	}
+	return this->txn->Get(readOptions, column, key, value);
+}
+
+rocksdb::Iterator* TransactionHandle::newIterator(
+	rocksdb::ReadOptions& readOptions,
+	rocksdb::ColumnFamilyHandle* column
+) {
+	if (this->readOnly) {
+		// a read-only transaction has no write batch to merge, so a plain
+		// iterator at the pinned snapshot gives the same view as its reads
+		this->ensureSnapshot();
+		readOptions.snapshot = this->readSnapshot();
+		return this->dbHandle->descriptor->db->NewIterator(readOptions, column);
+	}
+	return this->txn->GetIterator(readOptions, column);
+}
+
 /**
  * Put a value using the specified database handle.
  */
@@ -571,10 +895,14 @@ rocksdb::Status TransactionHandle::putSync(
 	rocksdb::Slice& value,
 	std::shared_ptr<DBHandle> dbHandleOverride
 ) {
-	if (!this->txn) {
+	if (!this->active()) {
 		return rocksdb::Status::Aborted("Transaction is closed");
 	}
 
+	if (this->readOnly) {
+		return rocksdb::Status::NotSupported("Transaction is read-only");
+	}
+
 	if (this->state != TransactionState::Pending) {
 		DEBUG_LOG("%p TransactionHandle::putSync Transaction is not in pending state (state=%d)\n", this, this->state);
 		return rocksdb::Status::Aborted("Transaction is not in pending state");
@@ -588,6 +916,9 @@ rocksdb::Status TransactionHandle::putSync(
 	std::shared_ptr<DBHandle> dbHandle = dbHandleOverride ? dbHandleOverride : this->dbHandle;
 	auto column = dbHandle->getColumnFamilyHandle();
 	rocksdb::Status status = this->txn->Put(column, key, value);
+	if (status.IsBusy() || status.IsTimedOut()) {
+		this->recordWriteConflict(dbHandle, key);
+	}
 
 	// Lock the VT slot for this key immediately on write. This ensures that
 	// any cached version of the key is invalidated as soon as it enters the
@@ -608,10 +939,14 @@ rocksdb::Status TransactionHandle::removeSync(
 	rocksdb::Slice& key,
 	std::shared_ptr<DBHandle> dbHandleOverride
 ) {
-	if (!this->txn) {
+	if (!this->active()) {
 		return rocksdb::Status::Aborted("Transaction is closed");
 	}
 
+	if (this->readOnly) {
+		return rocksdb::Status::NotSupported("Transaction is read-only");
+	}
+
 	if (this->state != TransactionState::Pending) {
 		DEBUG_LOG("%p TransactionHandle::removeSync Transaction is not in pending state (state=%d)\n", this, this->state);
 		return rocksdb::Status::Aborted("Transaction is not in pending state");
@@ -625,6 +960,46 @@ rocksdb::Status TransactionHandle::removeSync(
 	std::shared_ptr<DBHandle> dbHandle = dbHandleOverride ? dbHandleOverride : this->dbHandle;
 	auto column = dbHandle->getColumnFamilyHandle();
 	rocksdb::Status status = this->txn->Delete(column, key);
+	if (status.IsBusy() || status.IsTimedOut()) {
+		this->recordWriteConflict(dbHandle, key);
+	}
+
+	if (status.ok() && dbHandle->enableVerificationTable) {
+		this->lockVTSlot(dbHandle, key);
+	}
+
+	return status;
+}
+
+/**
+ * Merge a value using the specified database handle.
+ */
+rocksdb::Status TransactionHandle::mergeSync(
+	const rocksdb::Slice& key,
+	const rocksdb::Slice& payload,
+	std::shared_ptr<DBHandle> dbHandleOverride
+) {
+	if (!this->active()) {
+		return rocksdb::Status::Aborted("Transaction is closed");
+	}
+
+	if (this->readOnly) {
+		return rocksdb::Status::NotSupported("Transaction is read-only");
+	}
+
+	if (this->state != TransactionState::Pending) {
+		DEBUG_LOG("%p TransactionHandle::mergeSync Transaction is not in pending state (state=%d)\n", this, this->state);
+		return rocksdb::Status::Aborted("Transaction is not in pending state");
+	}
+
+	std::shared_ptr<DBHandle> dbHandle = dbHandleOverride ? dbHandleOverride : this->dbHandle;
+	std::string operand;
+	rocksdb::Status status = dbHandle->encodeMergeOperand(payload, operand);
+	if (!status.ok()) {
+		return status;
+	}
+
+	status = this->txn->MergeUntracked(dbHandle->getColumnFamilyHandle(), key, operand);
 
 	if (status.ok() && dbHandle->enableVerificationTable) {
 		this->lockVTSlot(dbHandle, key);
@@ -633,4 +1008,63 @@ rocksdb::Status TransactionHandle::removeSync(
 	return status;
 }
 
+/**
+ * Remove a key range using the specified database handle.
+ */
+rocksdb::Status TransactionHandle::removeRangeSync(
+	const rocksdb::Slice& start,
+	const rocksdb::Slice& end,
+	std::shared_ptr<DBHandle> dbHandleOverride
+) {
+	if (!this->active()) {
+		return rocksdb::Status::Aborted("Transaction is closed");
+	}
+
+	if (this->readOnly) {
+		return rocksdb::Status::NotSupported("Transaction is read-only");
+	}
+
+	if (this->state != TransactionState::Pending) {
+		DEBUG_LOG("%p TransactionHandle::removeRangeSync Transaction is not in pending state (state=%d)\n", this, this->state);
+		return rocksdb::Status::Aborted("Transaction is not in pending state");
+	}
+
+	std::shared_ptr<DBHandle> dbHandle = dbHandleOverride ? dbHandleOverride : this->dbHandle;
+	auto column = dbHandle->getColumnFamilyHandle();
+
+	// RocksDB transactions have no DeleteRange(): the write batch index cannot
+	// hold a range. The tombstone goes straight into the batch the commit
+	// writes instead, so it is applied atomically and in order with this
+	// transaction's other writes.
+	rocksdb::Status status = this->txn->GetWriteBatch()->GetWriteBatch()->DeleteRange(column, start, end);
+	if (!status.ok()) {
+		return status;
+	}
+	this->hasRangeRemoval = true;
+
+	// the range's keys cannot be enumerated, so the column family's whole
+	// partition is settled on commit
+	if (dbHandle->enableVerificationTable) {
+		uint8_t partition = VerificationTable::partitionFor(dbHandle->descriptor->vtEpoch, column->GetID());
+		if (std::find(this->rangeRemovalPartitions.begin(), this->rangeRemovalPartitions.end(), partition) == this->rangeRemovalPartitions.end()) {
+			this->rangeRemovalPartitions.push_back(partition);
+		}
+	}
+
+	return status;
+}
+
+void TransactionHandle::settleRangeRemovals() {
+	if (this->rangeRemovalPartitions.empty()) {
+		return;
+	}
+	auto* vt = DBSettings::getInstance().getVerificationTableRaw();
+	if (vt) {
+		for (uint8_t partition : this->rangeRemovalPartitions) {
+			vt->settlePartition(partition);
+		}
+	}
+	this->rangeRemovalPartitions.clear();
+}
+
 } // namespace rocksdb_js
@@ -9,6 +9,7 @@
 #include "database/db_handle.h"
 #include "iterator/db_iterator.h"
 #include "rocksdb/options.h"
+#include "rocksdb/snapshot.h"
 #include "rocksdb/utilities/transaction_db.h"
 #include "rocksdb/utilities/optimistic_transaction_db.h"
 #include "transaction_log/transaction_log_entry.h"
@@ -33,6 +34,22 @@ enum class TransactionState {
 	Aborted     // Transaction has been aborted/rolled back
 };
 
+/**
+ * What a transaction had buffered when a savepoint was set, so rolling back
+ * to it can drop what was added since.
+ */
+struct TransactionSavepoint final {
+	/**
+	 * The number of entries in the transaction's log entry batch.
+	 */
+	size_t logEntryCount;
+
+	/**
+	 * The number of VT write intents the transaction held.
+	 */
+	size_t lockedVTSlotCount;
+};
+
 /**
  * A handle to a RocksDB transaction. This is used to keep the transaction
  * alive until the transaction is committed or aborted.
@@ -68,6 +85,13 @@ struct TransactionHandle final : Closable, AsyncWorkHandle, std::enable_shared_f
 	 */
 	bool disableSnapshot;
 
+	/**
+	 * When true, the handle never begins a `rocksdb::Transaction`: reads go
+	 * straight to the database at `readOnlySnapshot`, writes are rejected, and
+	 * commit just closes the handle without dispatching to a commit lane.
+	 */
+	bool readOnly;
+
 	/**
 	 * When true, IsBusy at commit time is signalled back to JS as RETRY_NOW
 	 * (a non-error resolution) instead of a rejection. The native layer may
@@ -102,6 +126,12 @@ struct TransactionHandle final : Closable, AsyncWorkHandle, std::enable_shared_f
 	 */
 	rocksdb::Transaction* txn;
 
+	/**
+	 * The snapshot a read-only transaction reads at, pinned on first read like
+	 * the read-write transaction's snapshot.
+	 */
+	std::unique_ptr<rocksdb::ManagedSnapshot> readOnlySnapshot;
+
 	/**
 	 * One-shot close gate: set to true by the first close() caller. Subsequent
 	 * callers from any thread return immediately. Mirrors DBDescriptor::closing.
@@ -143,6 +173,24 @@ struct TransactionHandle final : Closable, AsyncWorkHandle, std::enable_shared_f
 	 */
 	std::vector<LockTracker*> heldTrackers;
 
+	/**
+	 * Savepoints set by `setSavepoint()`, most recent last. Mirrors the
+	 * RocksDB transaction's savepoint stack.
+	 */
+	std::vector<TransactionSavepoint> savepoints;
+
+	/**
+	 * The verification-table partitions of the column families this
+	 * transaction removed a key range from, settled once it commits.
+	 */
+	std::vector<uint8_t> rangeRemovalPartitions;
+
+	/**
+	 * Whether a key range was removed. The range tombstone is written to the
+	 * raw write batch, which savepoints cannot roll back past.
+	 */
+	bool hasRangeRemoval = false;
+
 	/**
 	 * A weak reference to the transaction log store this transaction is bound to.
 	 * Once set, a transaction can only add entries to this specific log store.
@@ -155,16 +203,60 @@ struct TransactionHandle final : Closable, AsyncWorkHandle, std::enable_shared_f
 	 */
 	LogPosition committedPosition;
 
+	/**
+	 * The number of times the transaction has been reset after a commit
+	 * conflict. Survives `resetTransaction()` and is recorded with each
+	 * conflict by the database's conflict profiler.
+	 */
+	uint32_t conflictRetries = 0;
+
 	TransactionHandle(
 		std::shared_ptr<DBHandle> dbHandle,
 		napi_env env,
 		napi_ref jsDatabaseRef,
-		bool disableSnapshot = false
+		bool disableSnapshot = false,
+		bool readOnly = false
 	);
 	~TransactionHandle();
 
 	void resetTransaction();
 
+	/**
+	 * Whether the handle can still serve reads: a read-write transaction until
+	 * its `rocksdb::Transaction` is destroyed, a read-only one until it is
+	 * closed.
+	 */
+	bool active() const {
+		return this->readOnly ? !this->closed.load() : this->txn != nullptr;
+	}
+
+	/**
+	 * Reads a key through the RocksDB transaction, or directly from the
+	 * database for a read-only transaction.
+	 */
+	rocksdb::Status readValue(
+		const rocksdb::ReadOptions& readOptions,
+		rocksdb::ColumnFamilyHandle* column,
+		const rocksdb::Slice& key,
+		std::string* value
+	);
+	rocksdb::Status readValue(
+		const rocksdb::ReadOptions& readOptions,
+		rocksdb::ColumnFamilyHandle* column,
+		const rocksdb::Slice& key,
+		rocksdb::PinnableSlice* value
+	);
+
+	/**
+	 * Creates an iterator that observes this transaction: its write batch and
+	 * the caller's read options for a read-write transaction, the pinned
+	 * snapshot for a read-only one.
+	 */
+	rocksdb::Iterator* newIterator(
+		rocksdb::ReadOptions& readOptions,
+		rocksdb::ColumnFamilyHandle* column
+	);
+
 	/**
 	 * Attempts to install a LockTracker in the VT slot for (db, cf, key),
 	 * tagging it as "write in flight". Called at putSync/removeSync time
@@ -178,16 +270,54 @@ struct TransactionHandle final : Closable, AsyncWorkHandle, std::enable_shared_f
 	void lockVTSlot(const std::shared_ptr<DBHandle>& dbHandle, const rocksdb::Slice& key);
 
 	/**
-	 * Releases all VT slots locked by this transaction. CASes each slot back
-	 * to 0 and frees the associated LockTracker. Clears lockedVTSlots and
-	 * heldTrackers.
+	 * Releases the VT slots locked by this transaction after the first `keep`.
+	 * CASes each slot back to 0 and frees the associated LockTracker once its
+	 * last holder releases, and truncates lockedVTSlots and heldTrackers.
 	 *
-	 * Called from the libuv execute thread after txn->Commit() (success or
-	 * IsBusy), and from close() to clean up orphaned locks.
+	 * Called with `keep == 0` from the libuv execute thread after
+	 * txn->Commit() (success or IsBusy) and from close() to clean up orphaned
+	 * locks, and with the savepoint's count by rollbackToSavepoint().
+	 */
+	void releaseIntent(size_t keep = 0);
+
+	/**
+	 * Records a failed optimistic commit with the database's conflict profiler.
+	 * RocksDB does not report which key conflicted, so the keys in the write
+	 * batch whose committed value changed since the transaction's snapshot are
+	 * attributed (every written key when there is no snapshot). Must be called
+	 * before `resetTransaction()` discards the write batch. A no-op when the
+	 * profiler is disabled.
 	 */
-	void releaseIntent();
+	void recordCommitConflict();
 
-	void addLogEntry(std::unique_ptr<TransactionLogEntry> entry);
+	/**
+	 * Records a write or locking read that failed with Busy or TimedOut, as a
+	 * pessimistic transaction does when another transaction holds the key's
+	 * lock. A no-op when the profiler is disabled.
+	 */
+	void recordWriteConflict(const std::shared_ptr<DBHandle>& dbHandle, const rocksdb::Slice& key);
+
+	/**
+	 * Sets a savepoint that `rollbackToSavepoint()` can undo back to.
+	 */
+	rocksdb::Status setSavepoint();
+
+	/**
+	 * Undoes the writes, log entries and VT write intents added since the most
+	 * recent savepoint, and removes that savepoint.
+	 */
+	rocksdb::Status rollbackToSavepoint();
+
+	/**
+	 * Removes the most recent savepoint without undoing anything.
+	 */
+	rocksdb::Status popSavepoint();
+
+	/**
+	 * Binds this transaction to `store` (on first use) and appends a copy of
+	 * the entry data to the transaction's log entry batch.
+	 */
+	void addLogEntry(const std::shared_ptr<TransactionLogStore>& store, const char* data, uint32_t size);
 
 	void close() override;
 
@@ -199,6 +329,7 @@ struct TransactionHandle final : Closable, AsyncWorkHandle, std::enable_shared_f
 		std::shared_ptr<DBHandle> dbHandleOverride = nullptr,
 		std::atomic<uint64_t>* vtSlot = nullptr,
 		uint64_t observedSlot = 0,
+		uint64_t observedClearGen = 0,
 		bool hasExpectedVersion = false,
 		uint64_t expectedVersion = 0,
 		bool wantsPopulate = false
@@ -226,6 +357,20 @@ struct TransactionHandle final : Closable, AsyncWorkHandle, std::enable_shared_f
 		std::shared_ptr<DBHandle> dbHandleOverride = nullptr
 	);
 
+	/**
+	 * Reads a batch of keys in one `MultiGet` at the transaction's snapshot,
+	 * filling `values` and `statuses` (one per key). With `forUpdate`, reads
+	 * via `MultiGetForUpdate` instead: a pessimistic transaction locks every
+	 * key, an optimistic one tracks them for commit-time conflict detection.
+	 */
+	rocksdb::Status getMany(
+		const std::vector<rocksdb::Slice>& keys,
+		std::vector<rocksdb::PinnableSlice>& values,
+		std::vector<rocksdb::Status>& statuses,
+		rocksdb::ReadOptions& readOptions,
+		bool forUpdate
+	);
+
 	/**
 	 * Lazily establishes the transaction's read snapshot (unless snapshots are
 	 * disabled or already set). Any read path that may satisfy a read from the
@@ -246,9 +391,13 @@ struct TransactionHandle final : Closable, AsyncWorkHandle, std::enable_shared_f
 	 * relative to a newer write (so it must re-read the latest).
 	 */
 	const rocksdb::Snapshot* readSnapshot() const {
-		return (this->txn && this->snapshotSet && !this->disableSnapshot)
-			? this->txn->GetSnapshot()
-			: nullptr;
+		if (!this->snapshotSet || this->disableSnapshot) {
+			return nullptr;
+		}
+		if (this->readOnly) {
+			return this->readOnlySnapshot ? this->readOnlySnapshot->snapshot() : nullptr;
+		}
+		return this->txn ? this->txn->GetSnapshot() : nullptr;
 	}
 
 	rocksdb::Status putSync(
@@ -261,6 +410,36 @@ struct TransactionHandle final : Closable, AsyncWorkHandle, std::enable_shared_f
 		rocksdb::Slice& key,
 		std::shared_ptr<DBHandle> dbHandleOverride = nullptr
 	);
+
+	/**
+	 * Merges `payload` into the key's value with the database handle's merge
+	 * operator when the transaction commits. Merges commute, so the key is
+	 * neither locked nor conflict checked: concurrent counters and appends
+	 * never retry.
+	 */
+	rocksdb::Status mergeSync(
+		const rocksdb::Slice& key,
+		const rocksdb::Slice& payload,
+		std::shared_ptr<DBHandle> dbHandleOverride = nullptr
+	);
+
+	/**
+	 * Removes the keys from `start` (inclusive) to `end` (exclusive) with a
+	 * single range tombstone written when the transaction commits. The range
+	 * is neither locked nor conflict checked, and reads in this transaction
+	 * still see the removed keys.
+	 */
+	rocksdb::Status removeRangeSync(
+		const rocksdb::Slice& start,
+		const rocksdb::Slice& end,
+		std::shared_ptr<DBHandle> dbHandleOverride = nullptr
+	);
+
+	/**
+	 * Settles the verification-table partitions of the ranges removed by
+	 * this transaction. Called once the transaction has committed.
+	 */
+	void settleRangeRemovals();
 };
 
 } // namespace rocksdb_js
@@ -249,6 +249,24 @@ napi_value TransactionLog::GetMemoryMapOfFile(napi_env env, napi_callback_info i
 	return result;
 }
 
+/**
+ * Hint that the log file with the given sequence number is about to be scanned
+ * sequentially from `offset`. A no-op unless `transactionLogReadAhead` is
+ * enabled.
+ */
+napi_value TransactionLog::AdviseReadAhead(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(2);
+	UNWRAP_TRANSACTION_LOG_HANDLE("AdviseReadAhead");
+	uint32_t sequenceNumber = 0;
+	uint32_t offset = 0;
+	NAPI_STATUS_THROWS(::napi_get_value_uint32(env, argv[0], &sequenceNumber));
+	NAPI_STATUS_THROWS(::napi_get_value_uint32(env, argv[1], &offset));
+	size_t advised = (*txnLogHandle)->adviseReadAhead(sequenceNumber, offset);
+	napi_value result;
+	NAPI_STATUS_THROWS(::napi_create_double(env, static_cast<double>(advised), &result));
+	return result;
+}
+
 /**
  * Find the position in the transaction logs with a transaction equal to or greater than the provided timestamp.
  */
@@ -360,6 +378,8 @@ napi_value TransactionLog::GetStats(napi_env env, napi_callback_info info) {
 	SET_STAT(memory, "mappedBytes", s.mappedBytes);
 	SET_STAT(memory, "overlayBytes", s.overlayBytes);
 	SET_STAT(memory, "activeMaps", s.activeMaps);
+	SET_STAT(memory, "residentBytes", s.residentBytes);
+	SET_STAT(memory, "nonResidentPages", s.nonResidentPages);
 	NAPI_STATUS_THROWS(::napi_set_named_property(env, result, "memory", memory));
 
 	// positions
@@ -394,6 +414,7 @@ napi_value TransactionLog::GetStats(napi_env env, napi_callback_info info) {
 	SET_STAT(totals, "purgeRuns", s.purgeRuns);
 	SET_STAT(totals, "databaseFlushes", s.databaseFlushes);
 	SET_STAT(totals, "writeFailures", s.writeFailures);
+	SET_STAT(totals, "readAheadBytes", s.readAheadBytes);
 	NAPI_STATUS_THROWS(::napi_set_named_property(env, result, "totals", totals));
 
 	// config
@@ -407,6 +428,217 @@ napi_value TransactionLog::GetStats(napi_env env, napi_callback_info info) {
 	return result;
 }
 
+// Returns an aborted status from a replay decoder when an N-API call fails.
+#define REPLAY_NAPI_STATUS_RETURN(call) \
+	do { \
+		if ((call) != napi_ok) { \
+			return rocksdb::Status::Aborted("Replay decode failed: " #call); \
+		} \
+	} while (0)
+
+// Builds the `{ startPosition, position, entriesReplayed, ... }` progress object
+// passed to the replay `onProgress` callback and returned from `_replay()`.
+static napi_value buildReplayProgressObject(napi_env env, const TransactionLogReplayProgress& progress) {
+	napi_value obj;
+	NAPI_STATUS_THROWS(::napi_create_object(env, &obj));
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, obj, "startPosition", buildPositionObject(env, progress.startPosition)));
+	NAPI_STATUS_THROWS(::napi_set_named_property(env, obj, "position", buildPositionObject(env, progress.position)));
+	SET_STAT(obj, "entriesReplayed", progress.entriesReplayed);
+	SET_STAT(obj, "bytesReplayed", progress.bytesReplayed);
+	SET_STAT(obj, "batchesWritten", progress.batchesWritten);
+	SET_STAT(obj, "operationsWritten", progress.operationsWritten);
+	SET_STAT(obj, "totalBytes", progress.totalBytes);
+	return obj;
+}
+
+/**
+ * Re-applies the log's entries from the last flushed position into the
+ * database with the WAL disabled, and returns the final progress.
+ *
+ * `decodeBatch(entries)` is called with groups of `{ timestamp, data, endTxn }`
+ * entries and must return a flat array of `key, value` Buffer pairs; a
+ * `undefined`/`null` value removes the key. The optional `onProgress(progress)`
+ * is called after each write batch and may return `false` to stop.
+ *
+ * @example
+ * ```typescript
+ * const log = db.useLog('foo');
+ * log._replay(
+ *   (entries) => entries.flatMap(({ data }) => decode(data)),
+ *   { batchBytes: 16 * 1024 * 1024, onProgress: (p) => console.log(p.bytesReplayed / p.totalBytes) }
+ * );
+ * ```
+ */
+napi_value TransactionLog::Replay(napi_env env, napi_callback_info info) {
+	NAPI_METHOD_ARGV(2);
+	UNWRAP_TRANSACTION_LOG_HANDLE("Replay");
+	THROW_IF_READONLY(*txnLogHandle, "");
+
+	napi_valuetype type;
+	NAPI_STATUS_THROWS(::napi_typeof(env, argv[0], &type));
+	if (type != napi_function) {
+		::napi_throw_type_error(env, nullptr, "Invalid argument, expected a decode batch function");
+		return nullptr;
+	}
+	napi_value decodeFn = argv[0];
+
+	TransactionLogReplayOptions options;
+	NAPI_STATUS_THROWS_ERROR(rocksdb_js::getProperty(env, argv[1], "batchBytes", options.batchBytes),
+		"Invalid batchBytes option");
+	NAPI_STATUS_THROWS_ERROR(rocksdb_js::getProperty(env, argv[1], "entriesPerDecode", options.entriesPerDecode),
+		"Invalid entriesPerDecode option");
+	if (options.entriesPerDecode == 0) {
+		::napi_throw_range_error(env, nullptr, "entriesPerDecode must be greater than 0");
+		return nullptr;
+	}
+	double startPosition = 0;
+	NAPI_STATUS_THROWS_ERROR(rocksdb_js::getProperty(env, argv[1], "startPosition", startPosition),
+		"Invalid startPosition option");
+	options.startPosition.fullPosition = startPosition;
+
+	napi_value onProgressFn = nullptr;
+	NAPI_STATUS_THROWS(::napi_typeof(env, argv[1], &type));
+	if (type == napi_object) {
+		napi_value value;
+		NAPI_STATUS_THROWS(::napi_get_named_property(env, argv[1], "onProgress", &value));
+		NAPI_STATUS_THROWS(::napi_typeof(env, value, &type));
+		if (type == napi_function) {
+			onProgressFn = value;
+		} else if (type != napi_undefined) {
+			::napi_throw_type_error(env, nullptr, "Invalid onProgress option, expected a function");
+			return nullptr;
+		}
+	}
+
+	auto dbHandle = (*txnLogHandle)->dbHandle.lock();
+	if (!dbHandle || !dbHandle->columnDescriptor) {
+		::napi_throw_error(env, nullptr, "Replay failed: Database has been closed");
+		return nullptr;
+	}
+	auto column = dbHandle->columnDescriptor->column.get();
+
+	napi_value global;
+	NAPI_STATUS_THROWS(::napi_get_global(env, &global));
+
+	// the decoder runs on this (JS) thread, so a JS exception thrown by either
+	// callback is left pending and surfaces as the result of `_replay()`
+	auto decoder = [&](const std::vector<TransactionLogReplayEntry>& entries, rocksdb::WriteBatch& batch) -> rocksdb::Status {
+		napi_value jsEntries;
+		if (::napi_create_array_with_length(env, entries.size(), &jsEntries) != napi_ok) {
+			return rocksdb::Status::Aborted("Failed to create entries array");
+		}
+		for (uint32_t i = 0; i < entries.size(); ++i) {
+			const auto& entry = entries[i];
+			napi_value jsEntry, timestamp, data, endTxn;
+			if (::napi_create_object(env, &jsEntry) != napi_ok ||
+				::napi_create_double(env, entry.timestamp, &timestamp) != napi_ok ||
+				::napi_create_buffer_copy(env, entry.size, entry.data, nullptr, &data) != napi_ok ||
+				::napi_get_boolean(env, entry.endTxn, &endTxn) != napi_ok ||
+				::napi_set_named_property(env, jsEntry, "timestamp", timestamp) != napi_ok ||
+				::napi_set_named_property(env, jsEntry, "data", data) != napi_ok ||
+				::napi_set_named_property(env, jsEntry, "endTxn", endTxn) != napi_ok ||
+				::napi_set_element(env, jsEntries, i, jsEntry) != napi_ok) {
+				return rocksdb::Status::Aborted("Failed to create log entry");
+			}
+		}
+
+		napi_value ops;
+		if (::napi_call_function(env, global, decodeFn, 1, &jsEntries, &ops) != napi_ok) {
+			return rocksdb::Status::Aborted("Decode batch callback threw");
+		}
+
+		bool isArray = false;
+		REPLAY_NAPI_STATUS_RETURN(::napi_is_array(env, ops, &isArray));
+		if (!isArray) {
+			// nothing to apply for this group
+			return rocksdb::Status::OK();
+		}
+		uint32_t length = 0;
+		REPLAY_NAPI_STATUS_RETURN(::napi_get_array_length(env, ops, &length));
+		if (length % 2 != 0) {
+			::napi_throw_type_error(env, nullptr, "Decode batch callback must return key/value pairs");
+			return rocksdb::Status::InvalidArgument("Odd number of key/value elements");
+		}
+
+		for (uint32_t i = 0; i < length; i += 2) {
+			napi_value key, value;
+			REPLAY_NAPI_STATUS_RETURN(::napi_get_element(env, ops, i, &key));
+			REPLAY_NAPI_STATUS_RETURN(::napi_get_element(env, ops, i + 1, &value));
+
+			bool isBuffer = false;
+			char* keyData = nullptr;
+			size_t keyLength = 0;
+			REPLAY_NAPI_STATUS_RETURN(::napi_is_buffer(env, key, &isBuffer));
+			if (!isBuffer) {
+				::napi_throw_type_error(env, nullptr, "Invalid replay key, expected a Buffer");
+				return rocksdb::Status::InvalidArgument("Invalid key");
+			}
+			REPLAY_NAPI_STATUS_RETURN(::napi_get_buffer_info(env, key, reinterpret_cast<void**>(&keyData), &keyLength));
+
+			napi_valuetype valueType;
+			REPLAY_NAPI_STATUS_RETURN(::napi_typeof(env, value, &valueType));
+			rocksdb::Status status;
+			if (valueType == napi_undefined || valueType == napi_null) {
+				status = batch.Delete(column, rocksdb::Slice(keyData, keyLength));
+			} else {
+				char* valueData = nullptr;
+				size_t valueLength = 0;
+				REPLAY_NAPI_STATUS_RETURN(::napi_is_buffer(env, value, &isBuffer));
+				if (!isBuffer) {
+					::napi_throw_type_error(env, nullptr, "Invalid replay value, expected a Buffer");
+					return rocksdb::Status::InvalidArgument("Invalid value");
+				}
+				REPLAY_NAPI_STATUS_RETURN(::napi_get_buffer_info(env, value, reinterpret_cast<void**>(&valueData), &valueLength));
+				status = batch.Put(column, rocksdb::Slice(keyData, keyLength), rocksdb::Slice(valueData, valueLength));
+			}
+			if (!status.ok()) {
+				return status;
+			}
+		}
+		return rocksdb::Status::OK();
+	};
+
+	bool callbackFailed = false;
+	TransactionLogReplayProgressCallback onProgress = nullptr;
+	if (onProgressFn) {
+		onProgress = [&](const TransactionLogReplayProgress& progress) -> bool {
+			napi_value progressObj = buildReplayProgressObject(env, progress);
+			napi_value result;
+			if (!progressObj || ::napi_call_function(env, global, onProgressFn, 1, &progressObj, &result) != napi_ok) {
+				callbackFailed = true;
+				return false;
+			}
+			napi_valuetype resultType;
+			bool keepGoing = true;
+			if (::napi_typeof(env, result, &resultType) == napi_ok && resultType == napi_boolean) {
+				::napi_get_value_bool(env, result, &keepGoing);
+			}
+			return keepGoing;
+		};
+	}
+
+	TransactionLogReplayProgress progress;
+	rocksdb::Status replayStatus;
+	try {
+		replayStatus = (*txnLogHandle)->replay(options, decoder, onProgress, progress);
+	} catch (const std::exception& e) {
+		::napi_throw_error(env, nullptr, e.what());
+		return nullptr;
+	}
+
+	bool isExceptionPending = false;
+	NAPI_STATUS_THROWS(::napi_is_exception_pending(env, &isExceptionPending));
+	if (isExceptionPending || callbackFailed) {
+		return nullptr;
+	}
+	if (!replayStatus.ok()) {
+		ROCKSDB_STATUS_THROWS_ERROR_LIKE(replayStatus, "Replay failed");
+		return nullptr;
+	}
+
+	return buildReplayProgressObject(env, progress);
+}
+
 /**
  * Initializes the `NativeTransactionLog` JavaScript class.
  */
@@ -417,10 +649,12 @@ void TransactionLog::Init(napi_env env, napi_value exports) {
 		{ "path", nullptr, nullptr, GetPath, nullptr, nullptr, napi_default, nullptr },
 		{ "name", nullptr, nullptr, GetName, nullptr, nullptr, napi_default, nullptr },
 		{ "getStats", nullptr, GetStats, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "_adviseReadAhead", nullptr, AdviseReadAhead, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "_findPosition", nullptr, FindPosition, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "_getLastCommittedPosition", nullptr, GetLastCommittedPosition, nullptr, nullptr, nullptr, napi_default, nullptr },
 		{ "_getMemoryMapOfFile", nullptr, GetMemoryMapOfFile, nullptr, nullptr, nullptr, napi_default, nullptr },
-		{ "_getLastFlushed", nullptr, GetLastFlushed, nullptr, nullptr, nullptr, napi_default, nullptr }
+		{ "_getLastFlushed", nullptr, GetLastFlushed, nullptr, nullptr, nullptr, napi_default, nullptr },
+		{ "_replay", nullptr, Replay, nullptr, nullptr, nullptr, napi_default, nullptr }
 	};
 
 	auto className = "TransactionLog";
@@ -11,6 +11,7 @@ namespace rocksdb_js {
 struct TransactionLog final {
 	static napi_value Constructor(napi_env env, napi_callback_info info);
 	static napi_value AddEntry(napi_env env, napi_callback_info info);
+	static napi_value AdviseReadAhead(napi_env env, napi_callback_info info);
 	static napi_value FindPosition(napi_env env, napi_callback_info info);
 	static napi_value GetLastCommittedPosition(napi_env env, napi_callback_info info);
 	static napi_value GetLastFlushed(napi_env env, napi_callback_info info);
@@ -19,6 +20,7 @@ struct TransactionLog final {
 	static napi_value GetName(napi_env env, napi_callback_info info);
 	static napi_value GetPath(napi_env env, napi_callback_info info);
 	static napi_value GetStats(napi_env env, napi_callback_info info);
+	static napi_value Replay(napi_env env, napi_callback_info info);
 
 	static void Init(napi_env env, napi_value exports);
 };
@@ -1,7 +1,11 @@
 #ifndef __TRANSACTION_LOG_ENTRY_H__
 #define __TRANSACTION_LOG_ENTRY_H__
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include "transaction_log_file.h"
 #include "transaction_log_store.h"
 #include "core/encoding.h"
@@ -12,44 +16,167 @@ struct TransactionLogStore;
 
 /**
  * A log entry that is pending to be written to the transaction log on commit.
+ * `data` points at the entry's 13-byte header inside its batch's arena and the
+ * payload follows immediately after; `size` covers both.
  */
-struct TransactionLogEntry final {
+struct TransactionLogEntryRef final {
+	char* data;
+	uint32_t size;
+};
+
+/**
+ * Backing storage for a batch of log entries. Entry headers and payloads are
+ * appended in place into a small number of large chunks rather than one heap
+ * allocation per entry, so adjacent entries are contiguous in memory and can
+ * be written with a handful of large iovecs. Arenas are recycled through a
+ * `TransactionLogArenaPool`, keeping their chunks and entry vector capacity.
+ */
+struct TransactionLogEntryArena final {
+	/**
+	 * Minimum size of a chunk. An entry larger than this gets a chunk of its
+	 * own size.
+	 */
+	static constexpr uint32_t CHUNK_SIZE = 64 * 1024;
+
 	/**
-	 * The transaction log store.
+	 * Chunk capacity kept across `reset()`. Anything past this is freed so a
+	 * single huge transaction doesn't pin its memory in the pool forever.
 	 */
-	std::shared_ptr<TransactionLogStore> store;
+	static constexpr size_t RETAINED_BYTES = 1024 * 1024;
+
+	struct Chunk final {
+		std::unique_ptr<char[]> data;
+		uint32_t capacity;
+		uint32_t used;
+	};
+
+	std::vector<Chunk> chunks;
 
 	/**
-	 * The log entry data.
+	 * The index of the chunk currently being appended to.
 	 */
-	std::unique_ptr<char[]> data;
+	size_t activeChunk = 0;
 
 	/**
-	 * The size of the log entry.
+	 * The entries in append order.
 	 */
-	uint32_t size;
+	std::vector<TransactionLogEntryRef> entries;
 
 	/**
-	 * Creates a new transaction log entry.
+	 * Appends an entry, writing its header (length and flags; the timestamp is
+	 * written when the batch is written) followed by a copy of the payload.
 	 */
-	TransactionLogEntry(
-		std::shared_ptr<TransactionLogStore> store,
-		char* data,
-		uint32_t size
-	) :
-		store(store)
-	{
-		this->size = size + TRANSACTION_LOG_ENTRY_HEADER_SIZE;
-		this->data = std::make_unique<char[]>(this->size);
-
-		// write the transaction header (13 bytes)
-		// skip timestamp for now, it will be written when the batch is written
-		writeUint32BE(this->data.get() + 8, static_cast<uint32_t>(size)); // data length
-		writeUint8(this->data.get() + 12, 0); // flags
-		::memcpy(this->data.get() + 13, data, size);
+	void append(const char* data, uint32_t size) {
+		uint32_t entrySize = size + TRANSACTION_LOG_ENTRY_HEADER_SIZE;
+		char* dest = this->reserve(entrySize);
+		writeUint32BE(dest + 8, size); // data length
+		writeUint8(dest + 12, 0); // flags
+		::memcpy(dest + TRANSACTION_LOG_ENTRY_HEADER_SIZE, data, size);
+		this->entries.push_back({ dest, entrySize });
+	}
+
+	/**
+	 * Clears all entries for reuse, keeping up to `RETAINED_BYTES` of chunks.
+	 */
+	void reset() {
+		this->entries.clear();
+		this->activeChunk = 0;
+		size_t retained = 0;
+		size_t keep = 0;
+		for (; keep < this->chunks.size(); ++keep) {
+			retained += this->chunks[keep].capacity;
+			if (retained > RETAINED_BYTES) {
+				break;
+			}
+			this->chunks[keep].used = 0;
+		}
+		this->chunks.resize(keep);
+	}
+
+	/**
+	 * Total bytes of chunk memory owned by this arena.
+	 */
+	size_t capacity() const {
+		size_t total = 0;
+		for (const auto& chunk : this->chunks) {
+			total += chunk.capacity;
+		}
+		return total;
+	}
+
+private:
+	char* reserve(uint32_t size) {
+		// entries never straddle chunks, so move on to the next chunk (reusing a
+		// retained one when it is big enough) once the active one is full
+		while (this->activeChunk < this->chunks.size()) {
+			Chunk& chunk = this->chunks[this->activeChunk];
+			if (chunk.capacity - chunk.used >= size) {
+				char* dest = chunk.data.get() + chunk.used;
+				chunk.used += size;
+				return dest;
+			}
+			if (chunk.used == 0) {
+				// an empty retained chunk that is too small: replace it
+				uint32_t capacity = std::max(CHUNK_SIZE, size);
+				chunk.data = std::make_unique<char[]>(capacity);
+				chunk.capacity = capacity;
+				chunk.used = size;
+				return chunk.data.get();
+			}
+			++this->activeChunk;
+		}
+		uint32_t capacity = std::max(CHUNK_SIZE, size);
+		this->chunks.push_back({ std::make_unique<char[]>(capacity), capacity, size });
+		this->activeChunk = this->chunks.size() - 1;
+		return this->chunks.back().data.get();
 	}
 };
 
+/**
+ * A per-database freelist of entry arenas. Batches are built on the JS thread
+ * and released on the commit thread; recycling the arena instead of freeing it
+ * keeps those frees from crossing allocator arenas and makes steady-state
+ * `addEntry()` allocation-free.
+ */
+struct TransactionLogArenaPool final {
+	/**
+	 * The maximum number of idle arenas kept.
+	 */
+	static constexpr size_t MAX_POOLED = 32;
+
+	std::unique_ptr<TransactionLogEntryArena> acquire() {
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			if (!this->arenas.empty()) {
+				auto arena = std::move(this->arenas.back());
+				this->arenas.pop_back();
+				return arena;
+			}
+		}
+		return std::make_unique<TransactionLogEntryArena>();
+	}
+
+	void release(std::unique_ptr<TransactionLogEntryArena> arena) {
+		if (!arena) {
+			return;
+		}
+		arena->reset();
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if (this->arenas.size() < MAX_POOLED) {
+			this->arenas.push_back(std::move(arena));
+		}
+	}
+
+	size_t size() {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		return this->arenas.size();
+	}
+
+private:
+	std::mutex mutex;
+	std::vector<std::unique_ptr<TransactionLogEntryArena>> arenas;
+};
+
 /**
  * A batch of transaction log entries. `writeBatchToFile` is now write-everything
  * -or-fail, so a partial entry can never end up on disk; only whole-entry
@@ -62,31 +189,73 @@ struct TransactionLogEntryBatch final {
 	double timestamp;
 
 	/**
-	 * The vector of entries to write.
+	 * The pool the arena is returned to when the batch is destroyed. May be
+	 * null, in which case the arena is simply freed.
+	 */
+	std::shared_ptr<TransactionLogArenaPool> pool;
+
+	/**
+	 * The storage for the batch's entries.
 	 */
-	std::vector<std::unique_ptr<TransactionLogEntry>> entries;
+	std::unique_ptr<TransactionLogEntryArena> arena;
 
 	/**
 	 * The index of the current entry being written.
 	 */
 	uint32_t currentEntryIndex = 0;
 
-	TransactionLogEntryBatch(const double timestamp) :
-		timestamp(timestamp)
-	{}
+	TransactionLogEntryBatch(
+		const double timestamp,
+		std::shared_ptr<TransactionLogArenaPool> pool = nullptr
+	) :
+		timestamp(timestamp),
+		pool(std::move(pool))
+	{
+		this->arena = this->pool ? this->pool->acquire() : std::make_unique<TransactionLogEntryArena>();
+	}
+
+	~TransactionLogEntryBatch() {
+		if (this->pool) {
+			this->pool->release(std::move(this->arena));
+		}
+	}
+
+	TransactionLogEntryBatch(const TransactionLogEntryBatch&) = delete;
+	TransactionLogEntryBatch& operator=(const TransactionLogEntryBatch&) = delete;
+
+	/**
+	 * Adds a new entry to the batch, copying `size` bytes of `data`.
+	 */
+	void addEntry(const char* data, uint32_t size) {
+		this->arena->append(data, size);
+	}
+
+	/**
+	 * The entries in the batch.
+	 */
+	std::vector<TransactionLogEntryRef>& entries() {
+		return this->arena->entries;
+	}
+
+	const std::vector<TransactionLogEntryRef>& entries() const {
+		return this->arena->entries;
+	}
 
 	/**
-	 * Adds a new entry to the batch.
+	 * Drops the entries added after the first `count`. Their bytes stay in the
+	 * arena until the batch is released.
 	 */
-	void addEntry(std::unique_ptr<TransactionLogEntry> entry) {
-		this->entries.push_back(std::move(entry));
+	void truncate(size_t count) {
+		if (count < this->arena->entries.size()) {
+			this->arena->entries.resize(count);
+		}
 	}
 
 	/**
 	 * Checks if all entries have been written.
 	 */
 	bool isComplete() const {
-		return this->currentEntryIndex >= this->entries.size();
+		return this->currentEntryIndex >= this->arena->entries.size();
 	}
 };
 
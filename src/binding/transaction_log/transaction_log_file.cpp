@@ -19,6 +19,8 @@
 namespace rocksdb_js {
 
 std::atomic<bool> TransactionLogFile::madvColdUnsupported{false};
+std::atomic<bool> TransactionLogFile::readAheadEnabled{false};
+std::atomic<bool> TransactionLogFile::hugePagesEnabled{false};
 
 std::atomic<int64_t> MemoryMap::liveCount{0};
 
@@ -26,6 +28,11 @@ std::atomic<int64_t> MemoryMap::liveCount{0};
 void TransactionLogFile::resetAdviseColdSupportForTests() {
 	madvColdUnsupported.store(false, std::memory_order_relaxed);
 }
+
+void TransactionLogFile::resetMemoryMapHintsForTests() {
+	readAheadEnabled.store(false, std::memory_order_relaxed);
+	hugePagesEnabled.store(false, std::memory_order_relaxed);
+}
 #endif
 
 TransactionLogFile::~TransactionLogFile() {
@@ -276,7 +283,7 @@ uint32_t TransactionLogFile::countEntries() const {
 
 void TransactionLogFile::writeEntries(TransactionLogEntryBatch& batch, const uint32_t maxFileSize) {
 	DEBUG_LOG("%p TransactionLogFile::writeEntries Writing batch with %zu entries, current entry index=%zu (timestamp=%f, maxFileSize=%u, currentSize=%u)\n",
-		this, batch.entries.size(), batch.currentEntryIndex, batch.timestamp, maxFileSize, this->size.load(std::memory_order_relaxed));
+		this, batch.entries().size(), batch.currentEntryIndex, batch.timestamp, maxFileSize, this->size.load(std::memory_order_relaxed));
 
 	// Mark that appends are now occurring on this file (regardless of format version), so a concurrent
 	// reader's index build will no longer treat a transiently-zero (not-yet-visible) entry as
@@ -295,6 +302,7 @@ void TransactionLogFile::writeEntries(TransactionLogEntryBatch& batch, const uin
 
 void TransactionLogFile::writeEntriesV1(TransactionLogEntryBatch& batch, const uint32_t maxFileSize) {
 	std::lock_guard<std::mutex> fileLock(this->fileMutex);
+	auto& entries = batch.entries();
 	uint32_t numEntriesToWrite = 0;
 	uint32_t totalSizeToWrite = 0;
 
@@ -310,9 +318,9 @@ void TransactionLogFile::writeEntriesV1(TransactionLogEntryBatch& batch, const u
 
 		// calculate how many entries we can fit
 		auto availableSpace = maxFileSize - this->size;
-		for (size_t i = batch.currentEntryIndex; i < batch.entries.size(); ++i) {
-			auto& entry = batch.entries[i];
-			auto spaceNeeded = totalSizeToWrite + entry->size;
+		for (size_t i = batch.currentEntryIndex; i < entries.size(); ++i) {
+			auto& entry = entries[i];
+			auto spaceNeeded = totalSizeToWrite + entry.size;
 			// always write the first entry
 			if ((this->size > TRANSACTION_LOG_FILE_HEADER_SIZE || i > batch.currentEntryIndex) && spaceNeeded > availableSpace) {
 				// entry won't fit
@@ -321,11 +329,11 @@ void TransactionLogFile::writeEntriesV1(TransactionLogEntryBatch& batch, const u
 			}
 			DEBUG_LOG("%p TransactionLogFile::writeEntriesV1 Entry %u fits (need=%u, available=%u)\n", this, i, spaceNeeded, availableSpace);
 			++numEntriesToWrite;
-			totalSizeToWrite += entry->size;
+			totalSizeToWrite += entry.size;
 		}
 	} else {
 		// unlimited space, write all entries
-		numEntriesToWrite = batch.entries.size() - batch.currentEntryIndex;
+		numEntriesToWrite = entries.size() - batch.currentEntryIndex;
 	}
 
 	if (numEntriesToWrite == 0) {
@@ -335,29 +343,38 @@ void TransactionLogFile::writeEntriesV1(TransactionLogEntryBatch& batch, const u
 
 	DEBUG_LOG("%p TransactionLogFile::writeEntriesV1 Writing %u entries to file (%u bytes)\n", this, numEntriesToWrite, totalSizeToWrite);
 
-	// Use a stack buffer for small batches to avoid a heap alloc per commit.
+	// Entries are laid out back to back in the batch's arena chunks, so
+	// adjacent entries coalesce into one iovec per chunk. Use a stack buffer for
+	// the common case to avoid a heap alloc per commit.
+	size_t maxIovecs = std::min<size_t>(numEntriesToWrite, batch.arena->chunks.size());
 	iovec stackIovecs[8];
-	auto heapIovecs = numEntriesToWrite > 8 ? std::make_unique<iovec[]>(numEntriesToWrite) : nullptr;
+	auto heapIovecs = maxIovecs > 8 ? std::make_unique<iovec[]>(maxIovecs) : nullptr;
 	iovec* iovecs = heapIovecs ? heapIovecs.get() : stackIovecs;
 	size_t iovecsIndex = 0;
 
 	// write the transaction headers and entry data to the iovecs
 	for (uint32_t i = 0; i < numEntriesToWrite; ++i) {
-		auto& entry = batch.entries[batch.currentEntryIndex];
-		auto data = entry->data.get();
+		auto& entry = entries[batch.currentEntryIndex];
+		auto data = entry.data;
 
 		// Write the timestamp into the transaction header
-		// Note: the rest of the transaction header is written in the
-		// `TransactionLogEntry` constructor
+		// Note: the rest of the transaction header is written when the entry is
+		// appended to the arena
 		writeDoubleBE(data, batch.timestamp); // actual timestamp
-		if (batch.currentEntryIndex == batch.entries.size() - 1) {
+		if (batch.currentEntryIndex == entries.size() - 1) {
 			// Last entry in batch, set the last entry flag
 			uint8_t flags = readUint8(data + 12);
 			writeUint8(data + 12, flags | TRANSACTION_LOG_ENTRY_LAST_FLAG);
 		}
 
-		// add the entry data to the iovecs
-		iovecs[iovecsIndex++] = {data, entry->size};
+		// add the entry data to the iovecs, extending the previous iovec when
+		// the entry directly follows it in the same chunk
+		if (iovecsIndex > 0 &&
+			static_cast<char*>(iovecs[iovecsIndex - 1].iov_base) + iovecs[iovecsIndex - 1].iov_len == data) {
+			iovecs[iovecsIndex - 1].iov_len += entry.size;
+		} else {
+			iovecs[iovecsIndex++] = {data, entry.size};
+		}
 
 		++batch.currentEntryIndex;
 	}
@@ -309,6 +309,46 @@ struct TransactionLogFile final {
 	 */
 	size_t adviseCold();
 
+	/**
+	 * Read-ahead hint for a file that is about to be scanned from `offset`:
+	 * issues MADV_WILLNEED for the file-backed `[offset, actualSize)` region
+	 * (page-aligned, never the anonymous overlay tail) so the kernel starts
+	 * paging it in instead of faulting 4 KB at a time, plus MADV_SEQUENTIAL over
+	 * the file-backed region when `sequential` is set (e.g. a `query()` cursor),
+	 * which enables aggressive read-ahead and early reclaim behind the reader.
+	 *
+	 * Only acts when read-ahead is enabled (see `readAheadEnabled`). No-op on
+	 * Windows and when no map is live.
+	 *
+	 * @returns The number of bytes advised with MADV_WILLNEED.
+	 */
+	size_t adviseReadAhead(uint32_t offset, bool sequential);
+
+	/**
+	 * Counts the file-backed pages of this log's live map that are resident in
+	 * memory (via mincore), reporting the resident and non-resident totals in
+	 * bytes and pages. Non-resident pages are the ones the next read will fault
+	 * on. Returns false (leaving the outputs untouched) when no map is live or
+	 * on Windows.
+	 */
+	bool residency(uint64_t& residentBytes, uint64_t& nonResidentPages);
+
+	/**
+	 * Opt-in read-ahead for log memory maps, set via
+	 * `config({ transactionLogReadAhead })`. When enabled, the file-backed
+	 * overlay is mapped with MAP_POPULATE (Linux) and `adviseReadAhead()` issues
+	 * its hints; otherwise both are skipped. Process-global because maps are
+	 * created by whichever store/thread first touches the file.
+	 */
+	static std::atomic<bool> readAheadEnabled;
+
+	/**
+	 * Opt-in MADV_HUGEPAGE on the anonymous overlay region, set via
+	 * `config({ transactionLogHugePages })`. Reduces TLB pressure for readers of
+	 * the large (maxFileSize) current-file reservation. POSIX only.
+	 */
+	static std::atomic<bool> hugePagesEnabled;
+
 	/**
 	 * On POSIX, extends the MAP_FIXED file overlay to cover any new pages
 	 * written since the last overlay. Called after writes that grow the file
@@ -352,6 +392,12 @@ struct TransactionLogFile final {
 	 * that each test starts from a known state. Test-only.
 	 */
 	static void resetAdviseColdSupportForTests();
+
+	/**
+	 * Resets the read-ahead and huge page opt-ins to their defaults (off).
+	 * Test-only.
+	 */
+	static void resetMemoryMapHintsForTests();
 #endif
 
 private:
@@ -174,10 +174,24 @@ std::shared_ptr<MemoryMap> TransactionLogFile::getMemoryMapLocked(uint32_t fileS
 			DEBUG_LOG("%p TransactionLogFile::getMemoryMap ERROR: mmap (anonymous) failed: %s\n", this, ::strerror(errno));
 			return nullptr;
 		}
+#ifdef MADV_HUGEPAGE
+		if (hugePagesEnabled.load(std::memory_order_relaxed)) {
+			// advisory only: kernels without transparent huge pages return EINVAL
+			ROCKSDB_JS_MADVISE(anonMap, fileSize, MADV_HUGEPAGE);
+		}
+#endif
 
 		uint32_t actualSize = std::min(this->size.load(std::memory_order_relaxed), fileSize);
 		if (actualSize > 0 && this->fd >= 0) {
-			void* fileMap = ::mmap(anonMap, actualSize, PROT_READ, MAP_SHARED | MAP_FIXED, this->fd, 0);
+			int overlayFlags = MAP_SHARED | MAP_FIXED;
+#ifdef MAP_POPULATE
+			if (readAheadEnabled.load(std::memory_order_relaxed)) {
+				// prefault the file-backed pages in one pass rather than one
+				// fault per 4 KB page during a catch-up scan
+				overlayFlags |= MAP_POPULATE;
+			}
+#endif
+			void* fileMap = ::mmap(anonMap, actualSize, PROT_READ, overlayFlags, this->fd, 0);
 			if (fileMap == MAP_FAILED) {
 				DEBUG_LOG("%p TransactionLogFile::getMemoryMap ERROR: mmap (file overlay) failed: %s\n", this, ::strerror(errno));
 				::munmap(anonMap, fileSize);
@@ -285,6 +299,97 @@ size_t TransactionLogFile::adviseCold() {
 #endif
 }
 
+size_t TransactionLogFile::adviseReadAhead(uint32_t offset, bool sequential) {
+	if (!readAheadEnabled.load(std::memory_order_relaxed)) {
+		return 0;
+	}
+
+	// pin the live map under fileMutex (see adviseCold)
+	std::shared_ptr<MemoryMap> map;
+	uint32_t actualSize;
+	{
+		std::lock_guard<std::mutex> lock(this->fileMutex);
+		map = this->memoryMap ? this->memoryMap : this->frozenMapCache.lock();
+		if (!map || !map->map) {
+			return 0;
+		}
+		actualSize = std::min(this->size.load(std::memory_order_relaxed), map->mapSize);
+	}
+
+	// Both ends are floored to a page boundary so the advice stays within the
+	// file-backed overlay; the partial last page is left to a regular fault.
+	long pageSize = ::sysconf(_SC_PAGESIZE);
+	if (pageSize <= 0) {
+		pageSize = 4096;
+	}
+	const size_t pageMask = ~(static_cast<size_t>(pageSize) - 1);
+	size_t end = static_cast<size_t>(actualSize) & pageMask;
+	size_t start = static_cast<size_t>(offset) & pageMask;
+	if (end == 0) {
+		return 0;
+	}
+
+	if (sequential && ROCKSDB_JS_MADVISE(map->map, end, MADV_SEQUENTIAL) != 0) {
+		DEBUG_LOG("%p TransactionLogFile::adviseReadAhead MADV_SEQUENTIAL failed: %s (errno=%d)\n",
+			this, ::strerror(errno), errno);
+	}
+
+	if (start >= end) {
+		return 0;
+	}
+	size_t length = end - start;
+	if (ROCKSDB_JS_MADVISE(static_cast<char*>(map->map) + start, length, MADV_WILLNEED) != 0) {
+		DEBUG_LOG("%p TransactionLogFile::adviseReadAhead MADV_WILLNEED failed: %s (errno=%d)\n",
+			this, ::strerror(errno), errno);
+		return 0;
+	}
+
+	DEBUG_LOG("%p TransactionLogFile::adviseReadAhead MADV_WILLNEED %zu bytes at %zu of %s\n",
+		this, length, start, this->path.string().c_str());
+	return length;
+}
+
+bool TransactionLogFile::residency(uint64_t& residentBytes, uint64_t& nonResidentPages) {
+	std::shared_ptr<MemoryMap> map;
+	uint32_t actualSize;
+	{
+		std::lock_guard<std::mutex> lock(this->fileMutex);
+		map = this->memoryMap ? this->memoryMap : this->frozenMapCache.lock();
+		if (!map || !map->map) {
+			return false;
+		}
+		actualSize = std::min(this->size.load(std::memory_order_relaxed), map->mapSize);
+	}
+
+	long pageSize = ::sysconf(_SC_PAGESIZE);
+	if (pageSize <= 0) {
+		pageSize = 4096;
+	}
+	size_t pages = (static_cast<size_t>(actualSize) + pageSize - 1) / pageSize;
+	if (pages == 0) {
+		return true;
+	}
+
+#ifdef __APPLE__
+	std::vector<char> vec(pages);
+#else
+	std::vector<unsigned char> vec(pages);
+#endif
+	if (::mincore(map->map, static_cast<size_t>(actualSize), vec.data()) != 0) {
+		DEBUG_LOG("%p TransactionLogFile::residency mincore failed: %s (errno=%d)\n",
+			this, ::strerror(errno), errno);
+		return false;
+	}
+
+	size_t resident = 0;
+	for (auto page : vec) {
+		resident += (page & 1);
+	}
+	residentBytes = std::min<uint64_t>(static_cast<uint64_t>(resident) * pageSize, actualSize);
+	nonResidentPages = pages - resident;
+	return true;
+}
+
 #if TRANSACTION_LOG_ENABLE_ANONYMOUS_OVERLAY
 void TransactionLogFile::updateMemoryMapOverlay() {
 	// Precondition: caller holds fileMutex (writeEntriesV1 holds it; getMemoryMap
@@ -497,6 +497,16 @@ size_t TransactionLogFile::adviseCold() {
 	return 0;
 }
 
+size_t TransactionLogFile::adviseReadAhead(uint32_t offset, bool sequential) {
+	// No-op: the Windows view is mapped over the pre-extended file and the
+	// cache manager already reads ahead sequential access.
+	return 0;
+}
+
+bool TransactionLogFile::residency(uint64_t& residentBytes, uint64_t& nonResidentPages) {
+	return false;
+}
+
 } // namespace rocksdb_js
 
 #endif
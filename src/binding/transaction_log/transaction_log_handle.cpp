@@ -1,4 +1,5 @@
 #include "database/db_descriptor.h"
+#include "database/db_settings.h"
 #include "napi/macros.h"
 #include "transaction_log_handle.h"
 #include "core/platform.h"
@@ -54,8 +55,7 @@ void TransactionLogHandle::addEntry(
 		throw rocksdb_js::DBException(errorMessage);
 	}
 
-	auto entry = std::make_unique<TransactionLogEntry>(store, data, size);
-	txnHandle->addLogEntry(std::move(entry));
+	txnHandle->addLogEntry(store, data, size);
 }
 
 void TransactionLogHandle::close() {
@@ -74,6 +74,12 @@ uint64_t TransactionLogHandle::getLogFileSize(uint32_t sequenceNumber) {
 	return 0;
 }
 
+size_t TransactionLogHandle::adviseReadAhead(uint32_t sequenceNumber, uint32_t offset) {
+	auto store = this->store.lock();
+	if (store) return store->adviseReadAhead(sequenceNumber, offset, true);
+	return 0;
+}
+
 std::shared_ptr<MemoryMap> TransactionLogHandle::getMemoryMap(uint32_t sequenceNumber) {
 	auto store = this->store.lock();
 	if (store) return store->getMemoryMap(sequenceNumber);
@@ -117,4 +123,42 @@ bool TransactionLogHandle::collectStats(TransactionLogStoreStats& out) {
 	return true;
 }
 
+rocksdb::Status TransactionLogHandle::replay(
+	const TransactionLogReplayOptions& options,
+	const TransactionLogReplayDecoder& decoder,
+	const TransactionLogReplayProgressCallback& onProgress,
+	TransactionLogReplayProgress& progress
+) {
+	auto dbHandle = this->dbHandle.lock();
+	if (!dbHandle || !dbHandle->descriptor->db) {
+		throw rocksdb_js::DBException("Database has been closed");
+	}
+
+	auto store = this->store.lock();
+	if (!store || store->isClosing.load(std::memory_order_relaxed)) {
+		store = dbHandle->descriptor->resolveTransactionLogStore(this->logName);
+		this->store = store;
+	}
+	if (!store) {
+		throw rocksdb_js::DBException("Transaction log store \"" + this->logName + "\" not found");
+	}
+
+	auto status = replayTransactionLog(
+		store,
+		dbHandle->descriptor->db.get(),
+		options,
+		decoder,
+		onProgress,
+		progress
+	);
+	DEBUG_LOG("%p TransactionLogHandle::replay Replayed %llu entries from \"%s\"\n",
+		this, static_cast<unsigned long long>(progress.entriesReplayed), this->logName.c_str());
+
+	if (progress.operationsWritten > 0 && dbHandle->enableVerificationTable) {
+		VerificationTable* vt = DBSettings::getInstance().getVerificationTableRaw();
+		if (vt) vt->settleAllSlots();
+	}
+	return status;
+}
+
 } // namespace rocksdb_js
@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 #include "database/db_handle.h"
+#include "transaction_log_replay.h"
 #include "transaction_log_store.h"
 
 namespace rocksdb_js {
@@ -64,6 +65,7 @@ struct TransactionLogHandle final : Closable {
 	LogPosition findPosition(double timestamp);
 	LogPosition getLastFlushed();
 	uint64_t getLogFileSize(uint32_t sequenceNumber);
+	size_t adviseReadAhead(uint32_t sequenceNumber, uint32_t offset);
 	std::weak_ptr<LogPosition> getLastCommittedPosition();
 
 	/**
@@ -73,6 +75,19 @@ struct TransactionLogHandle final : Closable {
 	 */
 	bool collectStats(TransactionLogStoreStats& out);
 
+	/**
+	 * Re-applies the log's entries from the last flushed position into this
+	 * handle's database with the WAL disabled. See `replayTransactionLog()`.
+	 * When the database registers writes in the Verification Table, all slots
+	 * are settled afterwards since the replayed writes bypass it.
+	 */
+	rocksdb::Status replay(
+		const TransactionLogReplayOptions& options,
+		const TransactionLogReplayDecoder& decoder,
+		const TransactionLogReplayProgressCallback& onProgress,
+		TransactionLogReplayProgress& progress
+	);
+
 	/**
 	 * Closes the transaction log handle.
 	 */
@@ -116,4 +116,38 @@ uint32_t countTransactionLogEntries(const char* data, uint32_t fileSize) {
 	return count;
 }
 
+uint32_t forEachTransactionLogEntry(
+	const char* data,
+	uint32_t fileSize,
+	uint32_t from,
+	const std::function<bool(const TransactionLogEntryView&)>& visitor
+) {
+	uint32_t pos = from < TRANSACTION_LOG_FILE_HEADER_SIZE ? TRANSACTION_LOG_FILE_HEADER_SIZE : from;
+	while (static_cast<uint64_t>(pos) + TRANSACTION_LOG_ENTRY_HEADER_SIZE <= fileSize) {
+		double timestamp = readDoubleBE(data + pos);
+		if (timestamp == 0) {
+			// zero padding marks the end of entries (matches the reader/parser)
+			break;
+		}
+		uint32_t length = readUint32BE(data + pos + 8);
+		if (length == 0 ||
+			static_cast<uint64_t>(pos) + TRANSACTION_LOG_ENTRY_HEADER_SIZE + length > fileSize) {
+			// broken/torn frame; stop at the last well-formed entry
+			break;
+		}
+		TransactionLogEntryView entry = {
+			pos,
+			timestamp,
+			readUint8(data + pos + 12),
+			data + pos + TRANSACTION_LOG_ENTRY_HEADER_SIZE,
+			length
+		};
+		if (!visitor(entry)) {
+			break;
+		}
+		pos += TRANSACTION_LOG_ENTRY_HEADER_SIZE + length;
+	}
+	return pos < from ? from : pos;
+}
+
 } // namespace rocksdb_js
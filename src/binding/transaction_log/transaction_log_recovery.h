@@ -2,6 +2,7 @@
 #define __TRANSACTION_LOG_RECOVERY_H__
 
 #include <cstdint>
+#include <functional>
 
 namespace rocksdb_js {
 
@@ -63,6 +64,42 @@ RecoveryScan scanTransactionLogForRecovery(const char* data, uint32_t fileSize);
  */
 uint32_t countTransactionLogEntries(const char* data, uint32_t fileSize);
 
+/**
+ * A single well-formed v1 entry frame, as yielded by
+ * forEachTransactionLogEntry(). `data` points into the caller's file image and
+ * is only valid for as long as that image is.
+ */
+struct TransactionLogEntryView final {
+	/** Offset of the entry header within the file. */
+	uint32_t offset;
+	double timestamp;
+	uint8_t flags;
+	const char* data;
+	uint32_t length;
+};
+
+/**
+ * Walks the well-formed v1 entry frames of an in-memory transaction log image
+ * starting at `from`, calling `visitor` for each. Stops at the first
+ * zero-timestamp marker, EOF, broken/torn frame, or when the visitor returns
+ * false. Pure (no I/O) and shares the framing rules with
+ * countTransactionLogEntries(). A `from` inside the file header is clamped to
+ * the first entry.
+ *
+ * @param data     Pointer to the full file image.
+ * @param fileSize Number of bytes in `data`.
+ * @param from     Offset of the first entry to visit.
+ * @param visitor  Called per entry; return false to stop before consuming it.
+ * @returns The offset of the first entry not consumed, i.e. where a later walk
+ * should resume.
+ */
+uint32_t forEachTransactionLogEntry(
+	const char* data,
+	uint32_t fileSize,
+	uint32_t from,
+	const std::function<bool(const TransactionLogEntryView&)>& visitor
+);
+
 } // namespace rocksdb_js
 
 #endif
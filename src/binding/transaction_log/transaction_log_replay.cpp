@@ -0,0 +1,150 @@
+#include <algorithm>
+#include "transaction_log_replay.h"
+#include "transaction_log_file.h"
+#include "transaction_log_recovery.h"
+#include "core/debug.h"
+
+namespace rocksdb_js {
+
+rocksdb::Status replayTransactionLog(
+	const std::shared_ptr<TransactionLogStore>& store,
+	rocksdb::DB* db,
+	const TransactionLogReplayOptions& options,
+	const TransactionLogReplayDecoder& decoder,
+	const TransactionLogReplayProgressCallback& onProgress,
+	TransactionLogReplayProgress& progress
+) {
+	LogPosition start = options.startPosition;
+	if (start.fullPosition == 0) {
+		start = store->getLastFlushedPosition();
+	}
+
+	// snapshot the sequence numbers to replay; files are only ever appended or
+	// purged from the front, and purge never removes unflushed files
+	std::vector<uint32_t> sequences;
+	{
+		std::lock_guard<std::mutex> lock(store->dataSetsMutex);
+		for (auto& [sequenceNumber, logFile] : store->sequenceFiles) {
+			if (sequenceNumber >= start.logSequenceNumber) {
+				sequences.push_back(sequenceNumber);
+			}
+		}
+	}
+
+	if (start.fullPosition == 0 || (!sequences.empty() && sequences.front() > start.logSequenceNumber)) {
+		// nothing has been flushed yet, or the flushed file is gone: start at the
+		// beginning of the oldest log file
+		start = { TRANSACTION_LOG_FILE_HEADER_SIZE, sequences.empty() ? 0 : sequences.front() };
+	}
+	if (start.positionInLogFile < TRANSACTION_LOG_FILE_HEADER_SIZE) {
+		start.positionInLogFile = TRANSACTION_LOG_FILE_HEADER_SIZE;
+	}
+
+	progress.startPosition = start;
+	progress.position = start;
+	for (uint32_t sequenceNumber : sequences) {
+		uint64_t fileSize = store->getLogFileSize(sequenceNumber);
+		uint64_t from = sequenceNumber == start.logSequenceNumber ? start.positionInLogFile : TRANSACTION_LOG_FILE_HEADER_SIZE;
+		if (fileSize > from) {
+			progress.totalBytes += fileSize - from;
+		}
+	}
+
+	DEBUG_LOG("replayTransactionLog Replaying \"%s\" from %u:%u (%zu files, %llu bytes)\n",
+		store->name.c_str(), start.logSequenceNumber, start.positionInLogFile, sequences.size(),
+		static_cast<unsigned long long>(progress.totalBytes));
+
+	rocksdb::WriteOptions writeOptions;
+	writeOptions.disableWAL = true;
+	rocksdb::WriteBatch batch;
+	std::vector<TransactionLogReplayEntry> pending;
+	pending.reserve(std::max<uint32_t>(options.entriesPerDecode, 1));
+	uint64_t pendingBytes = 0;
+	rocksdb::Status status;
+	bool stopped = false;
+
+	auto writeBatch = [&]() -> bool {
+		if (batch.Count() == 0) {
+			return true;
+		}
+		progress.operationsWritten += batch.Count();
+		status = db->Write(writeOptions, &batch);
+		if (!status.ok()) {
+			return false;
+		}
+		batch.Clear();
+		++progress.batchesWritten;
+		if (onProgress && !onProgress(progress)) {
+			stopped = true;
+			return false;
+		}
+		return true;
+	};
+
+	// hands the pending entries to the decoder and applies the write batch once
+	// it is large enough
+	auto decodePending = [&](bool forceWrite) -> bool {
+		if (!pending.empty()) {
+			status = decoder(pending, batch);
+			if (!status.ok()) {
+				return false;
+			}
+			const auto& last = pending.back();
+			progress.position = {
+				last.position.positionInLogFile + TRANSACTION_LOG_ENTRY_HEADER_SIZE + last.size,
+				last.position.logSequenceNumber
+			};
+			progress.entriesReplayed += pending.size();
+			progress.bytesReplayed += pendingBytes;
+			pending.clear();
+			pendingBytes = 0;
+		}
+		if (forceWrite || batch.GetDataSize() >= options.batchBytes) {
+			return writeBatch();
+		}
+		return true;
+	};
+
+	for (uint32_t sequenceNumber : sequences) {
+		auto memoryMap = store->getMemoryMap(sequenceNumber);
+		if (!memoryMap) {
+			continue;
+		}
+		uint32_t fileSize = static_cast<uint32_t>(std::min<uint64_t>(
+			store->getLogFileSize(sequenceNumber),
+			memoryMap->fileSize
+		));
+		uint32_t from = sequenceNumber == start.logSequenceNumber ? start.positionInLogFile : TRANSACTION_LOG_FILE_HEADER_SIZE;
+		store->adviseReadAhead(sequenceNumber, from, true);
+		const char* data = static_cast<const char*>(memoryMap->map);
+
+		bool ok = true;
+		forEachTransactionLogEntry(data, fileSize, from, [&](const TransactionLogEntryView& entry) {
+			pending.push_back({
+				{ entry.offset, sequenceNumber },
+				entry.timestamp,
+				entry.data,
+				entry.length,
+				(entry.flags & TRANSACTION_LOG_ENTRY_LAST_FLAG) != 0
+			});
+			pendingBytes += TRANSACTION_LOG_ENTRY_HEADER_SIZE + entry.length;
+			if (pending.size() >= options.entriesPerDecode) {
+				ok = decodePending(false);
+			}
+			return ok;
+		});
+
+		// the pending entries point into this file's memory map, so they must be
+		// decoded before the map is released
+		if (!ok || !decodePending(false)) {
+			return stopped ? rocksdb::Status::OK() : status;
+		}
+	}
+
+	if (!decodePending(true)) {
+		return stopped ? rocksdb::Status::OK() : status;
+	}
+	return rocksdb::Status::OK();
+}
+
+} // namespace rocksdb_js
@@ -0,0 +1,112 @@
+#ifndef __TRANSACTION_LOG_REPLAY_H__
+#define __TRANSACTION_LOG_REPLAY_H__
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "rocksdb/db.h"
+#include "rocksdb/write_batch.h"
+#include "transaction_log_store.h"
+
+namespace rocksdb_js {
+
+/**
+ * A transaction log entry handed to a replay decoder. `data` points into the
+ * log file's memory map and is only valid for the duration of the decoder call.
+ */
+struct TransactionLogReplayEntry final {
+	LogPosition position;
+	double timestamp;
+	const char* data;
+	uint32_t size;
+	/**
+	 * True when this is the last entry of its transaction.
+	 */
+	bool endTxn;
+};
+
+/**
+ * Progress of a replay, reported after each write batch has been applied and
+ * returned as the final summary.
+ */
+struct TransactionLogReplayProgress final {
+	/**
+	 * The position replay started from (the last flushed position).
+	 */
+	LogPosition startPosition = { 0, 0 };
+
+	/**
+	 * The position just past the last entry that has been applied.
+	 */
+	LogPosition position = { 0, 0 };
+
+	uint64_t entriesReplayed = 0;
+	uint64_t bytesReplayed = 0;
+	uint64_t batchesWritten = 0;
+	uint64_t operationsWritten = 0;
+
+	/**
+	 * Total bytes of log data between the start position and the end of the
+	 * log, computed up front so callers can report a completion ratio.
+	 */
+	uint64_t totalBytes = 0;
+};
+
+/**
+ * Decodes a group of log entries into write operations by appending them to
+ * `batch`. This is the pluggable, C++-callable extension point for replay; the
+ * N-API layer adapts a JS batch callback to it.
+ */
+using TransactionLogReplayDecoder = std::function<rocksdb::Status(
+	const std::vector<TransactionLogReplayEntry>& entries,
+	rocksdb::WriteBatch& batch
+)>;
+
+/**
+ * Called after each write batch is applied. Return false to stop replay.
+ */
+using TransactionLogReplayProgressCallback = std::function<bool(const TransactionLogReplayProgress& progress)>;
+
+struct TransactionLogReplayOptions final {
+	/**
+	 * The number of log entries handed to the decoder per call.
+	 */
+	uint32_t entriesPerDecode = 1024;
+
+	/**
+	 * The write batch is applied once its data size reaches this many bytes.
+	 */
+	uint64_t batchBytes = 16 * 1024 * 1024;
+
+	/**
+	 * Replay starts at this position. A zero position means the store's last
+	 * flushed position (or the beginning of the oldest log when nothing has
+	 * been flushed yet).
+	 */
+	LogPosition startPosition = { 0, 0 };
+};
+
+/**
+ * Re-applies the writes recorded in a transaction log from its last flushed
+ * position onward. Entries are read straight from the log file memory maps,
+ * decoded in groups, and written into RocksDB through large `WriteBatch`es with
+ * the WAL disabled — the log itself is the durable record, which is what makes
+ * running with `disableWAL: true` recoverable after a crash.
+ *
+ * Intended for startup, before the database takes new writes: entries past the
+ * last flush are assumed committed, and the write batches are not coordinated
+ * with concurrent transactions.
+ */
+rocksdb::Status replayTransactionLog(
+	const std::shared_ptr<TransactionLogStore>& store,
+	rocksdb::DB* db,
+	const TransactionLogReplayOptions& options,
+	const TransactionLogReplayDecoder& decoder,
+	const TransactionLogReplayProgressCallback& onProgress,
+	TransactionLogReplayProgress& progress
+);
+
+} // namespace rocksdb_js
+
+#endif
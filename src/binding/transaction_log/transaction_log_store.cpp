@@ -237,6 +237,25 @@ std::shared_ptr<MemoryMap> TransactionLogStore::getMemoryMap(uint32_t logSequenc
 		isCurrent);
 }
 
+size_t TransactionLogStore::adviseReadAhead(uint32_t logSequenceNumber, uint32_t offset, bool sequential) {
+	if (!TransactionLogFile::readAheadEnabled.load(std::memory_order_relaxed)) {
+		return 0;
+	}
+	std::shared_ptr<TransactionLogFile> logFile;
+	{
+		std::lock_guard<std::mutex> lock(this->dataSetsMutex);
+		auto it = this->sequenceFiles.find(logSequenceNumber);
+		if (it == this->sequenceFiles.end()) {
+			return 0;
+		}
+		logFile = it->second;
+	}
+	// the madvise() runs outside dataSetsMutex; the file pins its own map
+	size_t advised = logFile->adviseReadAhead(offset, sequential);
+	this->readAheadBytes.fetch_add(advised, std::memory_order_relaxed);
+	return advised;
+}
+
 uint64_t TransactionLogStore::getLogFileSize(uint32_t logSequenceNumber) {
 	std::lock_guard<std::mutex> lock(this->dataSetsMutex);
 
@@ -463,6 +482,7 @@ void TransactionLogStore::collectStats(TransactionLogStoreStats& out) {
 	out.purgeRuns = this->purgeRuns.load(std::memory_order_relaxed);
 	out.databaseFlushes = this->databaseFlushes.load(std::memory_order_relaxed);
 	out.writeFailures = this->writeFailures.load(std::memory_order_relaxed);
+	out.readAheadBytes = this->readAheadBytes.load(std::memory_order_relaxed);
 	out.lastPurgeMs = this->lastPurgeMs.load(std::memory_order_relaxed);
 	out.maxFileSize = this->maxFileSize;
 	out.retentionMs = static_cast<uint64_t>(this->retentionMs.count());
@@ -478,8 +498,10 @@ void TransactionLogStore::collectStats(TransactionLogStoreStats& out) {
 	auto now = std::chrono::system_clock::now();
 	bool hasOldest = false;
 	std::chrono::system_clock::time_point oldestWriteTime;
+	// files with a live map, sampled with mincore once dataSetsMutex is released
+	std::vector<std::shared_ptr<TransactionLogFile>> mappedFiles;
 
-	std::lock_guard<std::mutex> lock(this->dataSetsMutex);
+	std::unique_lock<std::mutex> lock(this->dataSetsMutex);
 
 	out.currentSequenceNumber = this->currentSequenceNumber;
 	out.nextLogPosition = this->nextLogPosition;
@@ -512,6 +534,7 @@ void TransactionLogStore::collectStats(TransactionLogStoreStats& out) {
 		if (memoryMap) {
 			out.mappedBytes += memoryMap->mapSize;
 			out.activeMaps++;
+			mappedFiles.push_back(logFile);
 		}
 #if TRANSACTION_LOG_ENABLE_ANONYMOUS_OVERLAY && defined(PLATFORM_POSIX)
 		out.overlayBytes += logFile->lastOverlaySize.load(std::memory_order_relaxed);
@@ -554,10 +577,25 @@ void TransactionLogStore::collectStats(TransactionLogStoreStats& out) {
 		}
 	}
 
+	lock.unlock();
+
 	if (hasOldest) {
 		out.oldestFileAgeMs = static_cast<double>(
 			std::chrono::duration_cast<std::chrono::milliseconds>(now - oldestWriteTime).count());
 	}
+
+	// mincore is one syscall per live map, so it runs without dataSetsMutex,
+	// which writeBatch contends on. Only maps that existed are sampled, since
+	// unmapped files have no page-fault cost yet; residency() pins the map, so
+	// a file purged or unmapped meanwhile is skipped or sampled safely.
+	for (const auto& logFile : mappedFiles) {
+		uint64_t resident = 0;
+		uint64_t nonResident = 0;
+		if (logFile->residency(resident, nonResident)) {
+			out.residentBytes += resident;
+			out.nonResidentPages += nonResident;
+		}
+	}
 }
 
 void TransactionLogStore::purge(std::function<void(const std::filesystem::path&, uint32_t entryCount)> visitor, const bool all, const uint64_t before, const bool countEntries) {
@@ -699,7 +737,7 @@ void TransactionLogStore::registerLogFile(const std::filesystem::path& path, con
 	// Seed the in-memory last-write time from the on-disk mtime so the
 	// retention gauges in collectStats() are correct for files that are
 	// registered at startup discovery but never opened this session. This is
-	// a one-time stat() at registration; collectStats() itself is syscall-free.
+	// a one-time stat() at registration; collectStats() makes no syscalls under dataSetsMutex.
 	try {
 		logFile->fileLastWriteTime.store(
 			convertFileTimeToSystemTime(std::filesystem::last_write_time(path)),
@@ -734,7 +772,7 @@ void TransactionLogStore::writeBatch(TransactionLogEntryBatch& batch, LogPositio
 	}
 
 	DEBUG_LOG("%p TransactionLogStore::writeBatch Adding batch with %zu entries to store \"%s\" (current=%u, next=%u, timestamp=%llu)\n",
-		this, batch.entries.size(), this->name.c_str(), this->currentSequenceNumber.load(std::memory_order_relaxed), this->nextSequenceNumber, batch.timestamp);
+		this, batch.entries().size(), this->name.c_str(), this->currentSequenceNumber.load(std::memory_order_relaxed), this->nextSequenceNumber, batch.timestamp);
 
 	{
 		std::lock_guard<std::mutex> logPositionLock(this->dataSetsMutex);
@@ -860,11 +898,11 @@ void TransactionLogStore::writeBatch(TransactionLogEntryBatch& batch, LogPositio
 
 	// record lifetime write counters (observability only)
 	uint64_t batchBytes = 0;
-	for (const auto& entry : batch.entries) {
-		batchBytes += entry->size;
+	for (const auto& entry : batch.entries()) {
+		batchBytes += entry.size;
 	}
 	this->transactionsWritten.fetch_add(1, std::memory_order_relaxed);
-	this->entriesWritten.fetch_add(batch.entries.size(), std::memory_order_relaxed);
+	this->entriesWritten.fetch_add(batch.entries().size(), std::memory_order_relaxed);
 	this->bytesWritten.fetch_add(batchBytes, std::memory_order_relaxed);
 
 	DEBUG_LOG("%p TransactionLogStore::writeBatch Completed writing all entries\n", this);
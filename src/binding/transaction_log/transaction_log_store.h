@@ -115,6 +115,9 @@ struct TransactionLogStoreStats {
 	uint64_t mappedBytes = 0;  // virtual address space (current file maps full maxFileSize on POSIX)
 	uint64_t overlayBytes = 0; // POSIX file-backed overlay portion (0 on Windows)
 	uint32_t activeMaps = 0;
+	uint64_t residentBytes = 0;    // file-backed bytes of live maps resident in memory (mincore)
+	uint64_t nonResidentPages = 0; // file-backed pages of live maps that will fault on next read
+	uint64_t readAheadBytes = 0;   // lifetime bytes advised with MADV_WILLNEED
 
 	// transaction state
 	int32_t pendingTransactions = 0;
@@ -166,6 +169,9 @@ struct TransactionLogStoreStats {
 	X("txnlog.mappedBytes", mappedBytes) \
 	X("txnlog.overlayBytes", overlayBytes) \
 	X("txnlog.activeMaps", activeMaps) \
+	X("txnlog.residentBytes", residentBytes) \
+	X("txnlog.nonResidentPages", nonResidentPages) \
+	X("txnlog.readAheadBytes", readAheadBytes) \
 	X("txnlog.pendingTransactions", pendingTransactions) \
 	X("txnlog.uncommittedTransactions", uncommittedTransactions) \
 	X("txnlog.transactionsWritten", transactionsWritten) \
@@ -369,6 +375,7 @@ struct TransactionLogStore final {
 	std::atomic<uint64_t> purgeRuns = 0;
 	std::atomic<uint64_t> databaseFlushes = 0;
 	std::atomic<uint64_t> writeFailures = 0;
+	std::atomic<uint64_t> readAheadBytes = 0;
 	std::atomic<double> lastPurgeMs = 0;
 
 	TransactionLogStore(
@@ -441,6 +448,15 @@ struct TransactionLogStore final {
 	 */
 	void rotateToNextSequence(const std::shared_ptr<TransactionLogFile>& oldFile);
 
+	/**
+	 * Issues the read-ahead hints for the log file with the given sequence
+	 * number before it is scanned from `offset` (see
+	 * TransactionLogFile::adviseReadAhead). No-op unless read-ahead is enabled.
+	 *
+	 * @returns The number of bytes advised.
+	 */
+	size_t adviseReadAhead(uint32_t logSequenceNumber, uint32_t offset, bool sequential);
+
 	/**
 	* Get the log file size.
 	**/
@@ -5,14 +5,19 @@ import type { BufferWithDataView, Encoder, EncoderFunction, Key } from './encodi
 import {
 	addGlobalListener,
 	config,
+	type ConflictStats,
 	globalListenerCount,
 	globalNotify,
+	type IngestOptions,
 	removeGlobalListener,
 	type PurgedLog,
 	type PurgeLogsOptions,
 	type RocksDatabaseConfig,
 	type NativeTransactionOptions,
+	type TransactionEntry,
+	type TransactionLogReplayProgress,
 } from './load-binding.js';
+import { SstWriter, type SstWriterOptions } from './sst-writer.js';
 import type { StatsAll, StatsDefault, StatsValue } from './stats.js';
 import {
 	type ArrayBufferWithNotify,
@@ -21,6 +26,7 @@ import {
 	KEY_BUFFER,
 	Store,
 	type StoreOptions,
+	type TtlOptions,
 	type UserSharedBufferOptions,
 	VALUE_BUFFER,
 } from './store.js';
@@ -63,6 +69,37 @@ export interface TransactionOptions extends NativeTransactionOptions {
 	retryOnBusy?: boolean;
 }
 
+/**
+ * A write produced by a replay decoder. An `undefined` value removes the key.
+ */
+export type ReplayOperation = { key: Key; value?: any };
+
+export interface ReplayLogOptions {
+	/**
+	 * Decodes a group of log entries into the writes they represent.
+	 */
+	decodeBatch: (entries: TransactionEntry[]) => Iterable<ReplayOperation> | void;
+
+	/**
+	 * The write batch is applied once it holds this many bytes.
+	 *
+	 * @default 16MB
+	 */
+	batchBytes?: number;
+
+	/**
+	 * The number of log entries passed to each `decodeBatch()` call.
+	 *
+	 * @default 1024
+	 */
+	entriesPerDecode?: number;
+
+	/**
+	 * Called after each write batch is applied. Return `false` to stop.
+	 */
+	onProgress?: (progress: TransactionLogReplayProgress) => boolean | void;
+}
+
 export type RocksDBStat = StatsValue;
 export type RocksDBStats = StatsDefault | StatsAll;
 
@@ -241,6 +278,31 @@ export class RocksDatabase extends DBI<DBITransactional> {
 		});
 	}
 
+	/**
+	 * Creates a writer that builds an SST file for this database's column
+	 * family, to be loaded with `ingest()`. Bulk loads written this way skip
+	 * the memtable, WAL and compactions a `putSync()` per record goes through.
+	 *
+	 * @param path - The path of the SST file to create.
+	 * @param options.sort - When `true`, entries may be put in any order and
+	 * are sorted natively (spilling to disk past `sortMemory` bytes) when the
+	 * file is finished.
+	 *
+	 * @example
+	 * ```typescript
+	 * const db = RocksDatabase.open('/path/to/database');
+	 * const writer = db.createSstWriter('/path/to/bulk.sst', { sort: true });
+	 * for (const record of records) {
+	 *   writer.put(record.id, record);
+	 * }
+	 * writer.finish();
+	 * await db.ingest(['/path/to/bulk.sst'], { moveFiles: true });
+	 * ```
+	 */
+	createSstWriter(path: string, options?: SstWriterOptions): SstWriter {
+		return new SstWriter(this.store, path, options);
+	}
+
 	/**
 	 * Compacts the entire key range of the database synchronously.
 	 * This triggers manual compaction which removes tombstones and reclaims space.
@@ -356,6 +418,42 @@ export class RocksDatabase extends DBI<DBITransactional> {
 		return this.store.encoder;
 	}
 
+	/**
+	 * Finishes a bulk load started with the `bulkLoad` open option. Compacts
+	 * the entire column family using all `parallelismThreads` subcompactions,
+	 * then reverts to the normal compaction settings and turns the WAL back
+	 * on. The bulk load memtable stays until the database is reopened, so
+	 * close and reopen it before serving reads.
+	 *
+	 * @example
+	 * ```typescript
+	 * const db = RocksDatabase.open('/path/to/database', { bulkLoad: true });
+	 * for (const record of records) {
+	 *   db.putSync(record.id, record);
+	 * }
+	 * await db.finishBulkLoad();
+	 * db.close();
+	 * const reopened = RocksDatabase.open('/path/to/database');
+	 * ```
+	 */
+	finishBulkLoad(): Promise<void> {
+		return new Promise((resolve, reject) => this.store.db.finishBulkLoad(resolve, reject));
+	}
+
+	/**
+	 * Synchronously finishes a bulk load started with the `bulkLoad` open
+	 * option.
+	 *
+	 * @example
+	 * ```typescript
+	 * const db = RocksDatabase.open('/path/to/database', { bulkLoad: true });
+	 * db.finishBulkLoadSync();
+	 * ```
+	 */
+	finishBulkLoadSync(): void {
+		return this.store.db.finishBulkLoadSync();
+	}
+
 	/**
 	 * Flushes the underlying database by performing a commit or clearing any buffered operations.
 	 *
@@ -376,6 +474,27 @@ export class RocksDatabase extends DBI<DBITransactional> {
 
 	// flushed
 
+	/**
+	 * Gets the keys transactions have conflicted on, most conflicted first.
+	 * Requires the `conflictStatsSize` option, which sets how many keys are
+	 * tracked; only the hottest keys are kept, so counts of keys that were
+	 * evicted and came back are overestimates by at most `error`.
+	 *
+	 * @param options.reset - When `true`, clears the counters after reading.
+	 *
+	 * @example
+	 * ```typescript
+	 * const db = RocksDatabase.open('/path/to/database', { conflictStatsSize: 100 });
+	 * const { conflicts, keys } = db.getConflictStats();
+	 * for (const { key, count, maxRetries } of keys) {
+	 *   console.log(key, count, maxRetries);
+	 * }
+	 * ```
+	 */
+	getConflictStats(options?: { reset?: boolean }): ConflictStats {
+		return this.store.db.getConflictStats(options?.reset === true);
+	}
+
 	/**
 	 * Gets a RocksDB database property as an integer.
 	 *
@@ -520,6 +639,38 @@ export class RocksDatabase extends DBI<DBITransactional> {
 		return this.store.hasLock(key);
 	}
 
+	/**
+	 * Ingests SST files built with `createSstWriter()` into the column family.
+	 * Keys in the files replace existing values, and versions cached in the
+	 * verification table for this column family are invalidated.
+	 *
+	 * @param files - The paths of the SST files.
+	 * @param options.moveFiles - When `true`, the files are hard linked into
+	 * the database instead of copied.
+	 *
+	 * @example
+	 * ```typescript
+	 * const db = RocksDatabase.open('/path/to/database');
+	 * await db.ingest(['/path/to/bulk.sst'], { moveFiles: true });
+	 * ```
+	 */
+	ingest(files: string[], options?: IngestOptions): Promise<void> {
+		return new Promise((resolve, reject) => this.store.db.ingest(resolve, reject, files, options));
+	}
+
+	/**
+	 * Synchronously ingests SST files into the column family.
+	 *
+	 * @example
+	 * ```typescript
+	 * const db = RocksDatabase.open('/path/to/database');
+	 * db.ingestSync(['/path/to/bulk.sst']);
+	 * ```
+	 */
+	ingestSync(files: string[], options?: IngestOptions): void {
+		this.store.db.ingestSync(files, options);
+	}
+
 	async ifNoExists(_key: Key): Promise<void> {
 		//
 	}
@@ -541,6 +692,24 @@ export class RocksDatabase extends DBI<DBITransactional> {
 		return this.store.verifyVersion(key, version);
 	}
 
+	/**
+	 * Batched `verifyVersion()` for a page of cached records: checks every key
+	 * in a single native call. Returns a bitmap where bit `i` (LSB first) is set
+	 * when `keys[i]` is fresh. Pass `bitmap` to reuse a buffer across calls.
+	 *
+	 * ```typescript
+	 * const fresh = db.verifyVersions(keys, versions);
+	 * for (let i = 0; i < keys.length; i++) {
+	 *   if (fresh[i >> 3] & (1 << (i & 7))) {
+	 *     // cached entry i is still current
+	 *   }
+	 * }
+	 * ```
+	 */
+	verifyVersions(keys: Key[], versions: ArrayLike<number>, bitmap?: Uint8Array): Uint8Array {
+		return this.store.verifyVersions(keys, versions, bitmap);
+	}
+
 	/**
 	 * Seeds the verification-table slot for `key` with `version`. Has no
 	 * effect if the slot is currently lock-tagged or if the verification
@@ -749,6 +918,65 @@ export class RocksDatabase extends DBI<DBITransactional> {
 		return this.store.db.purgeLogs(options);
 	}
 
+	/**
+	 * Re-applies the writes recorded in a transaction log from its last flushed
+	 * position onward, rebuilding memtable state that was lost when a database
+	 * opened with `disableWAL` crashed before flushing. Entries are read and
+	 * applied natively in large write batches with the WAL disabled; only the
+	 * decoding runs in JS.
+	 *
+	 * Call this at startup, before the database takes new writes.
+	 *
+	 * @example
+	 * ```typescript
+	 * const db = RocksDatabase.open('/path/to/database', { disableWAL: true });
+	 * db.replayLog('audit', {
+	 *   decodeBatch: (entries) => entries.map(({ data }) => JSON.parse(data.toString())),
+	 *   onProgress: ({ bytesReplayed, totalBytes }) => console.log(bytesReplayed / totalBytes),
+	 * });
+	 * ```
+	 */
+	replayLog(name: string | number, options: ReplayLogOptions): TransactionLogReplayProgress {
+		const { decodeBatch, ...nativeOptions } = options;
+		const store = this.store;
+		return this.useLog(name)._replay((entries) => {
+			const ops: (Buffer | undefined)[] = [];
+			for (const { key, value } of decodeBatch(entries) ?? []) {
+				// encode the value before the key (see `Store.putSync()`), and copy
+				// both since the encoders reuse their buffers
+				const valueBuffer = value === undefined ? undefined : Buffer.from(store.encodeValue(value));
+				const keyBuffer = store.encodeKey(key);
+				ops.push(Buffer.from(keyBuffer.subarray(0, keyBuffer.end)), valueBuffer);
+			}
+			return ops;
+		}, nativeOptions);
+	}
+
+	/**
+	 * Replaces the TTL rule of the column family. Records whose version
+	 * timestamp (the float64 at the start of the value) is older than `ttl`
+	 * milliseconds, or below the `expiresBefore` of a key prefix they start
+	 * with, are dropped by the compactions that start afterwards; call
+	 * `compact()` to drop them right away. Versions cached in the verification
+	 * table for dropped keys are invalidated once the compaction completes.
+	 *
+	 * The rule is kept in memory until the database is closed. Calling it
+	 * without options removes the rule.
+	 *
+	 * @example
+	 * ```typescript
+	 * const db = RocksDatabase.open('/path/to/database');
+	 * db.setTtl({
+	 *   ttl: 7 * 24 * 60 * 60 * 1000,
+	 *   prefixes: [{ prefix: 'session:', expiresBefore: Date.now() }],
+	 * });
+	 * await db.compact();
+	 * ```
+	 */
+	setTtl(options?: TtlOptions): void {
+		this.store.setTtl(options);
+	}
+
 	/**
 	 * The status of the database.
 	 */
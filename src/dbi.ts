@@ -1,7 +1,14 @@
 import type { BufferWithDataView, Key } from './encoding.js';
 import { FRESH_VERSION_FLAG } from './load-binding.js';
 import type { NativeTransaction, TransactionLog } from './load-binding.js';
-import type { GetOptions, PutOptions, Store, StoreContext, StoreGetOptions } from './store.js';
+import type {
+	GetOptions,
+	PutOptions,
+	RemoveRangeOptions,
+	Store,
+	StoreContext,
+	StoreGetOptions,
+} from './store.js';
 import type { Transaction } from './transaction.js';
 import { type MaybePromise, when } from './util.js';
 
@@ -355,6 +362,46 @@ export class DBI<T extends DBITransactional | unknown = unknown> {
 		return this.store.db.listeners(event);
 	}
 
+	/**
+	 * Merges an operand into the value for the given key with the native merge
+	 * operator set by the `mergeOperator` option, without reading the value
+	 * first. For `add`, the operand is a number or bigint delta; otherwise it
+	 * is encoded like a value. Merged values are read with `getBinary()`.
+	 *
+	 * In a transaction, the operand is applied when the transaction commits.
+	 * Merges commute, so the key is not locked or conflict checked.
+	 *
+	 * @param key - The key to merge the operand into.
+	 * @param operand - The operand to merge.
+	 * @param options - The merge options.
+	 *
+	 * @example
+	 * ```typescript
+	 * const db = RocksDatabase.open('/path/to/database', { mergeOperator: 'add' });
+	 * await db.merge('hits', 1);
+	 * ```
+	 */
+	async merge(key: Key, operand: any, options?: T): Promise<void> {
+		return this.store.mergeSync(this._context, key, operand, options);
+	}
+
+	/**
+	 * Synchronously merges an operand into the value for the given key.
+	 *
+	 * @param key - The key to merge the operand into.
+	 * @param operand - The operand to merge.
+	 * @param options - The merge options.
+	 *
+	 * @example
+	 * ```typescript
+	 * const db = RocksDatabase.open('/path/to/database', { mergeOperator: 'add' });
+	 * db.mergeSync('hits', 1);
+	 * ```
+	 */
+	mergeSync(key: Key, operand: any, options?: T): void {
+		return this.store.mergeSync(this._context, key, operand, options);
+	}
+
 	/**
 	 * Notifies an event for the given key.
 	 *
@@ -471,6 +518,40 @@ export class DBI<T extends DBITransactional | unknown = unknown> {
 		return this.store.removeSync(this._context, key, options);
 	}
 
+	/**
+	 * Removes every key from `start` (inclusive) to `end` (exclusive) with a
+	 * single range tombstone instead of one tombstone per key.
+	 *
+	 * In a transaction, the range is removed when the transaction commits. It
+	 * is not locked or conflict checked, reads in the transaction still see
+	 * the removed keys, and savepoints can no longer be rolled back to.
+	 *
+	 * @param options - The range to remove.
+	 *
+	 * @example
+	 * ```typescript
+	 * await db.removeRange({ start: 'tenant-42:', end: 'tenant-42;' });
+	 * ```
+	 */
+	async removeRange(options: RemoveRangeOptions & T): Promise<void> {
+		return this.store.removeRange(this._context, options);
+	}
+
+	/**
+	 * Synchronously removes every key from `start` (inclusive) to `end`
+	 * (exclusive) with a single range tombstone.
+	 *
+	 * @param options - The range to remove.
+	 *
+	 * @example
+	 * ```typescript
+	 * db.removeRangeSync({ start: 'tenant-42:', end: 'tenant-42;' });
+	 * ```
+	 */
+	removeRangeSync(options: RemoveRangeOptions & T): void {
+		return this.store.removeRangeSync(this._context, options);
+	}
+
 	/**
 	 * Removes an event listener. You must specify the exact same callback that was
 	 * used in `addListener()`.
@@ -10,6 +10,8 @@ export {
 export type { BackupStreamOptions } from './backup-stream.js';
 export {
 	RocksDatabase,
+	type ReplayLogOptions,
+	type ReplayOperation,
 	type RocksDatabaseOptions,
 	type RocksDBStat,
 	type RocksDBStats,
@@ -19,18 +21,28 @@ export { DBI, type IteratorOptions } from './dbi.js';
 export type { Key } from './encoding.js';
 export type * from './stats.js';
 export {
+	backgroundStats,
+	type BackgroundPoolStats,
+	commitLaneStats,
+	type ConflictKeyStats,
+	type ConflictStats,
 	constants,
 	coolTransactionLogs,
 	currentThreadId,
 	fileLockRelease,
+	type IngestOptions,
+	type MergeOperator,
 	tryFileLock,
 	registryStatus,
 	stats,
 	shutdown,
+	type SstFileInfo,
 	TransactionLog,
 	type TransactionEntry,
 	type TransactionLogPosition,
+	type TransactionLogReplayProgress,
 	type TransactionLogStats,
+	valueCacheStats,
 } from './load-binding.js';
 export * from './parse-transaction-log.js';
 export {
@@ -40,6 +52,8 @@ export {
 	type ValidateTransactionLogStoreOptions,
 } from './validate-transaction-log.js';
 export {
+	type GetManyOptions,
+	type RemoveRangeOptions,
 	Store,
 	type StoreContext,
 	type StoreGetOptions,
@@ -47,7 +61,10 @@ export {
 	type StorePutOptions,
 	type StoreRangeOptions,
 	type StoreRemoveOptions,
+	type StoreRemoveRangeOptions,
+	type TtlOptions,
 } from './store.js';
+export { SstWriter, type SstWriterOptions } from './sst-writer.js';
 export { Transaction } from './transaction.js';
 
 import './transaction-log-reader.js';
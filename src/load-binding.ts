@@ -40,6 +40,16 @@ export type NativeTransactionOptions = {
 	 * @default false
 	 */
 	coordinatedRetry?: boolean;
+
+	/**
+	 * When `true`, the transaction only reads: it does not begin a RocksDB
+	 * transaction, reads observe a snapshot pinned on the first read, writes
+	 * and transaction log entries are rejected, and committing releases the
+	 * snapshot without going through the commit pipeline.
+	 *
+	 * @default false
+	 */
+	readOnly?: boolean;
 };
 
 export type NativeTransaction = {
@@ -57,14 +67,56 @@ export type NativeTransaction = {
 		expectedVersion?: number
 	): number;
 	getCount(options?: RangeOptions): number;
+	// packedKeys holds each key prefixed with its big-endian uint32 length; the
+	// result holds each value the same way, with 0xffffffff for a missing key
+	getMany(packedKeys: Buffer, count: number, flags: number, forUpdate: boolean): Buffer;
 	getSync(keyLengthOrKeyBuffer: number | Buffer): Buffer | number | undefined;
 	getTimestamp(): number;
+	mergeSync(key: Key, operand: Buffer | Uint8Array, txnId?: number): void;
+	popSavepoint(): void;
 	putSync(key: Key, value: Buffer | Uint8Array, txnId?: number): void;
+	removeRangeSync(start: Buffer, end: Buffer): void;
 	removeSync(key: Key): void;
+	rollbackToSavepoint(): void;
+	setSavepoint(): void;
 	setTimestamp(timestamp?: number): void;
 	useLog(name: string | number): TransactionLog;
 };
 
+export type NativeSstWriterOptions = {
+	/**
+	 * When `true`, entries may be written in any order: they are sorted
+	 * natively, spilling to disk past `sortMemory`, when the file is finished.
+	 * Otherwise keys must be written in strictly ascending order.
+	 */
+	sort?: boolean;
+	/**
+	 * The bytes of entries the sorter buffers before spilling a sorted run to
+	 * disk. Defaults to 64 MiB.
+	 */
+	sortMemory?: number;
+};
+
+/**
+ * A finished SST file, returned by `SstWriter.finish()`.
+ */
+export type SstFileInfo = {
+	path: string;
+	entries: number;
+	fileSize: number;
+	smallestKey: Buffer;
+	largestKey: Buffer;
+};
+
+export type NativeSstWriter = {
+	new (db: NativeDatabase, path: string, options?: NativeSstWriterOptions): NativeSstWriter;
+	abort(): void;
+	finish(): SstFileInfo;
+	// packed holds each key then its value, each prefixed with its big-endian
+	// uint32 length
+	putBatch(packed: Buffer, count: number): void;
+};
+
 export type LogBuffer = Buffer & { dataView: DataView; logId: number; size: number };
 
 export type TransactionLogQueryOptions = {
@@ -93,6 +145,9 @@ export type TransactionLogPosition = { sequence: number; offset: number };
  * file is mapped at the full configured `maxFileSize` on POSIX, so it does not
  * reflect resident memory. `memory.overlayBytes` (POSIX only; 0 on Windows) is
  * the file-backed portion and is the closer proxy for real consumption.
+ * `memory.residentBytes` and `memory.nonResidentPages` sample the live maps
+ * with `mincore()` (POSIX only; 0 on Windows); non-resident pages are the ones
+ * the next read will page-fault on.
  */
 export type TransactionLogStats = {
 	name: string;
@@ -109,6 +164,8 @@ export type TransactionLogStats = {
 		mappedBytes: number;
 		overlayBytes: number;
 		activeMaps: number;
+		residentBytes: number;
+		nonResidentPages: number;
 	};
 	nextLogPosition: TransactionLogPosition;
 	lastFlushedPosition: TransactionLogPosition;
@@ -129,6 +186,7 @@ export type TransactionLogStats = {
 		purgeRuns: number;
 		databaseFlushes: number;
 		writeFailures: number;
+		readAheadBytes: number;
 	};
 	config: {
 		maxFileSize: number;
@@ -137,6 +195,29 @@ export type TransactionLogStats = {
 	};
 };
 
+/**
+ * Progress of a transaction log replay, passed to the `onProgress` callback
+ * after each write batch and returned when the replay finishes. `position` is
+ * just past the last applied entry; `bytesReplayed / totalBytes` is the
+ * completion ratio.
+ */
+export type TransactionLogReplayProgress = {
+	startPosition: TransactionLogPosition;
+	position: TransactionLogPosition;
+	entriesReplayed: number;
+	bytesReplayed: number;
+	batchesWritten: number;
+	operationsWritten: number;
+	totalBytes: number;
+};
+
+export type NativeTransactionLogReplayOptions = {
+	batchBytes?: number;
+	entriesPerDecode?: number;
+	onProgress?: (progress: TransactionLogReplayProgress) => boolean | void;
+	startPosition?: number;
+};
+
 export type TransactionLog = {
 	new (db: NativeDatabase, name: string): TransactionLog;
 	addEntry(data: Buffer | Uint8Array, txnId?: number): void;
@@ -145,6 +226,7 @@ export type TransactionLog = {
 	name: string;
 	path: string;
 	query(options?: TransactionLogQueryOptions): IterableIterator<TransactionEntry>;
+	_adviseReadAhead(sequenceId: number, offset: number): number;
 	_currentLogBuffer: LogBuffer;
 	_findPosition(timestamp: number): number;
 	_getLastCommittedPosition(): Buffer;
@@ -152,6 +234,10 @@ export type TransactionLog = {
 	_getMemoryMapOfFile(sequenceId: number): LogBuffer | undefined;
 	_lastCommittedPosition: Float64Array;
 	_logBuffers: Map<number, WeakRef<LogBuffer>>;
+	_replay(
+		decodeBatch: (entries: TransactionEntry[]) => (Buffer | undefined)[] | void,
+		options?: NativeTransactionLogReplayOptions
+	): TransactionLogReplayProgress;
 };
 
 /**
@@ -193,23 +279,104 @@ export declare class NativeIteratorCls {
 
 export type NativeDatabaseMode = 'optimistic' | 'pessimistic';
 
+/**
+ * A built-in native merge operator:
+ * - `add` adds a signed 64-bit delta to an 8-byte big-endian counter
+ * - `append` appends the value as a uint32 big-endian length-prefixed element
+ * - `maxVersion` keeps the value with the highest float64 version prefix
+ */
+export type MergeOperator = 'add' | 'append' | 'maxVersion';
+
 export type NativeDatabaseOptions = {
+	/**
+	 * Lets the writers of a write group insert into the memtable in parallel
+	 * once the leader has written the WAL. Turned off by `bulkLoad`.
+	 */
+	allowConcurrentMemtableWrite?: boolean;
+	/**
+	 * Puts blob values in the process-wide block cache.
+	 */
+	blobCacheShared?: boolean;
+	/**
+	 * The size in bytes of a dedicated blob cache. 0 disables it.
+	 */
+	blobCacheSize?: number;
+	blobCompactionReadaheadSize?: number;
+	blobFileSize?: number;
+	/**
+	 * The fraction of the oldest blob files garbage collection rewrites.
+	 */
+	blobGarbageCollectionAgeCutoff?: number;
+	/**
+	 * Bits per key of the bloom filter built for each SST file. 0 builds none.
+	 */
+	bloomFilterBitsPerKey?: number;
+	/**
+	 * Opens the database for a bulk load until `finishBulkLoad()` is called.
+	 */
+	bulkLoad?: boolean;
+	/**
+	 * Loads index and filter blocks through the block cache at high priority.
+	 */
+	cacheIndexAndFilterBlocks?: boolean;
+	/**
+	 * The number of keys the conflict profiler tracks. 0 disables it.
+	 */
+	conflictStatsSize?: number;
 	dbWriteBufferSize?: number;
 	disableWAL?: boolean;
 	enableStats?: boolean;
 	maxOpenFiles?: number;
 	maxWriteBufferNumber?: number;
 	maxWriteBufferSizeToMaintain?: number;
+	/**
+	 * The size cap in bytes of a value built by the `append` merge operator.
+	 * The oldest elements are dropped past it. 0 is unbounded.
+	 */
+	mergeAppendLimit?: number;
+	/**
+	 * The built-in merge operator `merge()` uses for this column family.
+	 */
+	mergeOperator?: MergeOperator;
+	/**
+	 * Values at least this many bytes are stored in blob files.
+	 */
+	minBlobSize?: number;
 	mode?: NativeDatabaseMode;
 	name?: string;
 	noBlockCache?: boolean;
+	/**
+	 * Partitions index and filter blocks behind a top-level index.
+	 */
+	partitionedIndexFilters?: boolean;
+	pinL0FilterAndIndexBlocksInCache?: boolean;
+	pinTopLevelIndexAndFilter?: boolean;
 	parallelismThreads?: number;
 	readOnly?: boolean;
 	statsLevel?: (typeof stats.StatsLevel)[keyof typeof stats.StatsLevel];
+	/**
+	 * Compacts the key ranges iterators find full of tombstones in the
+	 * background, and lets RocksDB compact deletion-heavy SST files.
+	 */
+	tombstoneCompaction?: boolean;
+	/**
+	 * The I/O budget of tombstone compaction, in bytes of compacted range per
+	 * second. 0 is unlimited.
+	 */
+	tombstoneCompactionBytesPerSecond?: number;
+	/**
+	 * The number of tombstones an iterator must skip for its range to be
+	 * compacted.
+	 */
+	tombstoneCompactionThreshold?: number;
 	transactionLogMaxAgeThreshold?: number;
 	transactionLogMaxSize?: number;
 	transactionLogRetentionMs?: number;
 	transactionLogsPath?: string;
+	/**
+	 * The most closed transactions kept for reuse. 0 disables the pool.
+	 */
+	transactionPoolSize?: number;
 	/**
 	 * When true, transaction writes to this column family invalidate the
 	 * VerificationTable slot for each written key at write time (not at
@@ -218,6 +385,11 @@ export type NativeDatabaseOptions = {
 	 */
 	verificationTable?: boolean;
 	writeBufferSize?: number;
+	/**
+	 * Microseconds a writer spins waiting for the write leader before it
+	 * blocks.
+	 */
+	writeThreadMaxYieldUsec?: number;
 };
 
 type ResolveCallback<T> = (value: T) => void;
@@ -225,6 +397,15 @@ type RejectCallback = (err: Error) => void;
 
 export type UserSharedBufferCallback = () => void;
 
+export type IngestOptions = {
+	/**
+	 * When `true`, the files are hard linked into the database instead of
+	 * copied (falling back to a copy across filesystems), and the originals
+	 * should not be reused.
+	 */
+	moveFiles?: boolean;
+};
+
 export type PurgeLogsOptions = {
 	before?: number;
 	destroy?: boolean;
@@ -242,6 +423,48 @@ export type PurgeLogsOptions = {
  */
 export type PurgedLog = { path: string; entries: number };
 
+/**
+ * A key transactions have conflicted on, as tracked by the conflict profiler.
+ */
+export type ConflictKeyStats = {
+	columnFamily: string;
+	/**
+	 * The key, or its first 64 bytes when `truncated` is `true`.
+	 */
+	key: Buffer;
+	truncated: boolean;
+	/**
+	 * The number of conflicts attributed to the key. An overestimate by at most
+	 * `error`.
+	 */
+	count: number;
+	/**
+	 * The count the key inherited when it replaced a less conflicted key.
+	 */
+	error: number;
+	/**
+	 * The most times a transaction had already been retried when it conflicted
+	 * on the key.
+	 */
+	maxRetries: number;
+};
+
+/**
+ * The conflict profiler's counters, returned by `getConflictStats()`.
+ */
+export type ConflictStats = {
+	capacity: number;
+	conflicts: number;
+	/**
+	 * Conflicts no key could be attributed to.
+	 */
+	unattributed: number;
+	/**
+	 * The tracked keys, most conflicted first.
+	 */
+	keys: ConflictKeyStats[];
+};
+
 export type NativeDatabase = {
 	new (): NativeDatabase;
 	addListener(event: string, callback: (...args: any[]) => void): void;
@@ -274,6 +497,8 @@ export type NativeDatabase = {
 	destroy(): void;
 	drop(resolve: ResolveCallback<void>, reject: RejectCallback): void;
 	dropSync(): void;
+	finishBulkLoad(resolve: ResolveCallback<void>, reject: RejectCallback): void;
+	finishBulkLoadSync(): void;
 	flush(resolve: ResolveCallback<void>, reject: RejectCallback): void;
 	flushSync(): void;
 	notify(event: string | BufferWithDataView, args?: any[]): boolean;
@@ -285,6 +510,7 @@ export type NativeDatabase = {
 		txnId?: number,
 		expectedVersion?: number
 	): number;
+	getConflictStats(reset: boolean): ConflictStats;
 	getCount(options?: RangeOptions, txnId?: number): number;
 	getDBIntProperty(propertyName: string): number | undefined;
 	getDBProperty(propertyName: string): string | undefined;
@@ -305,16 +531,37 @@ export type NativeDatabase = {
 		callback?: UserSharedBufferCallback
 	): ArrayBuffer;
 	hasLock(key: BufferWithDataView): boolean;
+	ingest(
+		resolve: ResolveCallback<void>,
+		reject: RejectCallback,
+		files: string[],
+		options?: IngestOptions
+	): void;
+	ingestSync(files: string[], options?: IngestOptions): void;
 	listeners(event: string | BufferWithDataView): number;
 	listLogs(): string[];
+	mergeSync(key: BufferWithDataView, operand: Buffer | Uint8Array, txnId?: number): void;
 	opened: boolean;
 	open(path: string, options?: NativeDatabaseOptions): void;
+	parkRead(
+		keyLengthOrKeyBuffer: number | Buffer,
+		id: number,
+		onWake: (id: number) => void
+	): boolean;
 	populateVersion(keyLengthOrKeyBuffer: number | Buffer, version: number): void;
 	purgeLogs(options: PurgeLogsOptions & { includeEntryCounts: true }): PurgedLog[];
 	purgeLogs(options?: PurgeLogsOptions & { includeEntryCounts?: false }): string[];
 	purgeLogs(options?: PurgeLogsOptions): string[] | PurgedLog[];
 	putSync(key: BufferWithDataView, value: any, txnId?: number): void;
 	removeListener(event: string | BufferWithDataView, callback: () => void): boolean;
+	removeRange(
+		resolve: ResolveCallback<void>,
+		reject: RejectCallback,
+		start: Buffer,
+		end: Buffer,
+		options?: { compact?: boolean }
+	): void;
+	removeRangeSync(start: Buffer, end: Buffer, txnId?: number, options?: { compact?: boolean }): void;
 	removeSync(key: BufferWithDataView, txnId?: number): void;
 	// Provide a buffer that is used as the default/shared buffer for keys, where functions that provide a key can do so by assigning the key to the shared buffer and providing the length.
 	// A null value will reset the buffer.
@@ -326,24 +573,71 @@ export type NativeDatabase = {
 	// the key length (index 0) and value length (index 1) of each iteration
 	// step without per-iteration NAPI property accesses.
 	setIteratorState(buffer: Buffer | Uint8Array): void;
+	setTtl(ttl: number, prefixes?: { prefix: Buffer; expiresBefore: number }[]): void;
 	tryLock(key: BufferWithDataView, callback?: () => void): boolean;
 	unlock(key: BufferWithDataView): void;
 	useLog(name: string): TransactionLog;
 	verifyVersion(keyLengthOrKeyBuffer: number | Buffer, version: number): boolean;
+	verifyVersions(packedKeys: Buffer, versions: Float64Array, bitmap: Uint8Array): number;
 	withLock(key: BufferWithDataView, callback: () => void | Promise<void>): Promise<void>;
 };
 
 export type RocksDatabaseConfig = {
+	/**
+	 * When `true`, the shared rate limiter tunes its rate between 1/20 of
+	 * `ioRateLimitBytesPerSec` and all of it, by how often requests wait. Must
+	 * be set on the same `config()` call that first enables the rate limiter.
+	 *
+	 * @default false
+	 */
+	autoTune?: boolean;
+	/**
+	 * Sizes of the process-wide flush (`high`) and compaction (`low`) thread
+	 * pools shared by every database. Once a pool is sized here, opening a
+	 * database no longer resizes it with `parallelismThreads`. Between 0 and
+	 * 1024; 0 hands the pool back to `parallelismThreads`.
+	 */
+	backgroundThreads?: { high?: number; low?: number };
 	blockCacheSize?: number;
+	/**
+	 * Bytes per second shared by the flushes and compactions of every database
+	 * opened afterwards. Can be changed at runtime; 0 stops limiting databases
+	 * opened afterwards.
+	 *
+	 * @default 0
+	 */
+	ioRateLimitBytesPerSec?: number;
 	/**
 	 * Number of slots in the process-global verification table. Each slot is
-	 * 8 bytes; the default of 128K slots is 1 MB. Set to 0 to disable.
+	 * 8 bytes plus a 1-byte partition tag; the default of 128K slots is
+	 * 1.125 MB. Set to 0 to disable.
 	 *
 	 * Must be configured before the first database is opened. Once the table
 	 * is materialized, attempts to change this value will throw.
 	 */
 	verificationTableEntries?: number;
+	/**
+	 * Byte budget of the process-global value cache, which shares raw record
+	 * values read by `getSync()` with an `expectedVersion` across every thread,
+	 * so workers stop caching (and missing on) their own copies of hot records.
+	 * An entry is only served while the verification table still holds its
+	 * version. Can be changed at runtime; 0 disables the cache and frees it.
+	 *
+	 * @default 0
+	 */
+	valueCacheSize?: number;
 	compactOnClose?: boolean;
+	/**
+	 * Number of process-wide commit lanes shared by all databases. When greater
+	 * than 0, databases opened afterwards run their async commits on one of
+	 * these lanes (chosen by a stable hash of the database path, so per-database
+	 * commit order is preserved) instead of on their own dedicated commit
+	 * thread(s). Useful for processes that open many databases. Between 0 and
+	 * 256.
+	 *
+	 * @default 0
+	 */
+	commitLanes?: number;
 	/**
 	 * Total memtable memory limit (bytes) shared across every database opened
 	 * in this process. When set, RocksDB uses a single `WriteBufferManager` so
@@ -378,6 +672,25 @@ export type RocksDatabaseConfig = {
 	 * @default false
 	 */
 	writeBufferManagerAllowStall?: boolean;
+	/**
+	 * When `true`, transaction log files about to be scanned (by `query()`
+	 * cursors and `replayLog()`) get read-ahead hints: the file-backed portion
+	 * of a map is populated up front (`MAP_POPULATE` on Linux) and the scanned
+	 * range is advised with `MADV_WILLNEED` and `MADV_SEQUENTIAL`, so catch-up
+	 * scans don't fault one 4 KB page at a time. POSIX only.
+	 *
+	 * @default false
+	 */
+	transactionLogReadAhead?: boolean;
+	/**
+	 * When `true`, the anonymous region backing the active transaction log
+	 * file's full `maxFileSize` reservation is advised with `MADV_HUGEPAGE`
+	 * (Linux, when transparent huge pages are set to `madvise`), reducing TLB
+	 * pressure for readers. Applies to maps created after the call.
+	 *
+	 * @default false
+	 */
+	transactionLogHugePages?: boolean;
 };
 
 const nativeExtRE = /\.node$/;
@@ -500,6 +813,7 @@ export const constants: {
 } = binding.constants;
 export const NativeDatabase: NativeDatabase = binding.Database;
 export const NativeIterator: typeof NativeIteratorCls = binding.Iterator;
+export const NativeSstWriter: NativeSstWriter = binding.SstWriter;
 export const NativeTransaction: NativeTransaction = binding.Transaction;
 export const TransactionLog: TransactionLog = binding.TransactionLog;
 export const registryStatus: () => RegistryStatus = binding.registryStatus;
@@ -522,6 +836,55 @@ export const currentThreadId: () => number = binding.currentThreadId;
 export const coolTransactionLogs: () => { maps: number; bytes: number } =
 	binding.coolTransactionLogs;
 
+/**
+ * Process-wide commit lane configuration (`config({ commitLanes })`) and the
+ * number of queued (not yet started) commits on each allocated lane. `depths`
+ * may be longer than `lanes` when the lane count has been lowered, since lanes
+ * assigned to open databases are kept. Diagnostic only.
+ */
+export const commitLaneStats: () => { lanes: number; depths: number[] } =
+	binding.commitLaneStats;
+
+/**
+ * One process-wide background thread pool's size, queued and completed jobs,
+ * thread time spent on jobs, and the bytes and requests the rate limiter let
+ * through at its priority.
+ */
+export type BackgroundPoolStats = {
+	threads: number;
+	queued: number;
+	completed: number;
+	busyMs: number;
+	rateLimitedBytes: number;
+	rateLimitedRequests: number;
+};
+
+/**
+ * Process-wide flush (`high`) and compaction (`low`) thread pool stats and the
+ * shared rate limiter's current rate (`config({ backgroundThreads,
+ * ioRateLimitBytesPerSec })`). Diagnostic only.
+ */
+export const backgroundStats: () => {
+	high: BackgroundPoolStats;
+	low: BackgroundPoolStats;
+	ioRateLimitBytesPerSec: number;
+} = binding.backgroundStats;
+
+/**
+ * Process-wide value cache (`config({ valueCacheSize })`) budget, current size
+ * in bytes and entries, and lookup, insert and eviction counters. Diagnostic
+ * only.
+ */
+export const valueCacheStats: () => {
+	capacity: number;
+	bytes: number;
+	entries: number;
+	hits: number;
+	misses: number;
+	inserts: number;
+	evictions: number;
+} = binding.valueCacheStats;
+
 /**
  * Number of live transaction-log memory maps across the process. Internal —
  * used by tests to verify that releasing a frozen log's external buffer unmaps
@@ -0,0 +1,89 @@
+import type { Key } from './encoding.js';
+import { NativeSstWriter, type NativeSstWriterOptions, type SstFileInfo } from './load-binding.js';
+import type { Store } from './store.js';
+
+export type SstWriterOptions = NativeSstWriterOptions;
+
+/**
+ * The packed bytes buffered before they are handed to the native writer.
+ */
+const BATCH_SIZE = 1024 * 1024;
+
+/**
+ * Builds an SST file for a database's column family, to be loaded with
+ * `db.ingest()` without going through the memtable, WAL and compactions.
+ *
+ * Keys and values are encoded with the database's encoders and passed to the
+ * native writer in packed batches.
+ */
+export class SstWriter {
+	#count = 0;
+	#native: NativeSstWriter;
+	#offset = 0;
+	#packed: Buffer = Buffer.allocUnsafeSlow(BATCH_SIZE);
+	#store: Store;
+
+	constructor(store: Store, path: string, options?: SstWriterOptions) {
+		if (!store.db.opened) {
+			throw new Error('Database not open');
+		}
+		this.#store = store;
+		this.#native = new NativeSstWriter(store.db, path, options);
+	}
+
+	/**
+	 * Discards the writer and deletes the partially written file.
+	 */
+	abort(): void {
+		this.#offset = 0;
+		this.#count = 0;
+		this.#native.abort();
+	}
+
+	/**
+	 * Writes everything buffered (sorting it first for a `sort` writer) and
+	 * finalizes the file. Throws if no entries were written.
+	 */
+	finish(): SstFileInfo {
+		this.#flush();
+		return this.#native.finish();
+	}
+
+	/**
+	 * Adds an entry. Unless the writer was created with `sort`, keys must be
+	 * added in strictly ascending order of their encoded bytes.
+	 */
+	put(key: Key, value: any): void {
+		// encode the value first, as `putSync()` does, since encoding it may
+		// overwrite the shared key buffer
+		const valueBuffer = this.#store.encodeValue(value);
+		const keyBuffer = this.#store.encodeKey(key);
+		const keyLength = keyBuffer.end;
+		const needed = 8 + keyLength + valueBuffer.length;
+
+		if (this.#offset + needed > this.#packed.length) {
+			this.#flush();
+			if (needed > this.#packed.length) {
+				this.#packed = Buffer.allocUnsafeSlow(needed);
+			}
+		}
+
+		const packed = this.#packed;
+		let offset = this.#offset;
+		packed.writeUInt32BE(keyLength, offset);
+		keyBuffer.copy(packed, offset + 4, 0, keyLength);
+		offset += 4 + keyLength;
+		packed.writeUInt32BE(valueBuffer.length, offset);
+		packed.set(valueBuffer, offset + 4);
+		this.#offset = offset + 4 + valueBuffer.length;
+		this.#count++;
+	}
+
+	#flush(): void {
+		if (this.#count > 0) {
+			this.#native.putBatch(this.#packed.subarray(0, this.#offset), this.#count);
+			this.#offset = 0;
+			this.#count = 0;
+		}
+	}
+}
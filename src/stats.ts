@@ -32,18 +32,30 @@ export type StatsBasics = {
 	'rocksdb.block-cache-capacity': number;
 	'rocksdb.block-cache-usage': number;
 	'rocksdb.block-cache-pinned-usage': number;
+	'rocksdb.estimate-table-readers-mem': number;
+	'blockCache.dataBlockBytes'?: number;
+	'blockCache.filterBlockBytes'?: number;
+	'blockCache.filterMetaBlockBytes'?: number;
+	'blockCache.indexBlockBytes'?: number;
 	'rocksdb.num-live-versions': number;
 	'rocksdb.current-super-version-number': number;
 	'rocksdb.oldest-snapshot-time': number;
 	'rocksdb.num-blob-files': number;
 	'rocksdb.total-blob-file-size': number;
 	'rocksdb.live-blob-file-size': number;
+	'rocksdb.live-blob-file-garbage-size': number;
+	'rocksdb.blob-cache-capacity'?: number;
+	'rocksdb.blob-cache-usage'?: number;
+	'rocksdb.blob-cache-pinned-usage'?: number;
 	'txnlog.logCount': number;
 	'txnlog.fileCount': number;
 	'txnlog.totalSizeBytes': number;
 	'txnlog.mappedBytes': number;
 	'txnlog.overlayBytes': number;
 	'txnlog.activeMaps': number;
+	'txnlog.residentBytes': number;
+	'txnlog.nonResidentPages': number;
+	'txnlog.readAheadBytes': number;
 	'txnlog.pendingTransactions': number;
 	'txnlog.uncommittedTransactions': number;
 	'txnlog.transactionsWritten': number;
@@ -51,6 +63,32 @@ export type StatsBasics = {
 	'txnlog.replayGapBytes': number;
 	'commitPipeline.logQueueDepth': number;
 	'commitPipeline.commitQueueDepth': number;
+	'commitPipeline.commitLane': number;
+	'commitPipeline.singleLaneCommits': number;
+	'commitPipeline.twoLaneCommits': number;
+	'commitPipeline.modeSwitches': number;
+	'commitPipeline.logStageNs': number;
+	'commitPipeline.commitStageNs': number;
+	'verificationTable.freshHits': number;
+	'verificationTable.softMisses': number;
+	'verificationTable.lockFallbacks': number;
+	'verificationTable.misses': number;
+	'verificationTable.populateCasFailures': number;
+	'verificationTable.parkedReads': number;
+	'verificationTable.slots': number;
+	'verificationTable.versionSlots': number;
+	'verificationTable.settledSlots': number;
+	'verificationTable.occupancy': number;
+	'verificationTable.estimatedCollisionRate': number;
+	'verificationTable.recommendedEntries': number;
+	'tombstoneCompaction.skippedTombstones'?: number;
+	'tombstoneCompaction.queuedRanges'?: number;
+	'tombstoneCompaction.droppedRanges'?: number;
+	'tombstoneCompaction.compactedRanges'?: number;
+	'tombstoneCompaction.compactedBytes'?: number;
+	'tombstoneCompaction.failedRanges'?: number;
+	'tombstoneCompaction.markedFileCompactions'?: number;
+	'tombstoneCompaction.markedFileBytes'?: number;
 };
 
 export type StatsCuratedExtras = {
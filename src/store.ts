@@ -15,6 +15,7 @@ import {
 } from './encoding.js';
 import {
 	constants,
+	type MergeOperator,
 	NativeDatabase,
 	type NativeDatabaseOptions,
 	NativeIterator,
@@ -57,6 +58,24 @@ export const ITERATOR_STATE: Uint32Array = new Uint32Array(
 );
 
 const MAX_KEY_SIZE = 1024 * 1024; // 1MB
+
+/**
+ * Reusable buffer for packing keys passed to `verifyVersions()` and
+ * `getMany()`. Grown on demand.
+ */
+let PACKED_KEYS_BUFFER: Buffer = Buffer.allocUnsafeSlow(16 * 1024);
+/**
+ * Reads parked on an in-flight write (`get()` with `waitForWrite`), by park
+ * id. The native side wakes a parked read by calling `wakeParkedRead(id)`
+ * through a per-env threadsafe function; the read's timeout removes it.
+ */
+const PARKED_READS = new Map<number, () => void>();
+let nextParkedReadId = 0;
+
+function wakeParkedRead(id: number): void {
+	PARKED_READS.get(id)?.();
+}
+
 const RESET_BUFFER_MODE = 1024;
 const REUSE_BUFFER_MODE = 512;
 const SAVE_BUFFER_SIZE = 8192;
@@ -69,11 +88,46 @@ export type StorePutOptions = PutOptions & DBITransactional;
 export type StoreRangeOptions = RangeOptions & DBITransactional;
 export type StoreRemoveOptions = DBITransactional | unknown;
 
+export type RemoveRangeOptions = {
+	/**
+	 * The first key to remove.
+	 */
+	start: Key;
+
+	/**
+	 * The key to stop at. It is not removed.
+	 */
+	end: Key;
+
+	/**
+	 * When `true`, the range is compacted once the tombstone is written,
+	 * reclaiming the space of keys no snapshot still needs. Not supported in a
+	 * transaction.
+	 */
+	compact?: boolean;
+};
+
+export type StoreRemoveRangeOptions = RemoveRangeOptions & DBITransactional;
+
 export type CompactOptions = {
 	start?: Key;
 	end?: Key;
 };
 
+export type TtlOptions = {
+	/**
+	 * Records whose version timestamp is older than this many milliseconds
+	 * expire. `0` disables it.
+	 */
+	ttl?: number;
+
+	/**
+	 * Records whose key starts with `prefix` expire while their version
+	 * timestamp is below `expiresBefore`.
+	 */
+	prefixes?: { prefix: Key; expiresBefore: number }[];
+};
+
 /**
  * Options for the `Store` class.
  */
@@ -121,6 +175,12 @@ export interface StoreOptions extends Omit<
 	transactionLogRetention?: number | string;
 
 	// trackMetrics?: boolean;
+
+	/**
+	 * Records whose version timestamp is older than this many milliseconds
+	 * are dropped by compactions. See `setTtl()`.
+	 */
+	ttl?: number;
 }
 
 /**
@@ -141,6 +201,57 @@ export type ArrayBufferWithNotify = ArrayBuffer & { cancel: () => void; notify:
  * This store should not be shared between `RocksDatabase` instances.
  */
 export class Store {
+	/**
+	 * Whether the writers of a write group insert into the memtable in
+	 * parallel.
+	 */
+	allowConcurrentMemtableWrite?: boolean;
+
+	/**
+	 * Whether blob values are cached in the process-wide block cache.
+	 */
+	blobCacheShared?: boolean;
+
+	/**
+	 * The size in bytes of the column family's dedicated blob cache.
+	 */
+	blobCacheSize?: number;
+
+	/**
+	 * The readahead size in bytes for blob file reads during compaction.
+	 */
+	blobCompactionReadaheadSize?: number;
+
+	/**
+	 * The target size in bytes of a blob file.
+	 */
+	blobFileSize?: number;
+
+	/**
+	 * The fraction of the oldest blob files garbage collection rewrites.
+	 */
+	blobGarbageCollectionAgeCutoff?: number;
+
+	/**
+	 * The bits per key of the bloom filter built for each SST file.
+	 */
+	bloomFilterBitsPerKey?: number;
+
+	/**
+	 * Whether to open the database for a bulk load.
+	 */
+	bulkLoad: boolean;
+
+	/**
+	 * Whether index and filter blocks are loaded through the block cache.
+	 */
+	cacheIndexAndFilterBlocks?: boolean;
+
+	/**
+	 * The number of keys the conflict profiler tracks. `0` disables it.
+	 */
+	conflictStatsSize?: number;
+
 	/**
 	 * The database instance.
 	 */
@@ -229,6 +340,21 @@ export class Store {
 	 */
 	maxWriteBufferSizeToMaintain?: number;
 
+	/**
+	 * The size cap in bytes of a value built by the `append` merge operator.
+	 */
+	mergeAppendLimit?: number;
+
+	/**
+	 * The built-in merge operator used by `merge()`.
+	 */
+	mergeOperator?: MergeOperator;
+
+	/**
+	 * The size in bytes at which values are stored in blob files.
+	 */
+	minBlobSize?: number;
+
 	/**
 	 * The total memtable budget in bytes across all column families. When the
 	 * sum of memtables reaches this size, RocksDB flushes the largest one. `0`
@@ -246,6 +372,23 @@ export class Store {
 	 */
 	noBlockCache?: boolean;
 
+	/**
+	 * Whether index and filter blocks are partitioned.
+	 */
+	partitionedIndexFilters?: boolean;
+
+	/**
+	 * Whether the index and filter blocks of L0 files stay pinned in the block
+	 * cache.
+	 */
+	pinL0FilterAndIndexBlocksInCache?: boolean;
+
+	/**
+	 * Whether the top-level index of partitioned index and filter blocks stays
+	 * pinned in the block cache.
+	 */
+	pinTopLevelIndexAndFilter?: boolean;
+
 	/**
 	 * The number of threads to use for parallel operations. This is a RocksDB
 	 * option. When undefined, the native layer picks
@@ -292,6 +435,21 @@ export class Store {
 	 */
 	statsLevel?: (typeof stats.StatsLevel)[keyof typeof stats.StatsLevel];
 
+	/**
+	 * Whether tombstone-heavy ranges are compacted in the background.
+	 */
+	tombstoneCompaction?: boolean;
+
+	/**
+	 * The I/O budget of tombstone compaction in bytes per second.
+	 */
+	tombstoneCompactionBytesPerSecond?: number;
+
+	/**
+	 * The number of skipped tombstones that gets an iterator's range compacted.
+	 */
+	tombstoneCompactionThreshold?: number;
+
 	/**
 	 * The threshold for the transaction log file's last modified time to be
 	 * older than the retention period before it is rotated to the next sequence
@@ -318,6 +476,19 @@ export class Store {
 	 */
 	transactionLogsPath?: string;
 
+	/**
+	 * The number of closed transactions kept for reuse by later transactions.
+	 * `0` disables the pool.
+	 *
+	 * @default 32
+	 */
+	transactionPoolSize?: number;
+
+	/**
+	 * The TTL in milliseconds applied when the database is opened.
+	 */
+	ttl?: number;
+
 	/**
 	 * Whether this store's column family participates in the VerificationTable.
 	 */
@@ -334,6 +505,12 @@ export class Store {
 	 */
 	writeKey: WriteKeyFunction;
 
+	/**
+	 * The microseconds a writer spins waiting for the write leader before
+	 * blocking.
+	 */
+	writeThreadMaxYieldUsec?: number;
+
 	/**
 	 * Initializes the store with a new `NativeDatabase` instance.
 	 *
@@ -354,6 +531,16 @@ export class Store {
 			options?.keyEncoder
 		);
 
+		this.allowConcurrentMemtableWrite = options?.allowConcurrentMemtableWrite;
+		this.blobCacheShared = options?.blobCacheShared;
+		this.blobCacheSize = options?.blobCacheSize;
+		this.blobCompactionReadaheadSize = options?.blobCompactionReadaheadSize;
+		this.blobFileSize = options?.blobFileSize;
+		this.blobGarbageCollectionAgeCutoff = options?.blobGarbageCollectionAgeCutoff;
+		this.bloomFilterBitsPerKey = options?.bloomFilterBitsPerKey;
+		this.bulkLoad = options?.bulkLoad ?? false;
+		this.cacheIndexAndFilterBlocks = options?.cacheIndexAndFilterBlocks;
+		this.conflictStatsSize = options?.conflictStatsSize;
 		this.db = new NativeDatabase();
 		this.dbWriteBufferSize = options?.dbWriteBufferSize;
 		this.decoder = options?.decoder ?? null;
@@ -369,23 +556,35 @@ export class Store {
 		this.maxOpenFiles = options?.maxOpenFiles;
 		this.maxWriteBufferNumber = options?.maxWriteBufferNumber;
 		this.maxWriteBufferSizeToMaintain = options?.maxWriteBufferSizeToMaintain;
+		this.mergeAppendLimit = options?.mergeAppendLimit;
+		this.mergeOperator = options?.mergeOperator;
+		this.minBlobSize = options?.minBlobSize;
 		this.name = options?.name ?? 'default';
 		this.noBlockCache = options?.noBlockCache;
+		this.partitionedIndexFilters = options?.partitionedIndexFilters;
 		this.parallelismThreads = options?.parallelismThreads;
 		this.path = path;
 		this.pessimistic = options?.pessimistic ?? false;
+		this.pinL0FilterAndIndexBlocksInCache = options?.pinL0FilterAndIndexBlocksInCache;
+		this.pinTopLevelIndexAndFilter = options?.pinTopLevelIndexAndFilter;
 		this.readOnly = options?.readOnly ?? false;
 		this.randomAccessStructure = options?.randomAccessStructure ?? false;
 		this.readKey = readKey;
 		this.sharedStructuresKey = options?.sharedStructuresKey;
 		this.statsLevel = options?.statsLevel;
+		this.tombstoneCompaction = options?.tombstoneCompaction;
+		this.tombstoneCompactionBytesPerSecond = options?.tombstoneCompactionBytesPerSecond;
+		this.tombstoneCompactionThreshold = options?.tombstoneCompactionThreshold;
 		this.transactionLogMaxAgeThreshold = options?.transactionLogMaxAgeThreshold;
 		this.transactionLogMaxSize = options?.transactionLogMaxSize;
 		this.transactionLogRetention = options?.transactionLogRetention;
 		this.transactionLogsPath = options?.transactionLogsPath;
+		this.transactionPoolSize = options?.transactionPoolSize;
+		this.ttl = options?.ttl;
 		this.verificationTable = options?.verificationTable;
 		this.writeBufferSize = options?.writeBufferSize;
 		this.writeKey = writeKey;
+		this.writeThreadMaxYieldUsec = options?.writeThreadMaxYieldUsec;
 	}
 
 	/**
@@ -482,6 +681,24 @@ export class Store {
 		this.db.compactSync(startBuffer, endBuffer);
 	}
 
+	/**
+	 * Replaces the TTL rule of the column family. Expired records are dropped
+	 * by the compactions that start afterwards.
+	 */
+	setTtl(options?: TtlOptions): void {
+		if (!this.db.opened) {
+			throw new Error('Database not open');
+		}
+
+		const prefixes = options?.prefixes?.map(({ prefix, expiresBefore }) => {
+			// copied since the key encoder reuses its buffer
+			const key = this.encodeKey(prefix);
+			return { prefix: Buffer.from(key.subarray(key.start, key.end)), expiresBefore };
+		});
+
+		this.db.setTtl(options?.ttl ?? 0, prefixes);
+	}
+
 	/**
 	 * Decodes a key from the database.
 	 *
@@ -567,6 +784,30 @@ export class Store {
 		options?: StoreGetOptions
 	): any | undefined {
 		const keyParam = getKeyParam(this.encodeKey(key));
+		const txnId = this.getTxnId(options);
+		const waitForWrite = options?.waitForWrite;
+		if (waitForWrite && waitForWrite > 0 && context === this.db && txnId === undefined) {
+			// a write to this key is in flight: wait for it to commit (or the
+			// timeout), then read, rather than reading the value it replaces
+			const id = (nextParkedReadId = (nextParkedReadId + 1) >>> 0);
+			if (this.db.parkRead(keyParam, id, wakeParkedRead)) {
+				return new Promise((resolve, reject) => {
+					const resume = () => {
+						clearTimeout(timer);
+						PARKED_READS.delete(id);
+						try {
+							// the shared value buffer may be overwritten before
+							// the caller runs, so always read into a new buffer
+							resolve(this.get(context, key, true, { ...options, waitForWrite: 0 }));
+						} catch (err) {
+							reject(err);
+						}
+					};
+					const timer = setTimeout(resume, waitForWrite);
+					PARKED_READS.set(id, resume);
+				});
+			}
+		}
 		let flags = 0;
 		if (alwaysCreateNewBuffer) {
 			// used by getBinary to force a new safe long-lived buffer
@@ -575,7 +816,6 @@ export class Store {
 		if (options?.populateVersion) {
 			flags |= POPULATE_VERSION_FLAG;
 		}
-		const txnId = this.getTxnId(options);
 		const expectedVersion = options?.expectedVersion;
 		// getSync is the fast path, which can return immediately if the entry is in memory cache, but we want to fail otherwise
 		const result = context.getSync(
@@ -855,31 +1095,78 @@ export class Store {
 		}
 
 		this.db.open(this.path, {
+			allowConcurrentMemtableWrite: this.allowConcurrentMemtableWrite,
+			blobCacheShared: this.blobCacheShared,
+			blobCacheSize: this.blobCacheSize,
+			blobCompactionReadaheadSize: this.blobCompactionReadaheadSize,
+			blobFileSize: this.blobFileSize,
+			blobGarbageCollectionAgeCutoff: this.blobGarbageCollectionAgeCutoff,
+			bloomFilterBitsPerKey: this.bloomFilterBitsPerKey,
+			bulkLoad: this.bulkLoad,
+			cacheIndexAndFilterBlocks: this.cacheIndexAndFilterBlocks,
+			conflictStatsSize: this.conflictStatsSize,
 			dbWriteBufferSize: this.dbWriteBufferSize,
 			disableWAL: this.disableWAL,
 			enableStats: this.enableStats,
 			maxOpenFiles: this.maxOpenFiles,
 			maxWriteBufferNumber: this.maxWriteBufferNumber,
 			maxWriteBufferSizeToMaintain: this.maxWriteBufferSizeToMaintain,
+			mergeAppendLimit: this.mergeAppendLimit,
+			mergeOperator: this.mergeOperator,
+			minBlobSize: this.minBlobSize,
 			mode: this.pessimistic ? 'pessimistic' : 'optimistic',
 			name: this.name,
 			noBlockCache: this.noBlockCache,
 			parallelismThreads: this.parallelismThreads,
+			partitionedIndexFilters: this.partitionedIndexFilters,
+			pinL0FilterAndIndexBlocksInCache: this.pinL0FilterAndIndexBlocksInCache,
+			pinTopLevelIndexAndFilter: this.pinTopLevelIndexAndFilter,
 			readOnly: this.readOnly,
 			statsLevel: this.statsLevel,
+			tombstoneCompaction: this.tombstoneCompaction,
+			tombstoneCompactionBytesPerSecond: this.tombstoneCompactionBytesPerSecond,
+			tombstoneCompactionThreshold: this.tombstoneCompactionThreshold,
 			transactionLogMaxAgeThreshold: this.transactionLogMaxAgeThreshold,
 			transactionLogMaxSize: this.transactionLogMaxSize,
 			transactionLogRetentionMs: this.transactionLogRetention
 				? parseDuration(this.transactionLogRetention)
 				: undefined,
 			transactionLogsPath: this.transactionLogsPath,
+			transactionPoolSize: this.transactionPoolSize,
 			verificationTable: this.verificationTable,
 			writeBufferSize: this.writeBufferSize,
+			writeThreadMaxYieldUsec: this.writeThreadMaxYieldUsec,
 		});
 
+		if (this.ttl && !this.readOnly) {
+			this.db.setTtl(this.ttl);
+		}
+
 		return false;
 	}
 
+	mergeSync(context: StoreContext, key: Key, operand: any, options?: DBITransactional | unknown): void {
+		if (!this.db.opened) {
+			throw new Error('Database not open');
+		}
+
+		// encoded before the key for the same reason as in `putSync()`
+		let operandBuffer: Buffer | Uint8Array;
+		if (this.mergeOperator === 'add') {
+			if (typeof operand !== 'number' && typeof operand !== 'bigint') {
+				throw new TypeError('An add merge operand must be a number or bigint');
+			}
+			const delta = Buffer.allocUnsafe(8);
+			// a negative delta wraps to its two's complement
+			delta.writeBigUInt64BE(BigInt.asUintN(64, BigInt(operand)));
+			operandBuffer = delta;
+		} else {
+			operandBuffer = this.encodeValue(operand);
+		}
+
+		context.mergeSync(this.encodeKey(key), operandBuffer, this.getTxnId(options));
+	}
+
 	putSync(context: StoreContext, key: Key, value: any, options?: StorePutOptions): void {
 		if (!this.db.opened) {
 			throw new Error('Database not open');
@@ -903,6 +1190,50 @@ export class Store {
 		context.removeSync(this.encodeKey(key), this.getTxnId(options));
 	}
 
+	removeRange(context: StoreContext, options: StoreRemoveRangeOptions): Promise<void> {
+		const txnId = this.getTxnId(options);
+		if (context !== this.db || txnId !== undefined) {
+			// a transaction writes the tombstone when it commits
+			return Promise.resolve(this.removeRangeSync(context, options));
+		}
+
+		const [start, end] = this.encodeRange(options);
+		return new Promise((resolve, reject) =>
+			this.db.removeRange(resolve, reject, start, end, { compact: options.compact })
+		);
+	}
+
+	removeRangeSync(context: StoreContext, options: StoreRemoveRangeOptions): void {
+		const [start, end] = this.encodeRange(options);
+		const txnId = this.getTxnId(options);
+		if (context !== this.db || txnId !== undefined) {
+			if (options.compact) {
+				throw new Error('Range compaction is not supported in a transaction');
+			}
+			context.removeRangeSync(start, end, txnId);
+		} else {
+			this.db.removeRangeSync(start, end, undefined, { compact: options.compact });
+		}
+	}
+
+	/**
+	 * Encodes the bounds of a range removal. Both are copied since they are
+	 * encoded into the shared key buffer.
+	 */
+	encodeRange(options: RemoveRangeOptions): [Buffer, Buffer] {
+		if (!this.db.opened) {
+			throw new Error('Database not open');
+		}
+		if (options?.start === undefined || options?.end === undefined) {
+			throw new TypeError('Range start and end keys are required');
+		}
+
+		const start = this.encodeKey(options.start);
+		const startBuffer = Buffer.from(start.subarray(start.start, start.end));
+		const end = this.encodeKey(options.end);
+		return [startBuffer, Buffer.from(end.subarray(end.start, end.end))];
+	}
+
 	/**
 	 * Attempts to acquire a lock for a given key. If the lock is available,
 	 * the function returns `true` and the optional callback is never called.
@@ -959,6 +1290,77 @@ export class Store {
 		return this.db.verifyVersion(keyParam, version);
 	}
 
+	/**
+	 * Batched `verifyVersion()`. Packs the encoded keys (each prefixed with its
+	 * big-endian uint32 length) and checks them all in one native call. Bit
+	 * `i` of the returned bitmap (LSB first) is set when `keys[i]` is fresh.
+	 */
+	verifyVersions(
+		keys: Key[],
+		versions: ArrayLike<number>,
+		bitmap: Uint8Array = new Uint8Array((keys.length + 7) >> 3)
+	): Uint8Array {
+		if (versions.length !== keys.length) {
+			throw new RangeError('Expected one version per key');
+		}
+		const versionArray = versions instanceof Float64Array ? versions : Float64Array.from(versions);
+		this.db.verifyVersions(this.packKeys(keys), versionArray, bitmap);
+		return bitmap;
+	}
+
+	/**
+	 * Reads a batch of keys through a transaction in one native call. Missing
+	 * keys yield `undefined`. Each value is a view into one buffer allocated
+	 * for the batch, so it stays valid after later reads.
+	 */
+	getMany(
+		txn: NativeTransaction,
+		keys: Key[],
+		options?: GetManyOptions
+	): (Buffer | undefined)[] {
+		let flags = 0;
+		if (options?.populateVersion) {
+			flags |= POPULATE_VERSION_FLAG;
+		}
+		const packed = txn.getMany(this.packKeys(keys), keys.length, flags, !!options?.forUpdate);
+		const values: (Buffer | undefined)[] = new Array(keys.length);
+		let offset = 0;
+		for (let i = 0; i < keys.length; i++) {
+			const length = packed.readUInt32BE(offset);
+			offset += 4;
+			if (length === 0xffffffff) {
+				values[i] = undefined;
+			} else {
+				values[i] = packed.subarray(offset, offset + length);
+				offset += length;
+			}
+		}
+		return values;
+	}
+
+	/**
+	 * Encodes `keys` into the shared packed-keys buffer, each prefixed with its
+	 * big-endian uint32 length, and returns the filled portion. Only valid
+	 * until the next call.
+	 */
+	packKeys(keys: Key[]): Buffer {
+		let packed = PACKED_KEYS_BUFFER;
+		let offset = 0;
+		for (const key of keys) {
+			const keyBuffer = this.encodeKey(key);
+			const length = keyBuffer.end;
+			if (offset + 4 + length > packed.length) {
+				const grown = Buffer.allocUnsafeSlow(Math.max(packed.length * 2, offset + 4 + length));
+				packed.copy(grown, 0, 0, offset);
+				packed = PACKED_KEYS_BUFFER = grown;
+			}
+			packed.writeUInt32BE(length, offset);
+			keyBuffer.copy(packed, offset + 4, 0, length);
+			offset += 4 + length;
+		}
+		return packed.subarray(0, offset);
+	}
+
 	/**
 	 * Seeds the verification-table slot for `key` with `version`. Has no
 	 * effect if the slot is currently lock-tagged or the table is disabled.
@@ -1024,6 +1426,18 @@ export interface GetOptions {
 	 */
 	populateVersion?: boolean;
 
+	/**
+	 * When set to a number of milliseconds and the key has a write in flight
+	 * (a transaction that wrote it has not committed or aborted yet), an async
+	 * `get()` waits for that write to settle before reading, for at most this
+	 * long, instead of reading the value it is about to replace. Requires the
+	 * verification table. Ignored by `getSync()` and by reads in a
+	 * transaction, which read from their own snapshot.
+	 *
+	 * @default 0
+	 */
+	waitForWrite?: number;
+
 	/**
 	 * Whether to skip decoding the value.
 	 *
@@ -1032,6 +1446,33 @@ export interface GetOptions {
 	skipDecode?: boolean;
 }
 
+export interface GetManyOptions {
+	/**
+	 * When `true`, reads the keys with `GetForUpdate` semantics: a pessimistic
+	 * transaction locks every key until it commits or aborts, and an optimistic
+	 * transaction fails to commit if another transaction wrote any of them
+	 * first.
+	 *
+	 * @default false
+	 */
+	forUpdate?: boolean;
+
+	/**
+	 * When `true`, seeds the verification-table slot of every key found with
+	 * the version extracted from its value, like `populateVersion` on `get()`.
+	 *
+	 * @default false
+	 */
+	populateVersion?: boolean;
+
+	/**
+	 * Whether to skip decoding the values.
+	 *
+	 * @default false
+	 */
+	skipDecode?: boolean;
+}
+
 export interface PutOptions {
 	append?: boolean;
 	instructedWrite?: boolean;
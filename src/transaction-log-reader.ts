@@ -83,7 +83,7 @@ Object.defineProperty(TransactionLog.prototype, 'query', {
 
 		if (logBuffer === undefined || logBuffer.logId !== logId) {
 			// if the current log buffer is not the one we want, load the memory map
-			logBuffer = getLogMemoryMap(this, logId);
+			logBuffer = getLogMemoryMap(this, logId, position);
 
 			// if this is the latest, cache for easy access, unless...
 			// if we are reading uncommitted, we might be a log file ahead of the committed transaction
@@ -139,7 +139,11 @@ Object.defineProperty(TransactionLog.prototype, 'query', {
 							(logBuffer!.size = transactionLog.getLogFileSize(logBuffer!.logId));
 						if (position >= size) {
 							// we can't read any further in this block, go to the next block
-							const nextLogBuffer = getLogMemoryMap(transactionLog, logBuffer!.logId + 1)!;
+							const nextLogBuffer = getLogMemoryMap(
+								transactionLog,
+								logBuffer!.logId + 1,
+								TRANSACTION_LOG_FILE_HEADER_SIZE
+							)!;
 							if (nextLogBuffer) {
 								dataView = nextLogBuffer.dataView;
 								logBuffer = nextLogBuffer;
@@ -238,7 +242,11 @@ Object.defineProperty(TransactionLog.prototype, 'query', {
 						);
 						size = latestSize;
 						if (latestLogId > logBuffer!.logId) {
-							const nextLogBuffer = getLogMemoryMap(transactionLog, logBuffer!.logId + 1);
+							const nextLogBuffer = getLogMemoryMap(
+								transactionLog,
+								logBuffer!.logId + 1,
+								TRANSACTION_LOG_FILE_HEADER_SIZE
+							);
 							if (!nextLogBuffer) {
 								// the next log file can't be mapped (purged, mid-rotation,
 								// 0-byte at mmap time, FS race); stop cleanly rather than
@@ -264,13 +272,26 @@ Object.defineProperty(TransactionLog.prototype, 'query', {
 	},
 });
 
-function getLogMemoryMap(transactionLog: TransactionLog, logId: number): LogBuffer | undefined {
+/**
+ * Gets the memory map for a log file, from the cache when possible. When
+ * `scanFrom` is given, the cursor is about to scan the file sequentially from
+ * that offset, so the native side is hinted to read ahead (a no-op unless
+ * `transactionLogReadAhead` is enabled).
+ */
+function getLogMemoryMap(
+	transactionLog: TransactionLog,
+	logId: number,
+	scanFrom?: number
+): LogBuffer | undefined {
 	if (logId <= 0) {
 		return;
 	}
 	let logBuffer = transactionLog._logBuffers!.get(logId)?.deref();
 	if (logBuffer) {
 		// if we have a cached buffer, return it
+		if (scanFrom !== undefined) {
+			transactionLog._adviseReadAhead(logId, scanFrom);
+		}
 		return logBuffer;
 	}
 	try {
@@ -284,6 +305,9 @@ function getLogMemoryMap(transactionLog: TransactionLog, logId: number): LogBuff
 	}
 	logBuffer.logId = logId;
 	logBuffer.dataView = new DataView(logBuffer.buffer);
+	if (scanFrom !== undefined) {
+		transactionLog._adviseReadAhead(logId, scanFrom);
+	}
 	transactionLog._logBuffers!.set(logId, new WeakRef(logBuffer)); // add to cache
 	let maxMisses = 3;
 	for (const [logId, reference] of transactionLog._logBuffers!) {
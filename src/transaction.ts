@@ -1,6 +1,7 @@
 import { DBI } from './dbi';
+import type { BufferWithDataView, Key } from './encoding.js';
 import { constants, NativeTransaction, type NativeTransactionOptions } from './load-binding.js';
-import { Store } from './store.js';
+import { type GetManyOptions, Store } from './store.js';
 
 /**
  * Sentinel value returned by `commit()` when `coordinatedRetry: true` and the
@@ -82,6 +83,9 @@ export class Transaction extends DBI {
 			super(store);
 			this.#txn = { id: 0 } as NativeTransaction;
 			this.abort = this.commitSync = this.setTimestamp = () => {};
+			this.setSavepoint = this.rollbackToSavepoint = this.popSavepoint = () => {};
+			this.getMany = (keys, options) =>
+				keys.map((key) => (options?.skipDecode ? this.getBinarySync(key) : this.getSync(key)));
 			this.commit = async () => {};
 			this.getTimestamp = () => 0;
 		} else {
@@ -162,6 +166,31 @@ export class Transaction extends DBI {
 		return err as Error;
 	}
 
+	/**
+	 * Get the values for a batch of keys in one native call, reading at the
+	 * transaction's snapshot. Missing keys yield `undefined`.
+	 *
+	 * With `forUpdate`, a pessimistic transaction also locks every key and an
+	 * optimistic transaction fails to commit if another transaction wrote any
+	 * of them first.
+	 *
+	 * @param keys - The keys to get.
+	 * @param options - The get options.
+	 * @returns The values, in key order.
+	 */
+	getMany(keys: Key[], options?: GetManyOptions): any[] {
+		if (!this.store.isOpen()) {
+			throw new Error('Database not open');
+		}
+		const values = this.store.getMany(this.#txn, keys, options);
+		if (this.store.encoding === 'binary' || !this.store.decoder || options?.skipDecode) {
+			return values;
+		}
+		return values.map((value) =>
+			value === undefined ? undefined : this.store.decodeValue(value as BufferWithDataView)
+		);
+	}
+
 	/**
 	 * Returns the transaction start timestamp in seconds. Defaults to the time at which
 	 * the transaction was created.
@@ -179,6 +208,30 @@ export class Transaction extends DBI {
 		return this.#txn.id;
 	}
 
+	/**
+	 * Remove the most recent savepoint without undoing the writes made since it
+	 * was set.
+	 */
+	popSavepoint(): void {
+		this.#txn.popSavepoint();
+	}
+
+	/**
+	 * Undo the writes and transaction log entries made since the most recent
+	 * savepoint, then remove that savepoint. Reads are not affected.
+	 */
+	rollbackToSavepoint(): void {
+		this.#txn.rollbackToSavepoint();
+	}
+
+	/**
+	 * Set a savepoint that `rollbackToSavepoint()` can undo back to. Savepoints
+	 * nest: each rollback or pop applies to the most recent one.
+	 */
+	setSavepoint(): void {
+		this.#txn.setSavepoint();
+	}
+
 	/**
 	 * Set the transaction start timestamp in seconds.
 	 *
@@ -0,0 +1,73 @@
+import { backgroundStats, RocksDatabase } from '../src/index.js';
+import { dbRunner } from './lib/util.js';
+import { afterEach, describe, expect, it } from 'vitest';
+
+describe('Background threads and I/O', () => {
+	afterEach(() => {
+		RocksDatabase.config({ backgroundThreads: { high: 0, low: 0 }, ioRateLimitBytesPerSec: 0 });
+	});
+
+	it('should reject an invalid pool size', () => {
+		expect(() => RocksDatabase.config({ backgroundThreads: { low: -1 } })).toThrow(
+			new RangeError('Background threads must be an integer between 0 and 1024')
+		);
+		expect(() => RocksDatabase.config({ backgroundThreads: { high: 1025 } })).toThrow(
+			new RangeError('Background threads must be an integer between 0 and 1024')
+		);
+	});
+
+	it('should reject a negative rate limit', () => {
+		expect(() => RocksDatabase.config({ ioRateLimitBytesPerSec: -1 })).toThrow(
+			new RangeError('IO rate limit must be a positive integer or 0 to disable')
+		);
+	});
+
+	it('should size the shared pools', () => {
+		RocksDatabase.config({ backgroundThreads: { high: 2, low: 3 } });
+		const stats = backgroundStats();
+		expect(stats.high.threads).toBe(2);
+		expect(stats.low.threads).toBe(3);
+	});
+
+	it('should keep the shared pool size when a database opens', () => {
+		RocksDatabase.config({ backgroundThreads: { high: 1, low: 3 } });
+		return dbRunner({ dbOptions: [{ parallelismThreads: 8 }] }, async () => {
+			expect(backgroundStats().low.threads).toBe(3);
+		});
+	});
+
+	it('should size a pool left at 0 from parallelismThreads', () => {
+		RocksDatabase.config({ backgroundThreads: { high: 2 } });
+		return dbRunner({ dbOptions: [{ parallelismThreads: 5 }] }, async () => {
+			const stats = backgroundStats();
+			expect(stats.high.threads).toBe(2);
+			expect(stats.low.threads).toBe(5);
+		});
+	});
+
+	it('should count flushes and rate limit them', () => {
+		RocksDatabase.config({ ioRateLimitBytesPerSec: 64 * 1024 * 1024 });
+		const before = backgroundStats();
+		expect(before.ioRateLimitBytesPerSec).toBe(64 * 1024 * 1024);
+
+		return dbRunner(async ({ db }) => {
+			for (let i = 0; i < 100; ++i) {
+				db.putSync(`key:${i}`, 'value'.repeat(100));
+			}
+			await db.flush();
+
+			const after = backgroundStats();
+			expect(after.high.completed).toBeGreaterThan(before.high.completed);
+			expect(after.high.rateLimitedBytes).toBeGreaterThan(before.high.rateLimitedBytes);
+		});
+	});
+
+	it('should not change autoTune once the rate limiter exists', () => {
+		RocksDatabase.config({ ioRateLimitBytesPerSec: 64 * 1024 * 1024 });
+		return dbRunner(async () => {
+			expect(() => RocksDatabase.config({ autoTune: true })).toThrow(
+				'autoTune cannot be changed after the rate limiter has been created'
+			);
+		});
+	});
+});
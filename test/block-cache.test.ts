@@ -1,6 +1,7 @@
 import { RocksDatabase } from '../src/index.js';
-import { dbRunner } from './lib/util.js';
-import { assert, describe, expect, it } from 'vitest';
+import { dbRunner, generateDBPath } from './lib/util.js';
+import { setTimeout as delay } from 'node:timers/promises';
+import { assert, beforeAll, describe, expect, it } from 'vitest';
 
 describe('Block Cache', () => {
 	it('should disable block cache', () =>
@@ -49,3 +50,133 @@ describe('Block Cache', () => {
 		);
 	});
 });
+
+describe('Index and filter blocks', () => {
+	beforeAll(() => {
+		// the tests above leave the shared block cache disabled
+		RocksDatabase.config({ blockCacheSize: 32 * 1024 * 1024 });
+	});
+
+	async function writeAndRead(db: RocksDatabase) {
+		for (let i = 0; i < 1000; i++) {
+			await db.put(`key-${i.toString().padStart(6, '0')}`, `value-${i}`);
+		}
+		await db.flush();
+		for (let i = 0; i < 1000; i += 97) {
+			expect(await db.get(`key-${i.toString().padStart(6, '0')}`)).toBe(`value-${i}`);
+		}
+		expect(await db.get('missing')).toBeUndefined();
+	}
+
+	// The block cache entry stats come from a scan of the shared block cache,
+	// which RocksDB reuses for up to 10 seconds, so wait for a scan that
+	// includes this database's blocks.
+	async function waitForBlockCacheBytes(db: RocksDatabase, stat: string): Promise<number> {
+		const deadline = Date.now() + 15000;
+		let bytes = db.getStat(stat) as number;
+		while (!(bytes > 0) && Date.now() < deadline) {
+			await delay(250);
+			bytes = db.getStat(stat) as number;
+		}
+		return bytes;
+	}
+
+	it('should read with partitioned index and filter blocks in the block cache', () =>
+		dbRunner(
+			{
+				dbOptions: [
+					{
+						bloomFilterBitsPerKey: 10,
+						cacheIndexAndFilterBlocks: true,
+						partitionedIndexFilters: true,
+						pinL0FilterAndIndexBlocksInCache: true,
+					},
+				],
+			},
+			async ({ db }) => {
+				await writeAndRead(db);
+				expect(await waitForBlockCacheBytes(db, 'blockCache.indexBlockBytes')).toBeGreaterThan(0);
+				expect(await waitForBlockCacheBytes(db, 'blockCache.filterBlockBytes')).toBeGreaterThan(0);
+				// only partitioned filters have a top-level filter index, and they
+				// require the two-level index
+				expect(
+					await waitForBlockCacheBytes(db, 'blockCache.filterMetaBlockBytes')
+				).toBeGreaterThan(0);
+				expect(db.getStats()['blockCache.dataBlockBytes']).toBeGreaterThan(0);
+			}
+		));
+
+	it('should move index and filter blocks out of the table readers when cached', () =>
+		dbRunner(
+			{
+				dbOptions: [
+					{ bloomFilterBitsPerKey: 10 },
+					{ bloomFilterBitsPerKey: 10, cacheIndexAndFilterBlocks: true, path: generateDBPath() },
+				],
+			},
+			async ({ db }, { db: cachedDb }) => {
+				await writeAndRead(db);
+				await writeAndRead(cachedDb);
+				const uncached = db.getStats()['rocksdb.estimate-table-readers-mem'];
+				const cached = cachedDb.getStats()['rocksdb.estimate-table-readers-mem'];
+				expect(uncached).toBeGreaterThan(0);
+				expect(cached).toBeLessThan(uncached);
+			}
+		));
+
+	it('should partition the index without a filter', () =>
+		dbRunner(
+			{
+				dbOptions: [
+					{
+						cacheIndexAndFilterBlocks: true,
+						partitionedIndexFilters: true,
+						pinTopLevelIndexAndFilter: false,
+					},
+				],
+			},
+			async ({ db }) => {
+				await writeAndRead(db);
+				expect(await waitForBlockCacheBytes(db, 'blockCache.indexBlockBytes')).toBeGreaterThan(0);
+			}
+		));
+
+	it('should not report block cache entries without a block cache', () =>
+		dbRunner({ dbOptions: [{ noBlockCache: true }] }, async ({ db }) => {
+			expect(db.getStats()['blockCache.indexBlockBytes']).toBeUndefined();
+			expect(db.getStat('blockCache.indexBlockBytes')).toBeUndefined();
+		}));
+
+	it('should reject caching index and filter blocks without a block cache', () =>
+		dbRunner(
+			{ dbOptions: [{ cacheIndexAndFilterBlocks: true, noBlockCache: true }], skipOpen: true },
+			async ({ db }) => {
+				expect(() => db.open()).toThrow('cacheIndexAndFilterBlocks requires the block cache');
+			}
+		));
+
+	it('should reject pinning L0 blocks without caching them', () =>
+		dbRunner(
+			{ dbOptions: [{ pinL0FilterAndIndexBlocksInCache: true }], skipOpen: true },
+			async ({ db }) => {
+				expect(() => db.open()).toThrow(
+					'pinL0FilterAndIndexBlocksInCache requires cacheIndexAndFilterBlocks'
+				);
+			}
+		));
+
+	it('should reject pinning the top-level index without caching it', () =>
+		dbRunner(
+			{ dbOptions: [{ pinTopLevelIndexAndFilter: false }], skipOpen: true },
+			async ({ db }) => {
+				expect(() => db.open()).toThrow(
+					'pinTopLevelIndexAndFilter requires cacheIndexAndFilterBlocks'
+				);
+			}
+		));
+
+	it('should reject a negative bloomFilterBitsPerKey', () =>
+		dbRunner({ dbOptions: [{ bloomFilterBitsPerKey: -1 }], skipOpen: true }, async ({ db }) => {
+			expect(() => db.open()).toThrow('bloomFilterBitsPerKey must be 0 or greater');
+		}));
+});
@@ -0,0 +1,79 @@
+import { RocksDatabase } from '../src/index.js';
+import { dbRunner } from './lib/util.js';
+import { setTimeout as delay } from 'node:timers/promises';
+import { describe, expect, it } from 'vitest';
+
+function level0Files(db: RocksDatabase): number {
+	return Number(db.getDBProperty('rocksdb.num-files-at-level0'));
+}
+
+describe('Bulk Load', () => {
+	it('should defer compaction until the bulk load is finished', () =>
+		dbRunner({ dbOptions: [{ bulkLoad: true }] }, async ({ db }) => {
+			// more flushed files than the default L0 compaction trigger
+			for (let batch = 0; batch < 8; ++batch) {
+				for (let i = 0; i < 100; ++i) {
+					db.putSync(`key-${batch}-${i}`, `value-${batch}-${i}`);
+				}
+				await db.flush();
+			}
+			expect(level0Files(db)).toBe(8);
+
+			await db.finishBulkLoad();
+			expect(level0Files(db)).toBe(0);
+			expect(db.getSync('key-0-0')).toBe('value-0-0');
+			expect(db.getSync('key-7-99')).toBe('value-7-99');
+			expect(db.getKeysCount()).toBe(800);
+		}));
+
+	it('should keep written data after finishing and reopening', () =>
+		dbRunner({ dbOptions: [{ bulkLoad: true }] }, async ({ db }) => {
+			for (let i = 0; i < 1000; ++i) {
+				db.putSync(`key-${i}`, `value-${i}`);
+			}
+			db.finishBulkLoadSync();
+
+			// the WAL is back on, so this write survives the reopen
+			db.putSync('after', 'bulk load');
+			db.close();
+			db.open();
+			expect(db.getSync('key-999')).toBe('value-999');
+			expect(db.getSync('after')).toBe('bulk load');
+		}));
+
+	it('should restore automatic compactions once finished', () =>
+		dbRunner({ dbOptions: [{ bulkLoad: true }] }, async ({ db }) => {
+			db.putSync('foo', 'bar');
+			await db.finishBulkLoad();
+
+			// past the L0 compaction trigger in effect before the bulk load
+			for (let batch = 0; batch < 8; ++batch) {
+				db.putSync(`key-${batch}`, `value-${batch}`);
+				await db.flush();
+			}
+			const deadline = Date.now() + 10000;
+			while (level0Files(db) >= 8 && Date.now() < deadline) {
+				await delay(50);
+			}
+			expect(level0Files(db)).toBeLessThan(8);
+		}));
+
+	it('should do nothing when finishing a database not opened for a bulk load', () =>
+		dbRunner(async ({ db }) => {
+			await db.put('foo', 'bar');
+			await db.flush();
+			await db.put('baz', 'qux');
+			await db.flush();
+			// below the default L0 compaction trigger, so only a finish compacts
+			expect(level0Files(db)).toBe(2);
+
+			await db.finishBulkLoad();
+			expect(level0Files(db)).toBe(2);
+			expect(db.getSync('foo')).toBe('bar');
+		}));
+
+	it('should error if database is not open', () =>
+		dbRunner({ skipOpen: true }, async ({ db }) => {
+			await expect(db.finishBulkLoad()).rejects.toThrow('Database not open');
+		}));
+});
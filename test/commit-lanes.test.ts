@@ -0,0 +1,72 @@
+import { commitLaneStats, RocksDatabase } from '../src/index.js';
+import { dbRunner, generateDBPath } from './lib/util.js';
+import { afterEach, describe, expect, it } from 'vitest';
+
+describe('Commit lanes', () => {
+	afterEach(() => {
+		RocksDatabase.config({ commitLanes: 0 });
+	});
+
+	it('should reject an invalid lane count', () => {
+		expect(() => RocksDatabase.config({ commitLanes: -1 })).toThrow(
+			new RangeError('Commit lanes must be an integer between 0 and 256')
+		);
+		expect(() => RocksDatabase.config({ commitLanes: 257 })).toThrow(
+			new RangeError('Commit lanes must be an integer between 0 and 256')
+		);
+	});
+
+	it('should use dedicated commit threads by default', () =>
+		dbRunner(async ({ db }) => {
+			await db.transaction(async (txn) => {
+				await txn.put('foo', 'bar');
+			});
+			expect(db.getStats()['commitPipeline.commitLane']).toBe(-1);
+		}));
+
+	it('should share lanes across databases and preserve commit order', () => {
+		RocksDatabase.config({ commitLanes: 2 });
+		expect(commitLaneStats().lanes).toBe(2);
+
+		return dbRunner(
+			{
+				dbOptions: [{}, { path: generateDBPath() }, { path: generateDBPath() }],
+			},
+			async ({ db }, { db: db2 }, { db: db3 }) => {
+				const dbs = [db, db2, db3];
+				const commits: Promise<void>[] = [];
+				for (let i = 0; i < 50; i++) {
+					for (const d of dbs) {
+						commits.push(d.transaction(async (txn) => {
+							await txn.put('counter', i);
+						}));
+					}
+				}
+				await Promise.all(commits);
+
+				for (const d of dbs) {
+					const lane = d.getStats()['commitPipeline.commitLane'];
+					expect(lane).toBeGreaterThanOrEqual(0);
+					expect(lane).toBeLessThan(2);
+					// last committed value wins, so the lane kept per-database order
+					expect(await d.get('counter')).toBe(49);
+				}
+				expect(commitLaneStats().depths.length).toBeGreaterThanOrEqual(2);
+			}
+		);
+	});
+
+	it('should keep the assigned lane after the lane count is lowered', () => {
+		RocksDatabase.config({ commitLanes: 4 });
+		return dbRunner(async ({ db }) => {
+			const lane = db.getStats()['commitPipeline.commitLane'];
+			RocksDatabase.config({ commitLanes: 0 });
+			await db.transaction(async (txn) => {
+				await txn.put('foo', 'bar');
+			});
+			expect(db.getStats()['commitPipeline.commitLane']).toBe(lane);
+			expect(commitLaneStats().lanes).toBe(0);
+			expect(commitLaneStats().depths.length).toBeGreaterThanOrEqual(4);
+		});
+	});
+});
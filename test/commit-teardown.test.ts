@@ -5,12 +5,13 @@ import { describe, expect, it } from 'vitest';
 
 const fixturePath = join(__dirname, 'fixtures', 'fork-commit-teardown.mts');
 
-// Default (single-lane) and two-lane pipeline both have their own
+// Default (single-lane), two-lane and adaptive pipelines all have their own
 // completion-vs-teardown window; legacy (`0`) doesn't use the commit thread
 // at all, so it's out of scope for this repro.
 const COMMIT_THREAD_MODES: Array<{ label: string; mode: string | undefined }> = [
 	{ label: 'default', mode: undefined },
 	{ label: '2', mode: '2' },
+	{ label: 'auto', mode: 'auto' },
 ];
 
 /**
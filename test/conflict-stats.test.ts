@@ -0,0 +1,87 @@
+import { Transaction } from '../src/transaction.js';
+import { dbRunner } from './lib/util.js';
+import { describe, expect, it } from 'vitest';
+
+describe('Conflict Stats', () => {
+	it('should be disabled by default', () =>
+		dbRunner(async ({ db }) => {
+			await db.put('foo', 'bar');
+			const txn = new Transaction(db.store);
+			txn.getSync('foo');
+			await db.put('foo', 'baz');
+			txn.putSync('foo', 'qux');
+			try {
+				expect(() => txn.commitSync()).toThrow('Resource busy');
+			} finally {
+				txn.abort();
+			}
+
+			expect(db.getConflictStats()).toEqual({
+				capacity: 0,
+				conflicts: 0,
+				unattributed: 0,
+				keys: [],
+			});
+		}));
+
+	it('should attribute an optimistic conflict to the key changed since the snapshot', () =>
+		dbRunner({ dbOptions: [{ conflictStatsSize: 10, keyEncoding: 'binary' }] }, async ({ db }) => {
+			await db.put(Buffer.from('foo'), 'bar');
+			const txn = new Transaction(db.store);
+			txn.getSync(Buffer.from('foo'));
+			await db.put(Buffer.from('foo'), 'baz');
+			txn.putSync(Buffer.from('foo'), 'qux');
+			txn.putSync(Buffer.from('other'), 'qux');
+			try {
+				txn.commitSync();
+				expect.unreachable('commit should have conflicted');
+			} catch (error: any) {
+				expect(error.code).toBe('ERR_BUSY');
+			} finally {
+				txn.abort();
+			}
+
+			const stats = db.getConflictStats();
+			expect(stats.capacity).toBe(10);
+			expect(stats.conflicts).toBe(1);
+			expect(stats.unattributed).toBe(0);
+			expect(stats.keys).toHaveLength(1);
+			expect(stats.keys[0].columnFamily).toBe('default');
+			expect(stats.keys[0].key).toEqual(Buffer.from('foo'));
+			expect(stats.keys[0].truncated).toBe(false);
+			expect(stats.keys[0].count).toBe(1);
+			expect(stats.keys[0].maxRetries).toBe(0);
+		}));
+
+	it('should count retries and reset on request', () =>
+		dbRunner({ dbOptions: [{ conflictStatsSize: 10, keyEncoding: 'binary' }] }, async ({ db }) => {
+			await db.put(Buffer.from('foo'), 0);
+			let attempts = 0;
+			await db.transaction(
+				async (txn) => {
+					attempts++;
+					const value = txn.getSync(Buffer.from('foo'));
+					if (attempts < 3) {
+						// a competing write lands after our snapshot
+						await db.put(Buffer.from('foo'), value + 1);
+					}
+					txn.putSync(Buffer.from('foo'), value + 10);
+				},
+				{ maxRetries: 5, retryOnBusy: true }
+			);
+
+			expect(attempts).toBe(3);
+			const stats = db.getConflictStats({ reset: true });
+			expect(stats.conflicts).toBe(2);
+			expect(stats.keys).toHaveLength(1);
+			expect(stats.keys[0].count).toBe(2);
+			expect(stats.keys[0].maxRetries).toBe(1);
+
+			expect(db.getConflictStats()).toEqual({
+				capacity: 10,
+				conflicts: 0,
+				unattributed: 0,
+				keys: [],
+			});
+		}));
+});
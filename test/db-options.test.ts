@@ -91,3 +91,107 @@ describe('Database write buffer options', () => {
 			expect(sstSize!).toBeGreaterThan(0);
 		}));
 });
+
+describe('Database write path options', () => {
+	it('should open with a custom writeThreadMaxYieldUsec', () =>
+		dbRunner({ dbOptions: [{ writeThreadMaxYieldUsec: 10 }] }, async ({ db }) => {
+			await Promise.all(Array.from({ length: 100 }, (_, i) => db.put(`key-${i}`, `value-${i}`)));
+			for (let i = 0; i < 100; i++) {
+				expect(await db.get(`key-${i}`)).toBe(`value-${i}`);
+			}
+		}));
+
+	it('should open with allowConcurrentMemtableWrite disabled', () =>
+		dbRunner({ dbOptions: [{ allowConcurrentMemtableWrite: false }] }, async ({ db }) => {
+			await db.put('foo', 'bar');
+			expect(await db.get('foo')).toBe('bar');
+		}));
+});
+
+describe('Database blob options', () => {
+	const largeValue = 'x'.repeat(4096);
+
+	it('should store values at least minBlobSize in blob files', () =>
+		dbRunner({ dbOptions: [{ minBlobSize: 1024 }] }, async ({ db }) => {
+			await db.put('large', largeValue);
+			await db.put('small', 'x'.repeat(512));
+			await db.flush();
+			expect(db.getDBIntProperty('rocksdb.num-blob-files')).toBe(1);
+			expect(await db.get('large')).toBe(largeValue);
+		}));
+
+	it('should keep values below minBlobSize in SST files', () =>
+		dbRunner({ dbOptions: [{ minBlobSize: 8192 }] }, async ({ db }) => {
+			await db.put('large', largeValue);
+			await db.flush();
+			expect(db.getDBIntProperty('rocksdb.num-blob-files')).toBe(0);
+			expect(await db.get('large')).toBe(largeValue);
+		}));
+
+	it('should cache blob values in a dedicated blob cache', () =>
+		dbRunner({ dbOptions: [{ blobCacheSize: 1024 * 1024 }] }, async ({ db }) => {
+			await db.put('large', largeValue);
+			await db.flush();
+			expect(await db.get('large')).toBe(largeValue);
+
+			const stats = db.getStats();
+			expect(stats['rocksdb.blob-cache-capacity']).toBe(1024 * 1024);
+			expect(stats['rocksdb.blob-cache-usage']).toBeGreaterThan(0);
+			expect(stats['rocksdb.live-blob-file-garbage-size']).toBe(0);
+		}));
+
+	it('should not report a blob cache by default', () =>
+		dbRunner(async ({ db }) => {
+			expect(Object.keys(db.getStats())).not.toContain('rocksdb.blob-cache-capacity');
+		}));
+
+	it('should open with blob file tuning options', () =>
+		dbRunner(
+			{
+				dbOptions: [
+					{
+						blobCacheShared: true,
+						blobCompactionReadaheadSize: 2 * 1024 * 1024,
+						blobFileSize: 64 * 1024 * 1024,
+						blobGarbageCollectionAgeCutoff: 0.5,
+					},
+				],
+			},
+			async ({ db }) => {
+				await db.put('large', largeValue);
+				await db.flush();
+				expect(await db.get('large')).toBe(largeValue);
+				expect(db.getStats()['rocksdb.blob-cache-capacity']).toBeGreaterThan(0);
+			}
+		));
+
+	it('should apply blob file options to an already open column family', () =>
+		dbRunner(
+			{ dbOptions: [{}, { minBlobSize: 8192 }], skipOpen: true },
+			async ({ db }, { db: db2 }) => {
+				db.open();
+				db2.open();
+				await db.put('large', largeValue);
+				await db.flush();
+				expect(db.getDBIntProperty('rocksdb.num-blob-files')).toBe(0);
+			}
+		));
+
+	it('should reject blobCacheShared with blobCacheSize', () =>
+		dbRunner(
+			{ dbOptions: [{ blobCacheShared: true, blobCacheSize: 1024 }], skipOpen: true },
+			async ({ db }) => {
+				expect(() => db.open()).toThrow('blobCacheShared and blobCacheSize cannot be used together');
+			}
+		));
+
+	it('should reject a blobGarbageCollectionAgeCutoff outside 0 to 1', () =>
+		dbRunner(
+			{ dbOptions: [{ blobGarbageCollectionAgeCutoff: 1.5 }], skipOpen: true },
+			async ({ db }) => {
+				expect(() => db.open()).toThrow(
+					'blobGarbageCollectionAgeCutoff must be between 0.0 and 1.0'
+				);
+			}
+		));
+});
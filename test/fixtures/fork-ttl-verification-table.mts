@@ -0,0 +1,35 @@
+import { RocksDatabase } from '../../src/index.js';
+
+// Runs in a fresh process, so the verification table is not created until
+// the database first reads or populates it, after the `ttl` option applied.
+const HOUR = 60 * 60 * 1000;
+
+let db: RocksDatabase | undefined;
+
+try {
+	db = RocksDatabase.open(process.argv[2], { encoding: false, ttl: HOUR, verificationTable: true });
+
+	const key = Buffer.from('old');
+	const version = Date.now() - 2 * HOUR;
+	const value = Buffer.alloc(16);
+	value.writeDoubleBE(version, 0);
+	await db.put(key, value);
+	db.populateVersion(key, version);
+	if (!db.verifyVersion(key, version)) {
+		console.error('Expected the populated version to verify');
+		process.exit(1);
+	}
+
+	await db.compact();
+	if (db.getBinarySync(key) !== undefined) {
+		console.error('Expected the expired record to be dropped');
+		process.exit(1);
+	}
+	if (db.verifyVersion(key, version)) {
+		console.error('Expected the dropped record to no longer verify');
+		process.exit(1);
+	}
+	console.log('Success');
+} finally {
+	db?.close();
+}
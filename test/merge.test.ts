@@ -0,0 +1,133 @@
+import { Transaction } from '../src/transaction.js';
+import { dbRunner } from './lib/util.js';
+import { describe, expect, it } from 'vitest';
+
+function frame(...elements: string[]): Buffer {
+	return Buffer.concat(
+		elements.map((element) => {
+			const length = Buffer.alloc(4);
+			length.writeUInt32BE(element.length);
+			return Buffer.concat([length, Buffer.from(element)]);
+		})
+	);
+}
+
+function versioned(version: number, body: string): Buffer {
+	const value = Buffer.alloc(8 + body.length);
+	value.writeDoubleBE(version, 0);
+	value.write(body, 8);
+	return value;
+}
+
+describe('Merge', () => {
+	it('should error if database is not open', () =>
+		dbRunner({ skipOpen: true }, async ({ db }) => {
+			await expect(db.merge('counter', 1)).rejects.toThrow('Database not open');
+		}));
+
+	it('should error without a merge operator', () =>
+		dbRunner(async ({ db }) => {
+			expect(() => db.mergeSync('counter', 1)).toThrow('not opened with a merge operator');
+		}));
+
+	it('should error with an unknown merge operator', () =>
+		dbRunner({ skipOpen: true, dbOptions: [{ mergeOperator: 'sum' as any }] }, async ({ db }) => {
+			expect(() => db.open()).toThrow('Invalid merge operator: sum');
+		}));
+
+	describe('add', () => {
+		it('should add to a counter', () =>
+			dbRunner({ dbOptions: [{ mergeOperator: 'add' }] }, async ({ db }) => {
+				await db.merge('counter', 5);
+				db.mergeSync('counter', 10n);
+				db.mergeSync('counter', -3);
+				expect((db.getBinarySync('counter') as Buffer).readBigUInt64BE()).toBe(12n);
+			}));
+
+		it('should keep the counter across a flush', () =>
+			dbRunner({ dbOptions: [{ mergeOperator: 'add' }] }, async ({ db }) => {
+				for (let i = 0; i < 100; ++i) {
+					db.mergeSync('counter', 1);
+				}
+				await db.flush();
+				db.mergeSync('counter', 1);
+				expect((db.getBinarySync('counter') as Buffer).readBigUInt64BE()).toBe(101n);
+			}));
+
+		it('should reject an operand that is not a number', () =>
+			dbRunner({ dbOptions: [{ mergeOperator: 'add' }] }, async ({ db }) => {
+				expect(() => db.mergeSync('counter', 'one')).toThrow('must be a number or bigint');
+			}));
+
+		it('should not conflict between concurrent transactions', () =>
+			dbRunner({ dbOptions: [{ mergeOperator: 'add' }] }, async ({ db }) => {
+				const txn1 = new Transaction(db.store);
+				const txn2 = new Transaction(db.store);
+				txn1.mergeSync('counter', 1);
+				txn2.mergeSync('counter', 2);
+				await txn1.commit();
+				await txn2.commit();
+				expect((db.getBinarySync('counter') as Buffer).readBigUInt64BE()).toBe(3n);
+			}));
+
+		it('should not merge when the transaction aborts', () =>
+			dbRunner({ dbOptions: [{ mergeOperator: 'add' }] }, async ({ db }) => {
+				db.mergeSync('counter', 1);
+				const txn = new Transaction(db.store);
+				txn.mergeSync('counter', 1);
+				txn.abort();
+				expect((db.getBinarySync('counter') as Buffer).readBigUInt64BE()).toBe(1n);
+			}));
+	});
+
+	describe('append', () => {
+		it('should append elements', () =>
+			dbRunner({ dbOptions: [{ encoding: 'binary', mergeOperator: 'append' }] }, async ({ db }) => {
+				db.mergeSync('list', Buffer.from('a'));
+				await db.transaction(async (txn) => {
+					txn.mergeSync('list', Buffer.from('bc'));
+				});
+				expect(db.getBinarySync('list')).toEqual(frame('a', 'bc'));
+			}));
+
+		it('should drop the oldest elements past the limit', () =>
+			dbRunner(
+				{ dbOptions: [{ encoding: 'binary', mergeAppendLimit: 16, mergeOperator: 'append' }] },
+				async ({ db }) => {
+					for (const element of ['one', 'two', 'six']) {
+						db.mergeSync('list', Buffer.from(element));
+					}
+					expect(db.getBinarySync('list')).toEqual(frame('two', 'six'));
+				}
+			));
+	});
+
+	describe('maxVersion', () => {
+		it('should keep the value with the highest version', () =>
+			dbRunner(
+				{ dbOptions: [{ encoding: false, mergeOperator: 'maxVersion' }] },
+				async ({ db }) => {
+					await db.put('record', versioned(2, 'current'));
+					db.mergeSync('record', versioned(1, 'stale'));
+					expect(db.getBinarySync('record')).toEqual(versioned(2, 'current'));
+
+					db.mergeSync('record', versioned(3, 'newer'));
+					expect(db.getBinarySync('record')).toEqual(versioned(3, 'newer'));
+				}
+			));
+
+		it('should invalidate the verification table', () =>
+			dbRunner(
+				{ dbOptions: [{ encoding: false, mergeOperator: 'maxVersion', verificationTable: true }] },
+				async ({ db }) => {
+					const key = Buffer.from('record');
+					await db.put(key, versioned(1.7e12, 'current'));
+					db.populateVersion(key, 1.7e12);
+					expect(db.verifyVersion(key, 1.7e12)).toBe(true);
+
+					db.mergeSync(key, versioned(1.8e12, 'newer'));
+					expect(db.verifyVersion(key, 1.7e12)).toBe(false);
+				}
+			));
+	});
+});
@@ -0,0 +1,52 @@
+// Unit tests for the background job listener: the completed jobs and busy
+// time it counts for the flush and compaction thread pools.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include "core/background_jobs.h"
+
+using namespace rocksdb_js;
+
+TEST(BackgroundJobListener, CountsCompactionsWithTheirElapsedTime) {
+	BackgroundJobListener listener;
+	rocksdb::CompactionJobInfo info;
+	info.stats.elapsed_micros = 1500;
+	listener.OnCompactionCompleted(nullptr, info);
+	info.status = rocksdb::Status::Aborted();
+	info.stats.elapsed_micros = 500;
+	listener.OnCompactionCompleted(nullptr, info);
+
+	auto stats = listener.getCompactionStats();
+	EXPECT_EQ(stats.completed, 2u);
+	EXPECT_DOUBLE_EQ(stats.busyMs, 2.0);
+	EXPECT_EQ(listener.getFlushStats().completed, 0u);
+}
+
+TEST(BackgroundJobListener, TimesAFlushFromItsBegin) {
+	BackgroundJobListener listener;
+	rocksdb::FlushJobInfo info;
+	listener.OnFlushBegin(nullptr, info);
+	std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	listener.OnFlushCompleted(nullptr, info);
+
+	auto stats = listener.getFlushStats();
+	EXPECT_EQ(stats.completed, 1u);
+	EXPECT_GE(stats.busyMs, 5.0);
+}
+
+TEST(BackgroundJobListener, TimesAnAtomicFlushOnce) {
+	BackgroundJobListener listener;
+	rocksdb::FlushJobInfo info;
+	// every column family begins before any completes
+	listener.OnFlushBegin(nullptr, info);
+	listener.OnFlushBegin(nullptr, info);
+	std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	listener.OnFlushCompleted(nullptr, info);
+	double busyMs = listener.getFlushStats().busyMs;
+	listener.OnFlushCompleted(nullptr, info);
+
+	auto stats = listener.getFlushStats();
+	EXPECT_EQ(stats.completed, 2u);
+	EXPECT_DOUBLE_EQ(stats.busyMs, busyMs);
+}
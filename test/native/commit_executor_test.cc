@@ -0,0 +1,124 @@
+// Unit tests for the process-wide CommitExecutor lanes and the per-database
+// CommitLaneTracker that lets a closing database drain only its own tasks.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "database/commit_executor.h"
+
+using rocksdb_js::CommitExecutor;
+using rocksdb_js::CommitLaneTracker;
+using rocksdb_js::CommitWorker;
+
+namespace {
+
+class CommitExecutorTest : public ::testing::Test {
+protected:
+	void TearDown() override {
+		CommitExecutor::getInstance().setLaneCount(0);
+	}
+};
+
+} // namespace
+
+TEST_F(CommitExecutorTest, DisabledByDefault) {
+	int32_t laneIndex = 0;
+	EXPECT_EQ(CommitExecutor::getInstance().acquireLane(123, 0, laneIndex), nullptr);
+	EXPECT_EQ(laneIndex, -1);
+}
+
+// The same path always maps to the same lane; the offset selects a neighbour.
+TEST_F(CommitExecutorTest, StableLaneAssignment) {
+	auto& executor = CommitExecutor::getInstance();
+	executor.setLaneCount(4);
+
+	uint64_t hash = CommitExecutor::hashKey("/data/tenant-17");
+	EXPECT_EQ(hash, CommitExecutor::hashKey("/data/tenant-17"));
+	EXPECT_NE(hash, CommitExecutor::hashKey("/data/tenant-18"));
+
+	int32_t first = -1;
+	int32_t second = -1;
+	int32_t neighbour = -1;
+	auto lane = executor.acquireLane(hash, 0, first);
+	auto again = executor.acquireLane(hash, 0, second);
+	auto next = executor.acquireLane(hash, 1, neighbour);
+	ASSERT_NE(lane, nullptr);
+	EXPECT_EQ(lane, again);
+	EXPECT_EQ(first, second);
+	EXPECT_EQ(first, static_cast<int32_t>(hash % 4));
+	EXPECT_EQ(neighbour, static_cast<int32_t>((hash + 1) % 4));
+	EXPECT_NE(lane, next);
+}
+
+// Lowering the lane count keeps the lanes allocated (already-open databases
+// keep using theirs) but maps new databases onto fewer lanes.
+TEST_F(CommitExecutorTest, LanesAreNeverRemoved) {
+	auto& executor = CommitExecutor::getInstance();
+	executor.setLaneCount(8);
+	executor.setLaneCount(2);
+	EXPECT_EQ(executor.getLaneCount(), 2u);
+	EXPECT_GE(executor.laneDepths().size(), 8u);
+
+	int32_t laneIndex = -1;
+	executor.acquireLane(7, 0, laneIndex);
+	EXPECT_EQ(laneIndex, 1);
+}
+
+// Tasks from several databases on one lane keep their per-database order.
+TEST_F(CommitExecutorTest, PreservesPerDatabaseOrder) {
+	auto& executor = CommitExecutor::getInstance();
+	executor.setLaneCount(1);
+	int32_t laneIndex = -1;
+	auto lane = executor.acquireLane(0, 0, laneIndex);
+
+	auto trackerA = std::make_shared<CommitLaneTracker>();
+	auto trackerB = std::make_shared<CommitLaneTracker>();
+	std::mutex mutex;
+	std::vector<int> seenA;
+	std::vector<int> seenB;
+	for (int i = 0; i < 100; ++i) {
+		trackerA->enqueue(lane, [&, i]() { std::lock_guard<std::mutex> lock(mutex); seenA.push_back(i); });
+		trackerB->enqueue(lane, [&, i]() { std::lock_guard<std::mutex> lock(mutex); seenB.push_back(i); });
+	}
+	trackerA->drain();
+	trackerB->drain();
+
+	ASSERT_EQ(seenA.size(), 100u);
+	ASSERT_EQ(seenB.size(), 100u);
+	for (int i = 0; i < 100; ++i) {
+		EXPECT_EQ(seenA[i], i);
+		EXPECT_EQ(seenB[i], i);
+	}
+}
+
+// drain() waits for the database's queued tasks, including tasks they forward
+// onto another lane, and afterwards tasks run inline.
+TEST_F(CommitExecutorTest, DrainWaitsForForwardedTasksThenRunsInline) {
+	auto& executor = CommitExecutor::getInstance();
+	executor.setLaneCount(2);
+	int32_t logIndex = -1;
+	int32_t commitIndex = -1;
+	auto logLane = executor.acquireLane(0, 1, logIndex);
+	auto commitLane = executor.acquireLane(0, 0, commitIndex);
+
+	auto tracker = std::make_shared<CommitLaneTracker>();
+	std::atomic<int> committed{0};
+	for (int i = 0; i < 20; ++i) {
+		tracker->enqueue(logLane, [&, tracker]() {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			tracker->enqueue(commitLane, [&]() { committed.fetch_add(1); });
+		});
+	}
+	tracker->drain();
+	EXPECT_EQ(committed.load(), 20);
+
+	auto caller = std::this_thread::get_id();
+	std::thread::id ranOn;
+	tracker->enqueue(commitLane, [&]() { ranOn = std::this_thread::get_id(); });
+	EXPECT_EQ(ranOn, caller);
+}
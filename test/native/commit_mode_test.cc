@@ -0,0 +1,99 @@
+// Unit tests for CommitModeTracker: per-mode commit counters, windowed stage
+// averages, the hysteresis around the adaptive single/two-lane switch, and the
+// dispatch ordering guard.
+
+#include <gtest/gtest.h>
+#include "database/commit_mode.h"
+
+using rocksdb_js::CommitModeTracker;
+
+namespace {
+
+void recordWindow(CommitModeTracker& tracker, uint64_t logNs, uint64_t commitNs) {
+	for (uint32_t i = 0; i < CommitModeTracker::WINDOW; ++i) {
+		tracker.record(logNs, commitNs, tracker.preferTwoLane());
+	}
+}
+
+} // namespace
+
+TEST(CommitModeTracker, CountsCommitsPerMode) {
+	CommitModeTracker tracker;
+	tracker.record(100, 100, false);
+	tracker.record(100, 100, false);
+	tracker.record(100, 100, true);
+	EXPECT_EQ(tracker.singleLaneCommits.load(), 2u);
+	EXPECT_EQ(tracker.twoLaneCommits.load(), 1u);
+}
+
+// Stage averages are only published, and the mode only re-evaluated, once a
+// full window has been recorded.
+TEST(CommitModeTracker, PublishesWindowAverages) {
+	CommitModeTracker tracker;
+	for (uint32_t i = 0; i < CommitModeTracker::WINDOW - 1; ++i) {
+		tracker.record(1000000, 1000000, false);
+	}
+	EXPECT_EQ(tracker.logStageNs.load(), 0u);
+	EXPECT_FALSE(tracker.preferTwoLane());
+
+	tracker.record(1000000, 1000000, false);
+	EXPECT_EQ(tracker.logStageNs.load(), 1000000u);
+	EXPECT_EQ(tracker.commitStageNs.load(), 1000000u);
+	EXPECT_TRUE(tracker.preferTwoLane());
+}
+
+// Small commits, or a cheap stage on either side, never split.
+TEST(CommitModeTracker, StaysSingleLaneUnlessBothStagesAreExpensive) {
+	CommitModeTracker tracker;
+	recordWindow(tracker, 2000, 3000);
+	EXPECT_FALSE(tracker.preferTwoLane());
+	recordWindow(tracker, 5000000, 1000);
+	EXPECT_FALSE(tracker.preferTwoLane());
+	recordWindow(tracker, 1000, 5000000);
+	EXPECT_FALSE(tracker.preferTwoLane());
+	EXPECT_EQ(tracker.modeSwitches.load(), 0u);
+}
+
+// Between the exit and enter thresholds the current mode is kept.
+TEST(CommitModeTracker, AppliesHysteresis) {
+	uint64_t between = (CommitModeTracker::ENTER_TWO_LANE_NS + CommitModeTracker::EXIT_TWO_LANE_NS) / 2;
+	CommitModeTracker tracker;
+
+	recordWindow(tracker, between, between);
+	EXPECT_FALSE(tracker.preferTwoLane());
+
+	recordWindow(tracker, CommitModeTracker::ENTER_TWO_LANE_NS, CommitModeTracker::ENTER_TWO_LANE_NS);
+	EXPECT_TRUE(tracker.preferTwoLane());
+
+	recordWindow(tracker, between, between);
+	EXPECT_TRUE(tracker.preferTwoLane());
+
+	recordWindow(tracker, CommitModeTracker::EXIT_TWO_LANE_NS - 1, between);
+	EXPECT_FALSE(tracker.preferTwoLane());
+	EXPECT_EQ(tracker.modeSwitches.load(), 2u);
+}
+
+// A commit follows earlier commits on the other route until they can no
+// longer be overtaken, in both directions.
+TEST(CommitModeTracker, DispatchKeepsRouteWhileOtherRouteInFlight) {
+	CommitModeTracker tracker;
+	EXPECT_FALSE(tracker.dispatch(false));
+	EXPECT_EQ(tracker.singleLaneInFlight.load(), 1u);
+
+	// a queued single-lane commit has not written its log batch yet
+	EXPECT_FALSE(tracker.dispatch(true));
+	EXPECT_EQ(tracker.singleLaneInFlight.load(), 2u);
+	tracker.singleLaneInFlight.fetch_sub(2);
+
+	EXPECT_TRUE(tracker.dispatch(true));
+	EXPECT_EQ(tracker.logStageInFlight.load(), 1u);
+
+	// a split commit has not been forwarded to the commit lane yet
+	EXPECT_TRUE(tracker.dispatch(false));
+	EXPECT_EQ(tracker.logStageInFlight.load(), 2u);
+	tracker.logStageInFlight.fetch_sub(2);
+
+	EXPECT_FALSE(tracker.dispatch(false));
+	EXPECT_EQ(tracker.logStageInFlight.load(), 0u);
+	EXPECT_EQ(tracker.singleLaneInFlight.load(), 1u);
+}
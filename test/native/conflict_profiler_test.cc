@@ -0,0 +1,100 @@
+// Unit tests for the ConflictProfiler: Space-Saving counting, key truncation,
+// and capacity changes.
+
+#include <gtest/gtest.h>
+#include <string>
+#include "core/conflict_profiler.h"
+
+using rocksdb_js::ConflictKey;
+using rocksdb_js::ConflictProfiler;
+
+TEST(ConflictProfiler, DisabledByDefault) {
+	ConflictProfiler profiler;
+	EXPECT_FALSE(profiler.enabled());
+	profiler.record({ { "default", "k" } }, 0);
+	auto stats = profiler.getStats();
+	EXPECT_EQ(stats.conflicts, 0u);
+	EXPECT_TRUE(stats.keys.empty());
+}
+
+TEST(ConflictProfiler, CountsKeysMostConflictedFirst) {
+	ConflictProfiler profiler(8);
+	profiler.record({ { "default", "a" } }, 0);
+	profiler.record({ { "default", "b" }, { "default", "a" } }, 2);
+	profiler.record({ { "other", "a" } }, 1);
+	profiler.record({}, 0);
+
+	auto stats = profiler.getStats();
+	EXPECT_EQ(stats.capacity, 8u);
+	EXPECT_EQ(stats.conflicts, 4u);
+	EXPECT_EQ(stats.unattributed, 1u);
+	ASSERT_EQ(stats.keys.size(), 3u);
+	EXPECT_EQ(stats.keys[0].columnFamily, "default");
+	EXPECT_EQ(stats.keys[0].key, "a");
+	EXPECT_EQ(stats.keys[0].count, 2u);
+	EXPECT_EQ(stats.keys[0].error, 0u);
+	EXPECT_EQ(stats.keys[0].maxRetries, 2u);
+	EXPECT_EQ(stats.keys[1].count, 1u);
+	EXPECT_EQ(stats.keys[2].count, 1u);
+}
+
+TEST(ConflictProfiler, TruncatesLongKeys) {
+	ConflictProfiler profiler(8);
+	std::string longKey(ConflictProfiler::MAX_KEY_PREFIX + 10, 'x');
+	profiler.record({ { "default", longKey } }, 0);
+	profiler.record({ { "default", longKey.substr(0, ConflictProfiler::MAX_KEY_PREFIX + 5) } }, 0);
+
+	auto stats = profiler.getStats();
+	ASSERT_EQ(stats.keys.size(), 1u);
+	EXPECT_EQ(stats.keys[0].key.size(), ConflictProfiler::MAX_KEY_PREFIX);
+	EXPECT_TRUE(stats.keys[0].truncated);
+	EXPECT_EQ(stats.keys[0].count, 2u);
+}
+
+// A hot key stays tracked while a stream of cold keys cycles through the
+// remaining counters.
+TEST(ConflictProfiler, KeepsHotKeysWhenFull) {
+	ConflictProfiler profiler(4);
+	for (int i = 0; i < 1000; ++i) {
+		profiler.record({ { "default", "hot" } }, 0);
+		profiler.record({ { "default", "cold-" + std::to_string(i) } }, 0);
+	}
+
+	auto stats = profiler.getStats();
+	EXPECT_EQ(stats.keys.size(), 4u);
+	EXPECT_EQ(stats.keys[0].key, "hot");
+	EXPECT_EQ(stats.keys[0].count, 1000u);
+	EXPECT_EQ(stats.keys[0].error, 0u);
+	for (size_t i = 1; i < stats.keys.size(); ++i) {
+		EXPECT_GE(stats.keys[i].count, stats.keys[i].error);
+	}
+}
+
+TEST(ConflictProfiler, ShrinkingKeepsTheMostConflicted) {
+	ConflictProfiler profiler(8);
+	for (int i = 0; i < 8; ++i) {
+		for (int j = 0; j <= i; ++j) {
+			profiler.record({ { "default", std::to_string(i) } }, 0);
+		}
+	}
+	profiler.setCapacity(2);
+
+	auto stats = profiler.getStats();
+	ASSERT_EQ(stats.keys.size(), 2u);
+	EXPECT_EQ(stats.keys[0].key, "7");
+	EXPECT_EQ(stats.keys[1].key, "6");
+
+	profiler.setCapacity(0);
+	EXPECT_FALSE(profiler.enabled());
+	EXPECT_EQ(profiler.getStats().conflicts, 0u);
+}
+
+TEST(ConflictProfiler, ResetKeepsCapacity) {
+	ConflictProfiler profiler(8);
+	profiler.record({ { "default", "a" } }, 0);
+	profiler.reset();
+	auto stats = profiler.getStats();
+	EXPECT_EQ(stats.capacity, 8u);
+	EXPECT_EQ(stats.conflicts, 0u);
+	EXPECT_TRUE(stats.keys.empty());
+}
@@ -0,0 +1,105 @@
+// Unit tests for the ExternalSorter: in-memory sorting, spilled runs and their
+// merge, and last-write-wins for duplicate keys.
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+#include "core/external_sorter.h"
+
+using rocksdb_js::ExternalSorter;
+
+namespace {
+
+using Entries = std::vector<std::pair<std::string, std::string>>;
+
+std::string runPrefix(const char* name) {
+	auto dir = std::filesystem::temp_directory_path() / "rocksdb-js-external-sorter";
+	std::filesystem::create_directories(dir);
+	return (dir / name).string();
+}
+
+Entries drain(ExternalSorter& sorter) {
+	Entries result;
+	sorter.finish([&result](std::string_view key, std::string_view value) {
+		result.emplace_back(std::string(key), std::string(value));
+	});
+	return result;
+}
+
+} // namespace
+
+TEST(ExternalSorter, SortsInMemory) {
+	ExternalSorter sorter(runPrefix("in-memory"), 1024 * 1024);
+	sorter.add("c", "3");
+	sorter.add("a", "1");
+	sorter.add("b", "2");
+
+	EXPECT_EQ(sorter.size(), 3u);
+	EXPECT_EQ(sorter.runCount(), 0u);
+	EXPECT_EQ(drain(sorter), (Entries{ { "a", "1" }, { "b", "2" }, { "c", "3" } }));
+}
+
+// Keys compare as unsigned bytes, like RocksDB's bytewise comparator.
+TEST(ExternalSorter, ComparesBytewise) {
+	ExternalSorter sorter(runPrefix("bytewise"), 1024 * 1024);
+	sorter.add(std::string("\xff", 1), "high");
+	sorter.add(std::string("\x01", 1), "low");
+	sorter.add(std::string("\x01\x00", 2), "longer");
+
+	Entries sorted = drain(sorter);
+	ASSERT_EQ(sorted.size(), 3u);
+	EXPECT_EQ(sorted[0].second, "low");
+	EXPECT_EQ(sorted[1].second, "longer");
+	EXPECT_EQ(sorted[2].second, "high");
+}
+
+TEST(ExternalSorter, KeepsTheLastValueForADuplicateKey) {
+	ExternalSorter sorter(runPrefix("duplicates"), 1024 * 1024);
+	sorter.add("a", "first");
+	sorter.add("b", "only");
+	sorter.add("a", "second");
+
+	EXPECT_EQ(drain(sorter), (Entries{ { "a", "second" }, { "b", "only" } }));
+}
+
+TEST(ExternalSorter, MergesSpilledRuns) {
+	std::string prefix = runPrefix("spilled");
+	// small enough to spill every few entries
+	ExternalSorter sorter(prefix, 256);
+	for (int i = 999; i >= 0; i--) {
+		char key[8];
+		std::snprintf(key, sizeof(key), "%04d", i);
+		sorter.add(key, std::to_string(i));
+	}
+	// a later duplicate must win over the value in an earlier run
+	sorter.add("0500", "updated");
+	EXPECT_GT(sorter.runCount(), 1u);
+
+	Entries sorted = drain(sorter);
+	ASSERT_EQ(sorted.size(), 1000u);
+	for (int i = 0; i < 1000; i++) {
+		char key[8];
+		std::snprintf(key, sizeof(key), "%04d", i);
+		EXPECT_EQ(sorted[i].first, key);
+		EXPECT_EQ(sorted[i].second, i == 500 ? "updated" : std::to_string(i));
+	}
+
+	EXPECT_EQ(sorter.runCount(), 0u);
+	EXPECT_FALSE(std::filesystem::exists(prefix + ".run-0"));
+}
+
+TEST(ExternalSorter, RemovesRunsWhenDiscarded) {
+	std::string prefix = runPrefix("discarded");
+	{
+		ExternalSorter sorter(prefix, 64);
+		for (int i = 0; i < 100; i++) {
+			sorter.add(std::to_string(i), "value");
+		}
+		ASSERT_GT(sorter.runCount(), 0u);
+		EXPECT_TRUE(std::filesystem::exists(prefix + ".run-0"));
+	}
+	EXPECT_FALSE(std::filesystem::exists(prefix + ".run-0"));
+}
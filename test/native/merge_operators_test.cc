@@ -0,0 +1,169 @@
+// Unit tests for the built-in merge operators: uint64 add, capped append and
+// keep-highest-version, through full and partial merges.
+
+#include <gtest/gtest.h>
+#include <bit>
+#include <string>
+#include <vector>
+#include "core/merge_operators.h"
+
+using rocksdb_js::BuiltinMergeOperator;
+using rocksdb_js::MergeOperatorKind;
+using rocksdb_js::encodeMergeOperand;
+
+namespace {
+
+std::string be64(uint64_t value) {
+	std::string out;
+	for (int shift = 56; shift >= 0; shift -= 8) {
+		out.push_back(static_cast<char>((value >> shift) & 0xff));
+	}
+	return out;
+}
+
+std::string frame(const std::string& element) {
+	std::string out;
+	uint32_t length = static_cast<uint32_t>(element.size());
+	for (int shift = 24; shift >= 0; shift -= 8) {
+		out.push_back(static_cast<char>((length >> shift) & 0xff));
+	}
+	return out + element;
+}
+
+// A record value with a float64 version prefix, as Harper writes them.
+std::string versioned(double version, const std::string& body) {
+	return be64(std::bit_cast<uint64_t>(version)) + body;
+}
+
+std::string add(uint64_t delta) {
+	return encodeMergeOperand(MergeOperatorKind::Add, 0, be64(delta));
+}
+
+std::string append(const std::string& element, uint32_t limit = 0) {
+	return encodeMergeOperand(MergeOperatorKind::Append, limit, element);
+}
+
+std::string maxVersion(const std::string& value) {
+	return encodeMergeOperand(MergeOperatorKind::MaxVersion, 0, value);
+}
+
+bool fullMerge(const std::string* existing, const std::vector<std::string>& operands, std::string& result) {
+	BuiltinMergeOperator op;
+	rocksdb::Slice existingSlice;
+	if (existing) {
+		existingSlice = *existing;
+	}
+	std::vector<rocksdb::Slice> operandList(operands.begin(), operands.end());
+	rocksdb::MergeOperator::MergeOperationInput in("key", existing ? &existingSlice : nullptr, operandList, nullptr);
+	rocksdb::Slice existingOperand;
+	rocksdb::MergeOperator::MergeOperationOutput out(result, existingOperand);
+	return op.FullMergeV2(in, &out);
+}
+
+} // namespace
+
+TEST(MergeOperators, ParsesOperatorNames) {
+	MergeOperatorKind kind = MergeOperatorKind::None;
+	EXPECT_TRUE(rocksdb_js::parseMergeOperatorKind("add", kind));
+	EXPECT_EQ(kind, MergeOperatorKind::Add);
+	EXPECT_TRUE(rocksdb_js::parseMergeOperatorKind("append", kind));
+	EXPECT_EQ(kind, MergeOperatorKind::Append);
+	EXPECT_TRUE(rocksdb_js::parseMergeOperatorKind("maxVersion", kind));
+	EXPECT_EQ(kind, MergeOperatorKind::MaxVersion);
+	EXPECT_FALSE(rocksdb_js::parseMergeOperatorKind("sum", kind));
+}
+
+TEST(MergeOperators, AddsToAMissingValue) {
+	std::string result;
+	ASSERT_TRUE(fullMerge(nullptr, { add(5), add(7) }, result));
+	EXPECT_EQ(result, be64(12));
+}
+
+TEST(MergeOperators, AddsToAnExistingValue) {
+	std::string existing = be64(100);
+	std::string result;
+	ASSERT_TRUE(fullMerge(&existing, { add(1) }, result));
+	EXPECT_EQ(result, be64(101));
+}
+
+// A decrement is the two's complement delta; the counter wraps like a uint64.
+TEST(MergeOperators, AddWraps) {
+	std::string existing = be64(1);
+	std::string result;
+	ASSERT_TRUE(fullMerge(&existing, { add(static_cast<uint64_t>(-2)) }, result));
+	EXPECT_EQ(result, be64(UINT64_MAX));
+}
+
+TEST(MergeOperators, AddTreatsAMalformedValueAsZero) {
+	std::string existing = "not a counter";
+	std::string result;
+	ASSERT_TRUE(fullMerge(&existing, { add(3) }, result));
+	EXPECT_EQ(result, be64(3));
+}
+
+TEST(MergeOperators, AppendsFramedElements) {
+	std::string result;
+	ASSERT_TRUE(fullMerge(nullptr, { append("a"), append("bc") }, result));
+	EXPECT_EQ(result, frame("a") + frame("bc"));
+
+	std::string existing = result;
+	ASSERT_TRUE(fullMerge(&existing, { append("d") }, result));
+	EXPECT_EQ(result, frame("a") + frame("bc") + frame("d"));
+}
+
+TEST(MergeOperators, AppendDropsTheOldestElementsPastTheCap) {
+	std::string result;
+	// every element is 4 + 3 bytes, so a 16-byte cap holds two
+	ASSERT_TRUE(fullMerge(nullptr, { append("one", 16), append("two", 16), append("six", 16) }, result));
+	EXPECT_EQ(result, frame("two") + frame("six"));
+}
+
+TEST(MergeOperators, AppendKeepsAnElementLargerThanTheCap) {
+	std::string result;
+	ASSERT_TRUE(fullMerge(nullptr, { append("small", 8), append("much too large", 8) }, result));
+	EXPECT_EQ(result, frame("much too large"));
+}
+
+TEST(MergeOperators, AppendRestartsFromAnUnframedValue) {
+	std::string existing = "plain value";
+	std::string result;
+	ASSERT_TRUE(fullMerge(&existing, { append("x") }, result));
+	EXPECT_EQ(result, frame("x"));
+}
+
+TEST(MergeOperators, MaxVersionKeepsTheHighestVersion) {
+	std::string existing = versioned(1.7e12, "current");
+	std::string result;
+	ASSERT_TRUE(fullMerge(&existing, { maxVersion(versioned(1.6e12, "stale")) }, result));
+	EXPECT_EQ(result, existing);
+
+	ASSERT_TRUE(fullMerge(&existing, { maxVersion(versioned(1.8e12, "newer")), maxVersion(versioned(1.75e12, "late")) }, result));
+	EXPECT_EQ(result, versioned(1.8e12, "newer"));
+}
+
+TEST(MergeOperators, MaxVersionTakesAnyValueWhenMissing) {
+	std::string result;
+	ASSERT_TRUE(fullMerge(nullptr, { maxVersion(versioned(1.0, "first")) }, result));
+	EXPECT_EQ(result, versioned(1.0, "first"));
+}
+
+TEST(MergeOperators, RejectsUnknownOperands) {
+	std::string result;
+	EXPECT_FALSE(fullMerge(nullptr, { std::string("\x7f", 1) }, result));
+	EXPECT_FALSE(fullMerge(nullptr, { std::string() }, result));
+	EXPECT_FALSE(fullMerge(nullptr, { encodeMergeOperand(MergeOperatorKind::Add, 0, "short") }, result));
+}
+
+TEST(MergeOperators, PartialMergeCombinesAddsAndVersions) {
+	BuiltinMergeOperator op;
+	std::string merged;
+	ASSERT_TRUE(op.PartialMerge("key", add(2), add(3), &merged, nullptr));
+	EXPECT_EQ(merged, add(5));
+
+	ASSERT_TRUE(op.PartialMerge("key", maxVersion(versioned(2.0, "b")), maxVersion(versioned(1.0, "a")), &merged, nullptr));
+	EXPECT_EQ(merged, maxVersion(versioned(2.0, "b")));
+
+	// appends depend on what came before, and kinds are never mixed
+	EXPECT_FALSE(op.PartialMerge("key", append("a"), append("b"), &merged, nullptr));
+	EXPECT_FALSE(op.PartialMerge("key", add(1), maxVersion(versioned(1.0, "a")), &merged, nullptr));
+}
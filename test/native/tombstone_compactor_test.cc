@@ -0,0 +1,181 @@
+// Unit tests for the tombstone compactor: which reports queue a range, how the
+// queue is bounded, and how the background thread counts and stops its
+// compactions. The compaction itself is a fake that records its ranges.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/tombstone_compactor.h"
+
+using namespace rocksdb_js;
+
+namespace {
+
+constexpr uint32_t kCf = 0;
+
+// Records the ranges compacted, optionally holding each compaction until
+// released or canceled.
+struct FakeCompaction {
+	std::mutex mutex;
+	std::condition_variable cv;
+	std::vector<std::string> ranges;
+	bool hold = false;
+	rocksdb::Status result = rocksdb::Status::OK();
+
+	TombstoneCompactor::CompactFn fn() {
+		return [this](uint32_t, const std::string& start, const std::string& end, std::atomic<bool>* canceled, uint64_t& bytes) {
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->ranges.push_back(start + ".." + end);
+			this->cv.notify_all();
+			while (this->hold && !canceled->load()) {
+				this->cv.wait_for(lock, std::chrono::milliseconds(1));
+			}
+			bytes = 100;
+			return canceled->load() ? rocksdb::Status::Aborted() : this->result;
+		};
+	}
+
+	void release() {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->hold = false;
+		this->cv.notify_all();
+	}
+
+	size_t started() {
+		std::lock_guard<std::mutex> lock(this->mutex);
+		return this->ranges.size();
+	}
+};
+
+template <typename Pred>
+bool waitFor(Pred pred) {
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (!pred()) {
+		if (std::chrono::steady_clock::now() > deadline) {
+			return false;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	return true;
+}
+
+} // namespace
+
+TEST(TombstoneCompactor, CountsReportsBelowTheThresholdWithoutQueueing) {
+	FakeCompaction fake;
+	auto compactor = std::make_shared<TombstoneCompactor>(100, 0, fake.fn());
+	compactor->report(kCf, "a", "b", 99);
+	compactor->report(kCf, "a", "b", 0);
+
+	auto stats = compactor->getStats();
+	EXPECT_EQ(stats.skippedTombstones, 99);
+	EXPECT_EQ(stats.queuedRanges, 0);
+	EXPECT_EQ(fake.started(), 0u);
+}
+
+TEST(TombstoneCompactor, CompactsAReportedRange) {
+	FakeCompaction fake;
+	auto compactor = std::make_shared<TombstoneCompactor>(100, 0, fake.fn());
+	compactor->report(kCf, "a", "b", 100);
+
+	ASSERT_TRUE(waitFor([&] { return compactor->getStats().compactedRanges == 1; }));
+	auto stats = compactor->getStats();
+	EXPECT_EQ(stats.skippedTombstones, 100);
+	EXPECT_EQ(stats.compactedBytes, 100);
+	EXPECT_EQ(stats.queuedRanges, 0);
+	EXPECT_EQ(fake.ranges, std::vector<std::string>{ "a..b" });
+	compactor->shutdown();
+}
+
+TEST(TombstoneCompactor, IgnoresRangesUnboundedOnBothSides) {
+	FakeCompaction fake;
+	auto compactor = std::make_shared<TombstoneCompactor>(1, 0, fake.fn());
+	compactor->report(kCf, "", "", 100);
+	compactor->report(kCf, "", "b", 100);
+
+	ASSERT_TRUE(waitFor([&] { return compactor->getStats().compactedRanges == 1; }));
+	auto stats = compactor->getStats();
+	EXPECT_EQ(stats.skippedTombstones, 200);
+	EXPECT_EQ(fake.ranges, std::vector<std::string>{ "..b" });
+	compactor->shutdown();
+}
+
+TEST(TombstoneCompactor, QueuesARangeOnceWhileItIsPending) {
+	FakeCompaction fake;
+	fake.hold = true;
+	auto compactor = std::make_shared<TombstoneCompactor>(1, 0, fake.fn());
+	compactor->report(kCf, "a", "b", 1);
+	ASSERT_TRUE(waitFor([&] { return fake.started() == 1; }));
+
+	// the range being compacted is still pending
+	compactor->report(kCf, "a", "b", 1);
+	compactor->report(kCf, "c", "d", 1);
+	compactor->report(kCf, "c", "d", 1);
+	EXPECT_EQ(compactor->getStats().queuedRanges, 2);
+
+	fake.release();
+	ASSERT_TRUE(waitFor([&] { return compactor->getStats().compactedRanges == 2; }));
+	EXPECT_EQ(fake.ranges, (std::vector<std::string>{ "a..b", "c..d" }));
+	compactor->shutdown();
+}
+
+TEST(TombstoneCompactor, DropsReportsWhenTheQueueIsFull) {
+	FakeCompaction fake;
+	fake.hold = true;
+	auto compactor = std::make_shared<TombstoneCompactor>(1, 0, fake.fn());
+	for (size_t i = 0; i < TOMBSTONE_MAX_QUEUED_RANGES; ++i) {
+		compactor->report(kCf, std::to_string(i), "", 1);
+	}
+	compactor->report(kCf, "overflow", "", 1);
+
+	auto stats = compactor->getStats();
+	EXPECT_EQ(stats.queuedRanges, TOMBSTONE_MAX_QUEUED_RANGES);
+	EXPECT_EQ(stats.droppedRanges, 1);
+	compactor->shutdown();
+}
+
+TEST(TombstoneCompactor, CountsFailedCompactions) {
+	FakeCompaction fake;
+	fake.result = rocksdb::Status::IOError("disk full");
+	auto compactor = std::make_shared<TombstoneCompactor>(1, 0, fake.fn());
+	compactor->report(kCf, "a", "b", 1);
+
+	ASSERT_TRUE(waitFor([&] { return compactor->getStats().failedRanges == 1; }));
+	EXPECT_EQ(compactor->getStats().compactedRanges, 0);
+	compactor->shutdown();
+}
+
+TEST(TombstoneCompactor, ShutdownCancelsTheRunningCompaction) {
+	FakeCompaction fake;
+	fake.hold = true;
+	auto compactor = std::make_shared<TombstoneCompactor>(1, 0, fake.fn());
+	compactor->report(kCf, "a", "b", 1);
+	compactor->report(kCf, "c", "d", 1);
+	ASSERT_TRUE(waitFor([&] { return fake.started() == 1; }));
+
+	// returns only once the held compaction saw the cancellation
+	compactor->shutdown();
+	auto stats = compactor->getStats();
+	EXPECT_EQ(stats.failedRanges, 1);
+	EXPECT_EQ(stats.queuedRanges, 0);
+
+	compactor->report(kCf, "e", "f", 1);
+	EXPECT_EQ(compactor->getStats().queuedRanges, 0);
+	EXPECT_EQ(fake.started(), 1u);
+}
+
+TEST(TombstoneCompactor, RecordsMarkedFileCompactions) {
+	FakeCompaction fake;
+	auto compactor = std::make_shared<TombstoneCompactor>(1, 0, fake.fn());
+	compactor->recordMarkedFileCompaction(4096);
+	compactor->recordMarkedFileCompaction(1024);
+
+	auto stats = compactor->getStats();
+	EXPECT_EQ(stats.markedFileCompactions, 2);
+	EXPECT_EQ(stats.markedFileBytes, 5120);
+}
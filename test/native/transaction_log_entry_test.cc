@@ -0,0 +1,183 @@
+// Unit tests for the arena-backed TransactionLogEntryBatch: entries are laid
+// out back to back in a few large chunks, arenas are recycled through the
+// TransactionLogArenaPool, and TransactionLogFile::writeEntries writes the
+// batch out as valid log entries (timestamps and last-entry flag filled in).
+
+#ifndef _WIN32
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include "transaction_log/transaction_log_entry.h"
+#include "transaction_log/transaction_log_recovery.h"
+
+using rocksdb_js::TransactionLogArenaPool;
+using rocksdb_js::TransactionLogEntryArena;
+using rocksdb_js::TransactionLogEntryBatch;
+using rocksdb_js::TransactionLogEntryView;
+using rocksdb_js::TransactionLogFile;
+
+namespace {
+
+std::filesystem::path makeTempDir() {
+	char tmpl[] = "/tmp/rocksdb-js-entry-test-XXXXXX";
+	char* dir = ::mkdtemp(tmpl);
+	EXPECT_NE(dir, nullptr);
+	return std::filesystem::path(dir);
+}
+
+std::vector<char> readFile(const std::filesystem::path& path) {
+	std::ifstream in(path, std::ios::binary);
+	return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+// Small entries share one chunk and sit back to back, header then payload.
+TEST(TransactionLogEntryArena, SmallEntriesAreContiguous) {
+	TransactionLogEntryBatch batch(1.0);
+	batch.addEntry("hello", 5);
+	batch.addEntry("world!", 6);
+
+	auto& entries = batch.entries();
+	ASSERT_EQ(entries.size(), 2u);
+	EXPECT_EQ(batch.arena->chunks.size(), 1u);
+	EXPECT_EQ(entries[0].size, TRANSACTION_LOG_ENTRY_HEADER_SIZE + 5);
+	EXPECT_EQ(entries[1].data, entries[0].data + entries[0].size);
+
+	EXPECT_EQ(rocksdb_js::readUint32BE(entries[1].data + 8), 6u);
+	EXPECT_EQ(rocksdb_js::readUint8(entries[1].data + 12), 0u);
+	EXPECT_EQ(std::string(entries[1].data + TRANSACTION_LOG_ENTRY_HEADER_SIZE, 6), "world!");
+}
+
+// An entry that doesn't fit the active chunk starts a new one; oversized
+// entries get a chunk of their own size. Earlier entries are never moved.
+TEST(TransactionLogEntryArena, SpillsToNewChunkWithoutMovingEntries) {
+	TransactionLogEntryBatch batch(1.0);
+	std::vector<char> big(TransactionLogEntryArena::CHUNK_SIZE, 'b');
+	batch.addEntry("a", 1);
+	char* first = batch.entries()[0].data;
+	batch.addEntry(big.data(), static_cast<uint32_t>(big.size()));
+	batch.addEntry("c", 1);
+
+	EXPECT_EQ(batch.entries()[0].data, first);
+	EXPECT_EQ(batch.arena->chunks.size(), 3u);
+	EXPECT_GE(batch.arena->chunks[1].capacity, big.size() + TRANSACTION_LOG_ENTRY_HEADER_SIZE);
+}
+
+// reset() keeps chunks up to RETAINED_BYTES and rewinds them for reuse.
+TEST(TransactionLogEntryArena, ResetRetainsBoundedCapacity) {
+	TransactionLogEntryArena arena;
+	std::vector<char> payload(TransactionLogEntryArena::CHUNK_SIZE / 2, 'x');
+	for (int i = 0; i < 64; ++i) {
+		arena.append(payload.data(), static_cast<uint32_t>(payload.size()));
+	}
+	EXPECT_GT(arena.capacity(), TransactionLogEntryArena::RETAINED_BYTES);
+
+	arena.reset();
+	EXPECT_TRUE(arena.entries.empty());
+	EXPECT_LE(arena.capacity(), TransactionLogEntryArena::RETAINED_BYTES);
+	EXPECT_GT(arena.capacity(), 0u);
+
+	// the retained chunk is reused from its start
+	char* reused = arena.chunks[0].data.get();
+	arena.append("z", 1);
+	EXPECT_EQ(arena.entries[0].data, reused);
+}
+
+// truncate() drops later entries, for rolling back to a savepoint, and leaves
+// the earlier ones in place.
+TEST(TransactionLogEntryBatch, TruncateKeepsEarlierEntries) {
+	TransactionLogEntryBatch batch(1.0);
+	batch.addEntry("kept", 4);
+	char* kept = batch.entries()[0].data;
+	batch.addEntry("undone", 6);
+	batch.addEntry("undone", 6);
+
+	batch.truncate(1);
+	ASSERT_EQ(batch.entries().size(), 1u);
+	EXPECT_EQ(batch.entries()[0].data, kept);
+
+	// truncating to at least the current size is a no-op
+	batch.truncate(5);
+	EXPECT_EQ(batch.entries().size(), 1u);
+
+	batch.addEntry("next", 4);
+	ASSERT_EQ(batch.entries().size(), 2u);
+	EXPECT_EQ(std::string(batch.entries()[1].data + TRANSACTION_LOG_ENTRY_HEADER_SIZE, 4), "next");
+}
+
+// A destroyed batch hands its arena back to the pool, and the next batch
+// reuses it (same chunk memory, no entries).
+TEST(TransactionLogArenaPool, RecyclesArenas) {
+	auto pool = std::make_shared<TransactionLogArenaPool>();
+	char* chunkData = nullptr;
+	{
+		TransactionLogEntryBatch batch(1.0, pool);
+		batch.addEntry("hello", 5);
+		chunkData = batch.arena->chunks[0].data.get();
+		EXPECT_EQ(pool->size(), 0u);
+	}
+	EXPECT_EQ(pool->size(), 1u);
+
+	TransactionLogEntryBatch batch(2.0, pool);
+	EXPECT_EQ(pool->size(), 0u);
+	EXPECT_TRUE(batch.entries().empty());
+	batch.addEntry("again", 5);
+	EXPECT_EQ(batch.entries()[0].data, chunkData);
+}
+
+TEST(TransactionLogArenaPool, CapsIdleArenas) {
+	TransactionLogArenaPool pool;
+	for (size_t i = 0; i < TransactionLogArenaPool::MAX_POOLED + 4; ++i) {
+		pool.release(std::make_unique<TransactionLogEntryArena>());
+	}
+	EXPECT_EQ(pool.size(), TransactionLogArenaPool::MAX_POOLED);
+}
+
+// Writing a batch spanning several chunks produces valid entries on disk with
+// the batch timestamp and only the last entry flagged.
+TEST(TransactionLogEntryBatchWrite, WritesEntriesAcrossChunks) {
+	auto dir = makeTempDir();
+	auto path = dir / "1.txnlog";
+	{
+		TransactionLogFile file(path, 1);
+		file.open(100.0);
+
+		TransactionLogEntryBatch batch(123.5);
+		std::vector<char> big(TransactionLogEntryArena::CHUNK_SIZE, 'b');
+		batch.addEntry("first", 5);
+		batch.addEntry(big.data(), static_cast<uint32_t>(big.size()));
+		batch.addEntry("last", 4);
+		ASSERT_GT(batch.arena->chunks.size(), 1u);
+
+		file.writeEntries(batch, 0);
+		EXPECT_TRUE(batch.isComplete());
+		file.close();
+	}
+
+	auto bytes = readFile(path);
+	std::vector<TransactionLogEntryView> seen;
+	uint32_t end = rocksdb_js::forEachTransactionLogEntry(bytes.data(), static_cast<uint32_t>(bytes.size()), 0,
+		[&](const TransactionLogEntryView& entry) {
+			seen.push_back(entry);
+			return true;
+		});
+	EXPECT_EQ(end, bytes.size());
+	ASSERT_EQ(seen.size(), 3u);
+	for (size_t i = 0; i < seen.size(); ++i) {
+		EXPECT_EQ(seen[i].timestamp, 123.5);
+		EXPECT_EQ((seen[i].flags & TRANSACTION_LOG_ENTRY_LAST_FLAG) != 0, i == seen.size() - 1);
+	}
+	EXPECT_EQ(std::string(seen[0].data, seen[0].length), "first");
+	EXPECT_EQ(seen[1].length, TransactionLogEntryArena::CHUNK_SIZE);
+	EXPECT_EQ(std::string(seen[2].data, seen[2].length), "last");
+
+	std::filesystem::remove_all(dir);
+}
+
+#endif // _WIN32
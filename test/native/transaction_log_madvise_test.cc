@@ -1,4 +1,6 @@
-// Unit tests for TransactionLogFile::adviseCold (POSIX MADV_COLD path).
+// Unit tests for TransactionLogFile::adviseCold (POSIX MADV_COLD path) and the
+// opt-in read-ahead / huge page hints (MADV_WILLNEED, MADV_SEQUENTIAL,
+// MADV_HUGEPAGE).
 //
 // The production code calls ROCKSDB_JS_MADVISE() instead of ::madvise()
 // directly. This translation unit provides rocksdb_js_mock_madvise(), which the
@@ -31,9 +33,12 @@ static int g_madvise_advice = 0;
 // instead of forwarding to the real madvise().
 static int g_madvise_forced_result = 0;
 static int g_madvise_errno = 0;
+// Every advice value passed to the mock, in call order.
+static std::vector<int> g_madvise_advices;
 
 extern "C" int rocksdb_js_mock_madvise(void* addr, size_t len, int advice) {
 	++g_madvise_calls;
+	g_madvise_advices.push_back(advice);
 	g_madvise_addr = addr;
 	g_madvise_len = len;
 	g_madvise_advice = advice;
@@ -50,7 +55,6 @@ extern "C" int rocksdb_js_mock_madvise(void* addr, size_t len, int advice) {
 
 namespace {
 
-#ifdef MADV_COLD
 long pageSize() {
 	long ps = ::sysconf(_SC_PAGESIZE);
 	return ps > 0 ? ps : 4096;
@@ -83,7 +87,14 @@ std::unique_ptr<rocksdb_js::TransactionLogFile> makeMappedLog(size_t fileBytes,
 	EXPECT_NE(map, nullptr);
 	return log;
 }
-#endif
+
+size_t countAdvice(int advice) {
+	size_t count = 0;
+	for (int a : g_madvise_advices) {
+		count += (a == advice);
+	}
+	return count;
+}
 
 class TransactionLogMadviseTest : public ::testing::Test {
 protected:
@@ -94,8 +105,16 @@ protected:
 		g_madvise_advice = 0;
 		g_madvise_forced_result = 0;
 		g_madvise_errno = 0;
+		g_madvise_advices.clear();
 #ifdef ROCKSDB_JS_NATIVE_TESTS
 		rocksdb_js::TransactionLogFile::resetAdviseColdSupportForTests();
+		rocksdb_js::TransactionLogFile::resetMemoryMapHintsForTests();
+#endif
+	}
+
+	void TearDown() override {
+#ifdef ROCKSDB_JS_NATIVE_TESTS
+		rocksdb_js::TransactionLogFile::resetMemoryMapHintsForTests();
 #endif
 	}
 };
@@ -164,4 +183,114 @@ TEST_F(TransactionLogMadviseTest, LatchesOffOnEINVAL) {
 #endif
 }
 
+// Read-ahead is opt-in: with the flag off, no hint is issued.
+TEST_F(TransactionLogMadviseTest, ReadAheadDisabledIsNoOp) {
+	const long ps = pageSize();
+	auto log = makeMappedLog(static_cast<size_t>(ps) * 4, static_cast<uint32_t>(ps) * 8);
+	g_madvise_calls = 0;
+	g_madvise_advices.clear();
+
+	EXPECT_EQ(log->adviseReadAhead(0, true), 0u);
+	EXPECT_EQ(g_madvise_calls, 0);
+}
+
+// MADV_WILLNEED covers [offset, actualSize) with both ends floored to a page
+// boundary, so it never reaches the anonymous tail; a sequential scan also
+// issues MADV_SEQUENTIAL over the file-backed region.
+TEST_F(TransactionLogMadviseTest, ReadAheadAdvisesScanRangeFlooredToPage) {
+	const long ps = pageSize();
+	const size_t fileBytes = static_cast<size_t>(ps) * 4 + 100; // not page-aligned
+	auto log = makeMappedLog(fileBytes, static_cast<uint32_t>(ps) * 8);
+	rocksdb_js::TransactionLogFile::readAheadEnabled.store(true);
+	g_madvise_calls = 0;
+	g_madvise_advices.clear();
+
+	const uint32_t offset = static_cast<uint32_t>(ps) + 13; // mid-page
+	size_t advised = log->adviseReadAhead(offset, true);
+
+	const size_t end = static_cast<size_t>(ps) * 4;
+	const size_t start = static_cast<size_t>(ps);
+	EXPECT_EQ(advised, end - start);
+	EXPECT_EQ(countAdvice(MADV_SEQUENTIAL), 1u);
+	EXPECT_EQ(countAdvice(MADV_WILLNEED), 1u);
+	// the last call is the WILLNEED for the scan range
+	EXPECT_EQ(g_madvise_advice, MADV_WILLNEED);
+	EXPECT_EQ(g_madvise_addr, static_cast<char*>(log->memoryMap->map) + start);
+	EXPECT_EQ(g_madvise_len, end - start);
+}
+
+// A non-sequential hint issues only MADV_WILLNEED.
+TEST_F(TransactionLogMadviseTest, ReadAheadWithoutSequentialSkipsSequentialHint) {
+	const long ps = pageSize();
+	auto log = makeMappedLog(static_cast<size_t>(ps) * 2, static_cast<uint32_t>(ps) * 4);
+	rocksdb_js::TransactionLogFile::readAheadEnabled.store(true);
+	g_madvise_calls = 0;
+	g_madvise_advices.clear();
+
+	EXPECT_EQ(log->adviseReadAhead(0, false), static_cast<size_t>(ps) * 2);
+	EXPECT_EQ(countAdvice(MADV_SEQUENTIAL), 0u);
+	EXPECT_EQ(countAdvice(MADV_WILLNEED), 1u);
+}
+
+// Scanning from at or past the last full page advises nothing with WILLNEED.
+TEST_F(TransactionLogMadviseTest, ReadAheadAtEndAdvisesNothing) {
+	const long ps = pageSize();
+	auto log = makeMappedLog(static_cast<size_t>(ps) * 2 + 100, static_cast<uint32_t>(ps) * 4);
+	rocksdb_js::TransactionLogFile::readAheadEnabled.store(true);
+	g_madvise_calls = 0;
+	g_madvise_advices.clear();
+
+	EXPECT_EQ(log->adviseReadAhead(static_cast<uint32_t>(ps) * 2 + 50, false), 0u);
+	EXPECT_EQ(countAdvice(MADV_WILLNEED), 0u);
+}
+
+// With huge pages enabled, the anonymous region is advised with MADV_HUGEPAGE
+// over the full requested map size when the map is created.
+TEST_F(TransactionLogMadviseTest, HugePagesAdvisesAnonymousRegion) {
+#if !defined(MADV_HUGEPAGE) || !TRANSACTION_LOG_ENABLE_ANONYMOUS_OVERLAY
+	GTEST_SKIP() << "MADV_HUGEPAGE or the anonymous overlay is not available on this platform";
+#else
+	const long ps = pageSize();
+	const uint32_t mapSize = static_cast<uint32_t>(ps) * 8;
+	rocksdb_js::TransactionLogFile::hugePagesEnabled.store(true);
+
+	auto log = makeMappedLog(static_cast<size_t>(ps) * 2, mapSize);
+
+	EXPECT_EQ(countAdvice(MADV_HUGEPAGE), 1u);
+	EXPECT_EQ(g_madvise_len, static_cast<size_t>(mapSize));
+	EXPECT_EQ(g_madvise_addr, log->memoryMap->map);
+#endif
+}
+
+// Without the opt-in, creating a map issues no MADV_HUGEPAGE.
+TEST_F(TransactionLogMadviseTest, HugePagesDisabledByDefault) {
+	const long ps = pageSize();
+	auto log = makeMappedLog(static_cast<size_t>(ps) * 2, static_cast<uint32_t>(ps) * 8);
+#ifdef MADV_HUGEPAGE
+	EXPECT_EQ(countAdvice(MADV_HUGEPAGE), 0u);
+#endif
+	EXPECT_EQ(g_madvise_calls, 0);
+}
+
+// residency() reports the file-backed pages of the live map; after touching
+// every page, nothing is left to fault in.
+TEST_F(TransactionLogMadviseTest, ResidencyCountsFileBackedPages) {
+	const long ps = pageSize();
+	const size_t fileBytes = static_cast<size_t>(ps) * 3;
+	auto log = makeMappedLog(fileBytes, static_cast<uint32_t>(ps) * 8);
+
+	volatile char sum = 0;
+	const char* data = static_cast<const char*>(log->memoryMap->map);
+	for (size_t i = 0; i < fileBytes; i += static_cast<size_t>(ps)) {
+		sum += data[i];
+	}
+	(void)sum;
+
+	uint64_t residentBytes = 0;
+	uint64_t nonResidentPages = 99;
+	ASSERT_TRUE(log->residency(residentBytes, nonResidentPages));
+	EXPECT_EQ(residentBytes, fileBytes);
+	EXPECT_EQ(nonResidentPages, 0u);
+}
+
 #endif // _WIN32
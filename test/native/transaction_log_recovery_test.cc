@@ -10,8 +10,10 @@
 #include "transaction_log/transaction_log_recovery.h"
 
 using rocksdb_js::countTransactionLogEntries;
+using rocksdb_js::forEachTransactionLogEntry;
 using rocksdb_js::RecoveryScan;
 using rocksdb_js::scanTransactionLogForRecovery;
+using rocksdb_js::TransactionLogEntryView;
 
 namespace {
 
@@ -214,3 +216,59 @@ TEST(TransactionLogCount, CountsLargeEntryExceedingRotationSize) {
 	img.entry(10).entry(64 * 1024).entry(20);
 	EXPECT_EQ(countTransactionLogEntries(img.data(), img.size()), 3u);
 }
+
+TEST(TransactionLogForEach, VisitsEntriesInOrder) {
+	LogImage img;
+	uint32_t first = img.size();
+	img.entry(10).entry(20, /*flags=*/0).entry(30);
+	std::vector<uint32_t> offsets;
+	std::vector<uint32_t> lengths;
+	uint32_t end = forEachTransactionLogEntry(img.data(), img.size(), 0,
+		[&](const TransactionLogEntryView& entry) {
+			offsets.push_back(entry.offset);
+			lengths.push_back(entry.length);
+			EXPECT_EQ(entry.timestamp, 2.0);
+			EXPECT_EQ(entry.data, img.data() + entry.offset + TRANSACTION_LOG_ENTRY_HEADER_SIZE);
+			return true;
+		});
+	EXPECT_EQ(end, img.size());
+	ASSERT_EQ(offsets.size(), 3u);
+	EXPECT_EQ(offsets[0], first);
+	EXPECT_EQ(lengths, (std::vector<uint32_t>{ 10, 20, 30 }));
+}
+
+TEST(TransactionLogForEach, ResumesFromOffset) {
+	LogImage img;
+	img.entry(10);
+	uint32_t second = img.size();
+	img.entry(20).entry(30);
+	uint32_t count = 0;
+	uint32_t end = forEachTransactionLogEntry(img.data(), img.size(), second,
+		[&](const TransactionLogEntryView&) { ++count; return true; });
+	EXPECT_EQ(count, 2u);
+	EXPECT_EQ(end, img.size());
+}
+
+TEST(TransactionLogForEach, VisitorStopLeavesEntryUnconsumed) {
+	LogImage img;
+	img.entry(10);
+	uint32_t second = img.size();
+	img.entry(20).entry(30);
+	uint32_t count = 0;
+	uint32_t end = forEachTransactionLogEntry(img.data(), img.size(), 0,
+		[&](const TransactionLogEntryView& entry) { return entry.offset < second && ++count; });
+	EXPECT_EQ(count, 1u);
+	EXPECT_EQ(end, second);
+}
+
+TEST(TransactionLogForEach, StopsAtTornTail) {
+	LogImage img;
+	img.entry(10).entry(20);
+	uint32_t entriesEnd = img.size();
+	img.entryRaw(/*declaredLength=*/5000, /*actualDataLen=*/12);
+	uint32_t count = 0;
+	uint32_t end = forEachTransactionLogEntry(img.data(), img.size(), 0,
+		[&](const TransactionLogEntryView&) { ++count; return true; });
+	EXPECT_EQ(count, 2u);
+	EXPECT_EQ(end, entriesEnd);
+}
@@ -0,0 +1,148 @@
+// Unit tests for the TTL compaction filter: which records a rule expires, and
+// how the verification table slots of dropped keys are settled once the
+// compactions that dropped them complete.
+
+#include <gtest/gtest.h>
+#include <bit>
+#include <memory>
+#include <string>
+#include "core/ttl_compaction_filter.h"
+#include "core/verification_table.h"
+
+using namespace rocksdb_js;
+
+namespace {
+
+std::string be64(uint64_t value) {
+	std::string out;
+	for (int shift = 56; shift >= 0; shift -= 8) {
+		out.push_back(static_cast<char>((value >> shift) & 0xff));
+	}
+	return out;
+}
+
+// A record value with a float64 version prefix, as Harper writes them.
+std::string versioned(double version, const std::string& body) {
+	return be64(std::bit_cast<uint64_t>(version)) + body;
+}
+
+constexpr uint64_t kEpoch = 0x1;
+constexpr uint32_t kCf = 0;
+constexpr double kNow = 1.8e12;
+
+bool filter(TtlCompactionFilter& f, const std::string& key, const std::string& value) {
+	std::string newValue;
+	bool valueChanged = false;
+	return f.Filter(0, key, value, &newValue, &valueChanged);
+}
+
+} // namespace
+
+TEST(TtlCompactionFilter, ExpiresRecordsOlderThanTheTtl) {
+	TtlRule rule;
+	rule.ttl = 1000;
+	EXPECT_TRUE(rule.expired("k", versioned(kNow - 1001, "v"), kNow));
+	EXPECT_FALSE(rule.expired("k", versioned(kNow - 1000, "v"), kNow));
+	EXPECT_FALSE(rule.expired("k", versioned(kNow + 5, "v"), kNow));
+}
+
+TEST(TtlCompactionFilter, NeverExpiresValuesWithoutAVersion) {
+	TtlRule rule;
+	rule.ttl = 1;
+	EXPECT_FALSE(rule.expired("k", "short", kNow));
+	EXPECT_FALSE(rule.expired("k", "", kNow));
+}
+
+TEST(TtlCompactionFilter, ExpiresRecordsBelowAPrefixExpiry) {
+	TtlRule rule;
+	rule.prefixExpiry = { { "session:", 200 } };
+	EXPECT_TRUE(rule.expired("session:a", versioned(100, "v"), kNow));
+	EXPECT_FALSE(rule.expired("session:b", versioned(200, "v"), kNow));
+	EXPECT_FALSE(rule.expired("user:a", versioned(100, "v"), kNow));
+	// a ttl of 0 leaves everything else alone
+	EXPECT_FALSE(rule.expired("user:a", versioned(0, "v"), kNow));
+}
+
+TEST(TtlCompactionFilter, FactorySkipsColumnFamiliesWithoutARule) {
+	auto rules = std::make_shared<TtlRules>();
+	TtlCompactionFilterFactory factory(rules);
+	rocksdb::CompactionFilter::Context context;
+	context.column_family_id = kCf;
+	EXPECT_EQ(factory.CreateCompactionFilter(context), nullptr);
+
+	auto rule = std::make_shared<TtlRule>();
+	rule->ttl = 1000;
+	rules->set(kCf, rule);
+	EXPECT_NE(factory.CreateCompactionFilter(context), nullptr);
+
+	rules->set(kCf, nullptr);
+	EXPECT_EQ(factory.CreateCompactionFilter(context), nullptr);
+}
+
+TEST(TtlCompactionFilter, SettlesDroppedSlotsWhenTheCompactionCompletes) {
+	VerificationTable vt(1024, 0xABCD);
+	const uint8_t partition = VerificationTable::partitionFor(kEpoch, kCf);
+	const uint64_t kV1 = std::bit_cast<uint64_t>(kNow - 5000);
+	const uint64_t kV2 = std::bit_cast<uint64_t>(kNow);
+	auto* expiredSlot = vt.slotFor(kEpoch, kCf, rocksdb::Slice("expired"));
+	auto* liveSlot = vt.slotFor(kEpoch, kCf, rocksdb::Slice("live"));
+	ASSERT_NE(expiredSlot, liveSlot);
+	ASSERT_TRUE(vt.populateVersion(expiredSlot, partition, kV1));
+	ASSERT_TRUE(vt.populateVersion(liveSlot, partition, kV2));
+
+	auto rules = std::make_shared<TtlRules>();
+	auto rule = std::make_shared<TtlRule>();
+	rule->ttl = 1000;
+	rule->vt = &vt;
+	rule->vtEpoch = kEpoch;
+
+	rules->compactionStarted(kCf);
+	{
+		TtlCompactionFilter f(rules, rule, kCf, kNow);
+		EXPECT_TRUE(filter(f, "expired", versioned(kNow - 5000, "v")));
+		EXPECT_FALSE(filter(f, "live", versioned(kNow, "v")));
+	}
+
+	// the dropped record is readable until the compaction output is installed
+	EXPECT_TRUE(VerificationTable::verifyVersion(expiredSlot, kV1));
+
+	rules->compactionCompleted(kCf);
+	EXPECT_FALSE(VerificationTable::verifyVersion(expiredSlot, kV1));
+	EXPECT_TRUE(VerificationTable::verifyVersion(liveSlot, kV2));
+}
+
+// Slots queued while another compaction runs are settled again when it
+// completes, in case they were its and a reader cached the old version in
+// between.
+TEST(TtlCompactionFilter, ResettlesSlotsUntilNoCompactionIsRunning) {
+	VerificationTable vt(8, 0xABCD);
+	const uint8_t partition = VerificationTable::partitionFor(kEpoch, kCf);
+	const uint64_t kV1 = std::bit_cast<uint64_t>(kNow - 5000);
+	auto* slot = vt.slotFor(kEpoch, kCf, rocksdb::Slice("expired"));
+
+	auto rules = std::make_shared<TtlRules>();
+	auto rule = std::make_shared<TtlRule>();
+	rule->ttl = 1000;
+	rule->vt = &vt;
+	rule->vtEpoch = kEpoch;
+
+	rules->compactionStarted(kCf);
+	rules->compactionStarted(kCf);
+	{
+		TtlCompactionFilter f(rules, rule, kCf, kNow);
+		EXPECT_TRUE(filter(f, "expired", versioned(kNow - 5000, "v")));
+	}
+
+	rules->compactionCompleted(kCf);
+	ASSERT_TRUE(vt.populateVersion(slot, partition, kV1));
+	EXPECT_TRUE(VerificationTable::verifyVersion(slot, kV1));
+
+	rules->compactionCompleted(kCf);
+	EXPECT_FALSE(VerificationTable::verifyVersion(slot, kV1));
+
+	// nothing is left queued once no compaction is running
+	ASSERT_TRUE(vt.populateVersion(slot, partition, kV1));
+	rules->compactionStarted(kCf);
+	rules->compactionCompleted(kCf);
+	EXPECT_TRUE(VerificationTable::verifyVersion(slot, kV1));
+}
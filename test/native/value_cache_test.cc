@@ -0,0 +1,111 @@
+// Unit tests for the process-wide ValueCache: version-tagged lookups, store
+// isolation, and CLOCK eviction against the byte budget.
+
+#include <gtest/gtest.h>
+#include <string>
+#include "core/value_cache.h"
+
+using rocksdb_js::ValueCache;
+
+namespace {
+
+constexpr uint64_t kV1 = 0x4278bcfe56800000ULL;
+constexpr uint64_t kV2 = 0x4278bcfe56900000ULL;
+
+// A budget that fits `perShard` entries of `valueSize` bytes in every shard.
+size_t budgetFor(size_t perShard, size_t valueSize) {
+	return ValueCache::SHARDS * perShard * (valueSize + 16 + ValueCache::ENTRY_OVERHEAD);
+}
+
+} // namespace
+
+TEST(ValueCache, DisabledByDefault) {
+	ValueCache cache;
+	EXPECT_FALSE(cache.enabled());
+	cache.insert(1, 0, "k", kV1, "value");
+	std::string out;
+	EXPECT_FALSE(cache.lookup(1, 0, "k", kV1, out));
+	EXPECT_EQ(cache.getStats().entries, 0u);
+}
+
+// An entry is only served for the version it was tagged with.
+TEST(ValueCache, ServesOnlyTheTaggedVersion) {
+	ValueCache cache(1024 * 1024);
+	cache.insert(1, 0, "k", kV1, "first");
+
+	std::string out;
+	EXPECT_FALSE(cache.lookup(1, 0, "k", kV2, out));
+	ASSERT_TRUE(cache.lookup(1, 0, "k", kV1, out));
+	EXPECT_EQ(out, "first");
+
+	cache.insert(1, 0, "k", kV2, "second");
+	EXPECT_FALSE(cache.lookup(1, 0, "k", kV1, out));
+	ASSERT_TRUE(cache.lookup(1, 0, "k", kV2, out));
+	EXPECT_EQ(out, "second");
+
+	auto stats = cache.getStats();
+	EXPECT_EQ(stats.entries, 1u);
+	EXPECT_EQ(stats.hits, 2u);
+	EXPECT_EQ(stats.misses, 2u);
+	EXPECT_EQ(stats.inserts, 2u);
+}
+
+TEST(ValueCache, IsolatesDatabasesAndColumnFamilies) {
+	ValueCache cache(1024 * 1024);
+	cache.insert(1, 0, "k", kV1, "db1");
+	cache.insert(2, 0, "k", kV1, "db2");
+	cache.insert(1, 7, "k", kV1, "cf7");
+
+	std::string out;
+	ASSERT_TRUE(cache.lookup(1, 0, "k", kV1, out));
+	EXPECT_EQ(out, "db1");
+	ASSERT_TRUE(cache.lookup(2, 0, "k", kV1, out));
+	EXPECT_EQ(out, "db2");
+	ASSERT_TRUE(cache.lookup(1, 7, "k", kV1, out));
+	EXPECT_EQ(out, "cf7");
+	EXPECT_FALSE(cache.lookup(3, 0, "k", kV1, out));
+}
+
+TEST(ValueCache, EvictsToTheByteBudget) {
+	const std::string value(100, 'x');
+	ValueCache cache(budgetFor(16, value.size()));
+	for (int i = 0; i < 1000; ++i) {
+		cache.insert(1, 0, "key-" + std::to_string(i), kV1, value);
+	}
+	auto stats = cache.getStats();
+	EXPECT_LE(stats.bytes, stats.capacity);
+	EXPECT_GT(stats.evictions, 0u);
+	EXPECT_EQ(stats.entries + stats.evictions, 1000u);
+}
+
+// A referenced entry survives a sweep that evicts unreferenced ones.
+TEST(ValueCache, KeepsReferencedEntries) {
+	const std::string value(100, 'x');
+	ValueCache cache(budgetFor(16, value.size()));
+	cache.insert(1, 0, "hot", kV1, value);
+	std::string out;
+	for (int i = 0; i < 1000; ++i) {
+		ASSERT_TRUE(cache.lookup(1, 0, "hot", kV1, out)) << i;
+		cache.insert(1, 0, "cold-" + std::to_string(i), kV1, value);
+	}
+}
+
+TEST(ValueCache, SkipsOversizedValues) {
+	ValueCache cache(budgetFor(16, 100));
+	cache.insert(1, 0, "big", kV1, std::string(1000, 'x'));
+	std::string out;
+	EXPECT_FALSE(cache.lookup(1, 0, "big", kV1, out));
+	EXPECT_EQ(cache.getStats().inserts, 0u);
+}
+
+TEST(ValueCache, ZeroCapacityDropsEverything) {
+	ValueCache cache(1024 * 1024);
+	for (int i = 0; i < 100; ++i) {
+		cache.insert(1, 0, "key-" + std::to_string(i), kV1, "value");
+	}
+	cache.setCapacity(0);
+	auto stats = cache.getStats();
+	EXPECT_EQ(stats.entries, 0u);
+	EXPECT_EQ(stats.bytes, 0u);
+	EXPECT_FALSE(cache.enabled());
+}
@@ -4,6 +4,12 @@
 // the N-API/JS layer, so we drive the primitives directly here.
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 #include "core/verification_table.h"
 #include "rocksdb/slice.h"
 
@@ -13,6 +19,8 @@ namespace {
 // Realistic positive-float64 version bit patterns (sign bit clear).
 constexpr uint64_t kV1 = 0x4278bcfe56800000ULL;
 constexpr uint64_t kV2 = 0x4278bcfe56900000ULL;
+// Partition tag for stores that do not exercise partitioning.
+const uint8_t kP = VerificationTable::partitionFor(0x1, 0);
 }  // namespace
 
 // A cold populate is a single CAS from the value observed before the read; it
@@ -24,7 +32,7 @@ TEST(VerificationTable, ColdPopulateSucceedsWhenSlotUnchanged) {
 
 	uint64_t observed = slot->load();
 	EXPECT_EQ(observed, 0u);
-	EXPECT_TRUE(VerificationTable::populateVersionIfUnchanged(slot, observed, kV1));
+	EXPECT_TRUE(vt.populateVersionIfUnchanged(slot, kP, observed, vt.clearGeneration(kP), kV1));
 	EXPECT_TRUE(VerificationTable::verifyVersion(slot, kV1));
 }
 
@@ -44,7 +52,7 @@ TEST(VerificationTable, ColdPopulateLosesToInterveningWriteCycle) {
 	vt.releaseWriteIntent(slot, t);
 
 	// The stale reader's CAS from the pre-write value must fail.
-	EXPECT_FALSE(VerificationTable::populateVersionIfUnchanged(slot, observed, kV1));
+	EXPECT_FALSE(vt.populateVersionIfUnchanged(slot, kP, observed, vt.clearGeneration(kP), kV1));
 	EXPECT_FALSE(VerificationTable::verifyVersion(slot, kV1));
 	EXPECT_TRUE(vtIsSettled(slot->load()));
 }
@@ -82,7 +90,7 @@ TEST(VerificationTable, ColdPopulateNeverOverwritesLock) {
 	EXPECT_TRUE(vtIsLock(lockVal));
 
 	// Even if `observed` happened to equal the lock value, never publish over it.
-	EXPECT_FALSE(VerificationTable::populateVersionIfUnchanged(slot, lockVal, kV1));
+	EXPECT_FALSE(vt.populateVersionIfUnchanged(slot, kP, lockVal, vt.clearGeneration(kP), kV1));
 	EXPECT_TRUE(vtIsLock(slot->load()));
 
 	vt.releaseWriteIntent(slot, t);  // cleanup
@@ -101,7 +109,7 @@ TEST(VerificationTable, ColdPopulateSucceedsFromSettledWhenReobserved) {
 	ASSERT_TRUE(vtIsSettled(settled));
 
 	// Re-observe the settled value, then publish — succeeds (no intervening write).
-	EXPECT_TRUE(VerificationTable::populateVersionIfUnchanged(slot, settled, kV2));
+	EXPECT_TRUE(vt.populateVersionIfUnchanged(slot, kP, settled, vt.clearGeneration(kP), kV2));
 	EXPECT_TRUE(VerificationTable::verifyVersion(slot, kV2));
 }
 
@@ -120,7 +128,7 @@ TEST(VerificationTable, DistinctDbEpochsAddressIndependentSlots) {
 
 	auto* slotOld = vt.slotFor(epochOld, 0, key);
 	ASSERT_NE(slotOld, nullptr);
-	ASSERT_TRUE(VerificationTable::populateVersion(slotOld, kV1));
+	ASSERT_TRUE(vt.populateVersion(slotOld, kP, kV1));
 	ASSERT_TRUE(VerificationTable::verifyVersion(slotOld, kV1));
 
 	for (uint64_t epochNew = 2; epochNew < 100; ++epochNew) {
@@ -157,3 +165,277 @@ TEST(VerificationTable, EncodingClassesAreDisjoint) {
 	EXPECT_FALSE(vtIsLock(0));
 	EXPECT_FALSE(vtIsSettled(0));
 }
+
+// The batched check agrees with per-key verifyVersion() for keys of mixed
+// lengths (exercising both the multi-lane and the scalar hash paths, and more
+// than one prefetch chunk), and the bitmap is LSB-first.
+TEST(VerificationTable, VerifyVersionsMatchesPerKeyVerify) {
+	VerificationTable vt(1 << 12, 0xABCD);
+	const size_t count = VerificationTable::VT_VERIFY_CHUNK + 13;
+	std::vector<std::string> keyStorage;
+	for (size_t i = 0; i < count; ++i) {
+		keyStorage.push_back("record-" + std::string(i % 19, 'x') + std::to_string(i));
+	}
+	std::vector<rocksdb::Slice> keys(keyStorage.begin(), keyStorage.end());
+	std::vector<uint64_t> versions(count);
+	for (size_t i = 0; i < count; ++i) {
+		versions[i] = kV1 + i;
+		if (i % 3 != 0) {
+			vt.populateVersion(vt.slotFor(9, 2, keys[i]), kP, versions[i]);
+		}
+	}
+	versions[1] = 0; // never fresh
+
+	std::vector<uint8_t> bitmap((count + 7) / 8, 0xFF);
+	size_t fresh = vt.verifyVersions(9, 2, keys.data(), versions.data(), count, bitmap.data());
+
+	size_t expectedFresh = 0;
+	for (size_t i = 0; i < count; ++i) {
+		bool expected = VerificationTable::verifyVersion(vt.slotFor(9, 2, keys[i]), versions[i]);
+		bool actual = (bitmap[i >> 3] >> (i & 7)) & 1;
+		EXPECT_EQ(actual, expected) << "key " << i;
+		expectedFresh += expected ? 1 : 0;
+	}
+	EXPECT_EQ(fresh, expectedFresh);
+	EXPECT_GT(fresh, 0u);
+	EXPECT_FALSE(bitmap[0] & 0x02);
+	// trailing bits past `count` are cleared
+	EXPECT_EQ(bitmap.back() >> (count & 7), 0);
+}
+
+TEST(VerificationTable, VerifyVersionsOnDisabledTableIsAllStale) {
+	VerificationTable vt(0, 0xABCD);
+	rocksdb::Slice keys[2] = { rocksdb::Slice("a"), rocksdb::Slice("b") };
+	uint64_t versions[2] = { kV1, kV2 };
+	uint8_t bitmap = 0xFF;
+	EXPECT_EQ(vt.verifyVersions(1, 0, keys, versions, 2, &bitmap), 0u);
+	EXPECT_EQ(bitmap, 0);
+}
+
+// Checks count each outcome once; counters are process-wide, so compare deltas.
+TEST(VerificationTable, CountsCheckOutcomes) {
+	VerificationTable vt(64, 0xABCD);
+	auto* slot = vt.slotFor(0x1, 0, rocksdb::Slice("k"));
+	ASSERT_NE(slot, nullptr);
+	uint64_t hits = vtCounterTotal(VTCounter::FreshHit);
+	uint64_t misses = vtCounterTotal(VTCounter::Miss);
+	uint64_t locks = vtCounterTotal(VTCounter::LockFallback);
+	uint64_t casFailures = vtCounterTotal(VTCounter::PopulateCasFailure);
+
+	EXPECT_FALSE(VerificationTable::verifyVersion(slot, kV1));
+	ASSERT_TRUE(vt.populateVersion(slot, kP, kV1));
+	EXPECT_TRUE(VerificationTable::verifyVersion(slot, kV1));
+
+	LockTracker* t = vt.lockSlotForWrite(slot, 0x1);
+	EXPECT_FALSE(VerificationTable::verifyVersion(slot, kV1));
+	vt.releaseWriteIntent(slot, t);
+	// the slot settled, so a populate from the pre-write observation loses its CAS
+	EXPECT_FALSE(vt.populateVersionIfUnchanged(slot, kP, kV1, vt.clearGeneration(kP), kV2));
+
+	EXPECT_EQ(vtCounterTotal(VTCounter::FreshHit) - hits, 1u);
+	EXPECT_EQ(vtCounterTotal(VTCounter::Miss) - misses, 1u);
+	EXPECT_EQ(vtCounterTotal(VTCounter::LockFallback) - locks, 1u);
+	EXPECT_EQ(vtCounterTotal(VTCounter::PopulateCasFailure) - casFailures, 1u);
+}
+
+TEST(VerificationTable, StatsOnDisabledTable) {
+	VerificationTable vt(0, 0xABCD);
+	vt.sampleSlots();
+	VerificationTableStats stats = VerificationTable::collectStats(&vt);
+	EXPECT_EQ(stats.slots, 0);
+	EXPECT_EQ(stats.occupancy, 0);
+	EXPECT_EQ(stats.recommendedEntries, 0);
+}
+
+// A full-table sample counts every slot class exactly; the estimates follow the
+// uniform-hashing model.
+TEST(VerificationTable, SampledOccupancyAndEstimates) {
+	VerificationTable vt(1024, 0xABCD);
+	size_t versions = 0;
+	for (int i = 0; i < 512; ++i) {
+		std::string key = "key-" + std::to_string(i);
+		auto* slot = vt.slotFor(0x1, 0, rocksdb::Slice(key));
+		if (slot->load() == 0) ++versions;
+		vt.populateVersion(slot, kP, kV1);
+	}
+	auto* settled = vt.slotFor(0x1, 0, rocksdb::Slice("key-0"));
+	vt.releaseWriteIntent(settled, vt.lockSlotForWrite(settled, 0x1));
+
+	vt.sampleSlots(vt.size());
+	VerificationTableStats stats = VerificationTable::collectStats(&vt);
+	EXPECT_EQ(stats.slots, 1024);
+	EXPECT_EQ(stats.versionSlots, static_cast<double>(versions - 1));
+	EXPECT_EQ(stats.settledSlots, 1);
+	EXPECT_DOUBLE_EQ(stats.occupancy, (versions - 1) / 1024.0);
+
+	// 512 keys over 1024 slots: λ ≈ 0.5, so about a fifth of the occupied slots
+	// hold more than one key, and 512 keys need 16384 slots for a 5% chance of
+	// a key sharing its slot.
+	EXPECT_GT(stats.estimatedCollisionRate, 0.15);
+	EXPECT_LT(stats.estimatedCollisionRate, 0.3);
+	EXPECT_EQ(stats.recommendedEntries, 16384);
+}
+
+// A settle sweep marks every slot settled-empty, including ones no key hashed
+// to, so the estimates only count version and lock slots: once the same keys
+// are cached again the recommendation is what it was before the sweep.
+TEST(VerificationTable, SweepKeepsRecommendation) {
+	VerificationTable vt(1024, 0xABCD);
+	auto populate = [&vt]() {
+		for (int i = 0; i < 64; ++i) {
+			std::string key = "key-" + std::to_string(i);
+			vt.populateVersion(vt.slotFor(0x1, 0, rocksdb::Slice(key)), kP, kV1);
+		}
+	};
+	populate();
+	vt.sampleSlots(vt.size());
+	VerificationTableStats before = VerificationTable::collectStats(&vt);
+
+	vt.settleAllSlots();
+	vt.sampleSlots(vt.size());
+	VerificationTableStats swept = VerificationTable::collectStats(&vt);
+	EXPECT_EQ(swept.settledSlots, 1024);
+	EXPECT_EQ(swept.occupancy, 0);
+
+	populate();
+	vt.sampleSlots(vt.size());
+	VerificationTableStats after = VerificationTable::collectStats(&vt);
+	EXPECT_EQ(after.occupancy, before.occupancy);
+	EXPECT_EQ(after.estimatedCollisionRate, before.estimatedCollisionRate);
+	EXPECT_EQ(after.recommendedEntries, before.recommendedEntries);
+	EXPECT_EQ(after.settledSlots, 1024 - after.versionSlots);
+}
+
+// Successive partial samples walk the table rather than rescanning the start,
+// so two half-table windows together see every populated slot once.
+TEST(VerificationTable, SampleWindowAdvances) {
+	VerificationTable vt(8, 0xABCD);
+	std::vector<std::atomic<uint64_t>*> populated;
+	for (const char* key : {"a", "b", "c"}) {
+		auto* slot = vt.slotFor(0x1, 0, rocksdb::Slice(key));
+		vt.populateVersion(slot, kP, kV1);
+		if (std::find(populated.begin(), populated.end(), slot) == populated.end()) {
+			populated.push_back(slot);
+		}
+	}
+
+	vt.sampleSlots(4);
+	double first = VerificationTable::collectStats(&vt).versionSlots / 2;
+	vt.sampleSlots(4);
+	double second = VerificationTable::collectStats(&vt).versionSlots / 2;
+	EXPECT_EQ(first + second, static_cast<double>(populated.size()));
+}
+
+// The background sampler publishes a sample as soon as it starts and is
+// stopped and joined by the destructor.
+TEST(VerificationTable, BackgroundSamplerPublishesAndStops) {
+	auto vt = std::make_unique<VerificationTable>(64, 0xABCD);
+	vt->populateVersion(vt->slotFor(0x1, 0, rocksdb::Slice("k")), kP, kV1);
+	vt->startSampler(std::chrono::milliseconds(1));
+	vt->startSampler(std::chrono::milliseconds(1));
+	EXPECT_GT(VerificationTable::collectStats(vt.get()).occupancy, 0);
+	std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	vt.reset();
+}
+
+namespace {
+// Two stores guaranteed to land in different partitions.
+constexpr uint64_t kDbA = 0x1;
+uint64_t otherPartitionDb() {
+	uint64_t db = kDbA + 1;
+	while (VerificationTable::partitionFor(db, 0) == VerificationTable::partitionFor(kDbA, 0)) ++db;
+	return db;
+}
+}  // namespace
+
+// Clearing one store settles only the slots its partition populated.
+TEST(VerificationTable, SettlePartitionKeepsOtherPartitions) {
+	VerificationTable vt(1 << 12, 0xABCD);
+	const uint64_t dbB = otherPartitionDb();
+	const uint8_t pA = VerificationTable::partitionFor(kDbA, 0);
+	const uint8_t pB = VerificationTable::partitionFor(dbB, 0);
+	auto* slotA = vt.slotFor(kDbA, 0, rocksdb::Slice("a"));
+	auto* slotB = vt.slotFor(dbB, 0, rocksdb::Slice("b"));
+	ASSERT_NE(slotA, slotB);
+	ASSERT_TRUE(vt.populateVersion(slotA, pA, kV1));
+	ASSERT_TRUE(vt.populateVersion(slotB, pB, kV2));
+
+	vt.settlePartition(pA);
+	EXPECT_TRUE(vtIsSettled(slotA->load()));
+	EXPECT_FALSE(VerificationTable::verifyVersion(slotA, kV1));
+	EXPECT_TRUE(VerificationTable::verifyVersion(slotB, kV2));
+}
+
+// A slot two partitions have published into is swept by either one's clear.
+TEST(VerificationTable, SettlePartitionSweepsMixedSlots) {
+	VerificationTable vt(1, 0xABCD);
+	const uint64_t dbB = otherPartitionDb();
+	auto* slot = vt.slotFor(kDbA, 0, rocksdb::Slice("a"));
+	ASSERT_EQ(slot, vt.slotFor(dbB, 0, rocksdb::Slice("b")));
+	ASSERT_TRUE(vt.populateVersion(slot, VerificationTable::partitionFor(kDbA, 0), kV1));
+	ASSERT_TRUE(vt.populateVersion(slot, VerificationTable::partitionFor(dbB, 0), kV2));
+
+	vt.settlePartition(VerificationTable::partitionFor(kDbA, 0));
+	EXPECT_FALSE(VerificationTable::verifyVersion(slot, kV2));
+}
+
+// A read that observed a slot before its partition was cleared must not publish
+// what it read, even though the clear did not sweep that (untagged) slot; the
+// slot is advanced instead so the next read populates.
+TEST(VerificationTable, PopulateRefusesObservationFromBeforeClear) {
+	VerificationTable vt(1 << 12, 0xABCD);
+	const uint8_t pA = VerificationTable::partitionFor(kDbA, 0);
+	auto* slot = vt.slotFor(kDbA, 0, rocksdb::Slice("a"));
+	uint64_t clearGen = vt.clearGeneration(pA);
+	uint64_t observed = slot->load();
+
+	vt.settlePartition(pA);
+	EXPECT_EQ(slot->load(), observed);  // untagged, so not swept
+	EXPECT_FALSE(vt.populateVersionIfUnchanged(slot, pA, observed, clearGen, kV1));
+	EXPECT_FALSE(VerificationTable::verifyVersion(slot, kV1));
+
+	clearGen = vt.clearGeneration(pA);
+	uint64_t reobserved = slot->load();
+	EXPECT_TRUE(vtIsSettled(reobserved));
+	EXPECT_TRUE(vt.populateVersionIfUnchanged(slot, pA, reobserved, clearGen, kV1));
+	EXPECT_TRUE(VerificationTable::verifyVersion(slot, kV1));
+}
+
+// Once a partition has been cleared, a read that starts afterwards publishes
+// normally, even over a version another partition's key put in the shared slot.
+TEST(VerificationTable, PopulateAfterClearPublishesOverCollidingVersion) {
+	VerificationTable vt(1, 0xABCD);
+	const uint64_t dbB = otherPartitionDb();
+	const uint8_t pA = VerificationTable::partitionFor(kDbA, 0);
+	auto* slot = vt.slotFor(kDbA, 0, rocksdb::Slice("a"));
+	ASSERT_EQ(slot, vt.slotFor(dbB, 0, rocksdb::Slice("b")));
+
+	vt.settlePartition(pA);
+	ASSERT_TRUE(vt.populateVersion(slot, VerificationTable::partitionFor(dbB, 0), kV2));
+
+	uint64_t clearGen = vt.clearGeneration(pA);
+	uint64_t observed = slot->load();
+	EXPECT_TRUE(vt.populateVersionIfUnchanged(slot, pA, observed, clearGen, kV1));
+	EXPECT_TRUE(VerificationTable::verifyVersion(slot, kV1));
+}
+
+// cancelForDB settles only the closing database's in-flight locks.
+TEST(VerificationTable, CancelForDBOnlyTouchesItsLocks) {
+	VerificationTable vt(1 << 12, 0xABCD);
+	auto* slotA = vt.slotFor(kDbA, 0, rocksdb::Slice("a"));
+	auto* slotB = vt.slotFor(2, 0, rocksdb::Slice("b"));
+	ASSERT_NE(slotA, slotB);
+	LockTracker* tA = vt.lockSlotForWrite(slotA, kDbA);
+	LockTracker* tB = vt.lockSlotForWrite(slotB, 2);
+	LockTracker* tA2 = vt.lockSlotForWrite(vt.slotFor(kDbA, 0, rocksdb::Slice("c")), kDbA);
+
+	vt.cancelForDB(kDbA);
+	EXPECT_TRUE(vtIsSettled(slotA->load()));
+	EXPECT_TRUE(vtIsLock(slotB->load()));
+
+	vt.releaseWriteIntent(slotA, tA);
+	vt.releaseWriteIntent(vt.slotFor(kDbA, 0, rocksdb::Slice("c")), tA2);
+	vt.releaseWriteIntent(slotB, tB);
+	EXPECT_TRUE(vtIsSettled(slotB->load()));
+	vt.cancelForDB(2);  // nothing left installed
+}
@@ -0,0 +1,149 @@
+import { Transaction } from '../src/transaction.js';
+import { dbRunner } from './lib/util.js';
+import { describe, expect, it } from 'vitest';
+
+const testOptions = [
+	{ name: 'optimistic' },
+	{ name: 'pessimistic', options: { pessimistic: true } },
+];
+
+describe('Remove Range', () => {
+	for (const { name, options } of testOptions) {
+		describe(`removeRange() (${name})`, () => {
+			it('should error if database is not open', () =>
+				dbRunner({ dbOptions: [options], skipOpen: true }, async ({ db }) => {
+					await expect(db.removeRange({ start: 'a', end: 'b' })).rejects.toThrow(
+						'Database not open'
+					);
+				}));
+
+			it('should require start and end keys', () =>
+				dbRunner({ dbOptions: [options] }, async ({ db }) => {
+					expect(() => db.removeRangeSync({ start: 'a' } as any)).toThrow(
+						'Range start and end keys are required'
+					);
+				}));
+
+			it('should remove the keys in the range only', () =>
+				dbRunner({ dbOptions: [options] }, async ({ db }) => {
+					for (let i = 0; i < 100; ++i) {
+						db.putSync(`key-${String(i).padStart(3, '0')}`, `value-${i}`);
+					}
+
+					await db.removeRange({ start: 'key-010', end: 'key-020' });
+
+					expect(db.getSync('key-009')).toBe('value-9');
+					expect(db.getSync('key-010')).toBeUndefined();
+					expect(db.getSync('key-019')).toBeUndefined();
+					expect(db.getSync('key-020')).toBe('value-20');
+					expect(Array.from(db.getKeys()).length).toBe(90);
+				}));
+
+			it('should remove and compact a flushed range', () =>
+				dbRunner({ dbOptions: [options] }, async ({ db }) => {
+					for (let i = 0; i < 1000; ++i) {
+						db.putSync(`a-${i}`, `value-${i}`);
+						db.putSync(`b-${i}`, `value-${i}`);
+					}
+					await db.flush();
+
+					db.removeRangeSync({ start: 'a-', end: 'a.', compact: true });
+
+					expect(db.getSync('a-1')).toBeUndefined();
+					expect(db.getSync('b-1')).toBe('value-1');
+					expect(db.getKeysCount()).toBe(1000);
+				}));
+
+			it('should keep the keys a transaction snapshot still sees when compacting', () =>
+				dbRunner({ dbOptions: [options] }, async ({ db }) => {
+					for (let i = 0; i < 1000; ++i) {
+						db.putSync(`a-${i}`, `value-${i}`);
+					}
+					await db.flush();
+
+					const txn = new Transaction(db.store);
+					// the first read pins the transaction's snapshot
+					expect(txn.getSync('a-1')).toBe('value-1');
+
+					db.removeRangeSync({ start: 'a-', end: 'a.', compact: true });
+
+					expect(db.getSync('a-2')).toBeUndefined();
+					expect(txn.getSync('a-2')).toBe('value-2');
+					txn.abort();
+				}));
+
+			it('should invalidate the verification table', () =>
+				dbRunner(
+					{ dbOptions: [{ ...options, encoding: false, verificationTable: true }] },
+					async ({ db }) => {
+						const key = Buffer.from('range-key');
+						const version = 1.7e12;
+						const value = Buffer.alloc(16);
+						value.writeDoubleBE(version, 0);
+						await db.put(key, value);
+						db.populateVersion(key, version);
+						expect(db.verifyVersion(key, version)).toBe(true);
+
+						await db.removeRange({ start: Buffer.from('range-'), end: Buffer.from('range.') });
+
+						expect(db.verifyVersion(key, version)).toBe(false);
+					}
+				));
+		});
+
+		describe(`txn.removeRange() (${name})`, () => {
+			it('should remove the range when the transaction commits', () =>
+				dbRunner({ dbOptions: [options] }, async ({ db }) => {
+					for (let i = 0; i < 10; ++i) {
+						db.putSync(`key-${i}`, `value-${i}`);
+					}
+
+					await db.transaction(async (txn) => {
+						await txn.removeRange({ start: 'key-2', end: 'key-5' });
+						// written after the range removal, so it is kept
+						txn.putSync('key-3', 'kept');
+						expect(db.getSync('key-2')).toBe('value-2');
+					});
+
+					expect(db.getSync('key-1')).toBe('value-1');
+					expect(db.getSync('key-2')).toBeUndefined();
+					expect(db.getSync('key-3')).toBe('kept');
+					expect(db.getSync('key-4')).toBeUndefined();
+					expect(db.getSync('key-5')).toBe('value-5');
+				}));
+
+			it('should not remove the range when the transaction aborts', () =>
+				dbRunner({ dbOptions: [options] }, async ({ db }) => {
+					db.putSync('key-1', 'value-1');
+
+					const txn = new Transaction(db.store);
+					txn.removeRangeSync({ start: 'key-0', end: 'key-9' });
+					txn.abort();
+
+					expect(db.getSync('key-1')).toBe('value-1');
+				}));
+
+			it('should not roll back to a savepoint after removing a range', () =>
+				dbRunner({ dbOptions: [options] }, async ({ db }) => {
+					db.putSync('key-1', 'value-1');
+
+					await db.transaction(async (txn) => {
+						txn.setSavepoint();
+						txn.removeRangeSync({ start: 'key-0', end: 'key-9' });
+						expect(() => txn.rollbackToSavepoint()).toThrow('after removing a range');
+					});
+
+					expect(db.getSync('key-1')).toBeUndefined();
+				}));
+
+			it('should not compact in a transaction', () =>
+				dbRunner({ dbOptions: [options] }, async ({ db }) => {
+					await db.transaction(async (txn) => {
+						expect(() => txn.removeRangeSync({ start: 'a', end: 'b', compact: true })).toThrow(
+							'not supported in a transaction'
+						);
+					});
+				}));
+		});
+	}
+});
@@ -0,0 +1,126 @@
+import { dbRunner, generateDBPath } from './lib/util.js';
+import { existsSync, mkdirSync, rmSync } from 'node:fs';
+import { join } from 'node:path';
+import { afterEach, describe, expect, it } from 'vitest';
+
+const tempDirs: string[] = [];
+
+/**
+ * Returns the path of an SST file in a temp directory that is removed after
+ * each test.
+ */
+function sstPath(name = 'bulk.sst'): string {
+	const dir = generateDBPath();
+	mkdirSync(dir, { recursive: true });
+	tempDirs.push(dir);
+	return join(dir, name);
+}
+
+describe('SST Writer', () => {
+	afterEach(() => {
+		for (const dir of tempDirs.splice(0)) {
+			rmSync(dir, { force: true, recursive: true });
+		}
+	});
+
+	describe('createSstWriter()', () => {
+		it('should error if database is not open', () =>
+			dbRunner({ skipOpen: true }, async ({ db }) => {
+				expect(() => db.createSstWriter(sstPath())).toThrow('Database not open');
+			}));
+
+		it('should write sorted entries and ingest them', () =>
+			dbRunner(async ({ db }) => {
+				await db.put('key-0000', 'old');
+				const path = sstPath();
+				const writer = db.createSstWriter(path);
+				for (let i = 0; i < 1000; ++i) {
+					writer.put(`key-${String(i).padStart(4, '0')}`, `value-${i}`);
+				}
+				const info = writer.finish();
+				expect(info.path).toBe(path);
+				expect(info.entries).toBe(1000);
+				expect(info.fileSize).toBeGreaterThan(0);
+				expect(existsSync(path)).toBe(true);
+
+				await db.ingest([path]);
+				expect(db.getSync('key-0000')).toBe('value-0');
+				expect(db.getSync('key-0999')).toBe('value-999');
+				expect(Array.from(db.getKeys()).length).toBe(1000);
+			}));
+
+		it('should reject out of order keys without sort', () =>
+			dbRunner(async ({ db }) => {
+				const writer = db.createSstWriter(sstPath());
+				writer.put('b', 'value');
+				writer.put('a', 'value');
+				expect(() => writer.finish()).toThrow();
+				writer.abort();
+			}));
+
+		it('should sort unsorted entries and keep the last value for a key', () =>
+			dbRunner(async ({ db }) => {
+				const path = sstPath();
+				// a tiny memory budget forces several spilled runs
+				const writer = db.createSstWriter(path, { sort: true, sortMemory: 4096 });
+				for (let i = 999; i >= 0; --i) {
+					writer.put(`key-${String(i).padStart(4, '0')}`, `value-${i}`);
+				}
+				writer.put('key-0500', 'updated');
+				expect(writer.finish().entries).toBe(1000);
+				expect(existsSync(`${path}.sort.run-0`)).toBe(false);
+
+				db.ingestSync([path]);
+				expect(db.getSync('key-0000')).toBe('value-0');
+				expect(db.getSync('key-0500')).toBe('updated');
+				expect(Array.from(db.getKeys()).length).toBe(1000);
+			}));
+
+		it('should delete the file when aborted', () =>
+			dbRunner(async ({ db }) => {
+				const path = sstPath();
+				const writer = db.createSstWriter(path);
+				writer.put('foo', 'bar');
+				writer.abort();
+				expect(existsSync(path)).toBe(false);
+				expect(() => writer.finish()).toThrow('already been finished');
+			}));
+	});
+
+	describe('ingest()', () => {
+		it('should move files into the database', () =>
+			dbRunner(async ({ db }) => {
+				const path = sstPath();
+				const writer = db.createSstWriter(path);
+				writer.put('foo', 'bar');
+				writer.finish();
+
+				await db.ingest([path], { moveFiles: true });
+				expect(db.getSync('foo')).toBe('bar');
+			}));
+
+		it('should reject a missing file', () =>
+			dbRunner(async ({ db }) => {
+				await expect(db.ingest([sstPath('missing.sst')])).rejects.toThrow();
+			}));
+
+		it('should invalidate the verification table', () =>
+			dbRunner({ dbOptions: [{ encoding: false, verificationTable: true }] }, async ({ db }) => {
+				const key = Buffer.from('ingested');
+				const version = 1.7e12;
+				const value = Buffer.alloc(16);
+				value.writeDoubleBE(version, 0);
+				await db.put(key, value);
+				db.populateVersion(key, version);
+				expect(db.verifyVersion(key, version)).toBe(true);
+
+				const path = sstPath();
+				const writer = db.createSstWriter(path);
+				writer.put(key, Buffer.alloc(16));
+				writer.finish();
+				await db.ingest([path]);
+
+				expect(db.verifyVersion(key, version)).toBe(false);
+			}));
+	});
+});
@@ -140,12 +140,22 @@ describe('Statistics', () => {
 
 			stats = db.getStats();
 			expect(stats).toBeDefined();
-			// the curated column-family set stays small; the always-present txnlog.*
-			// and commitPipeline.* summary keys are counted separately.
+			// the curated column-family set stays small; the always-present txnlog.*,
+			// commitPipeline.*, verificationTable.* and blockCache.* summary keys and
+			// the option-gated tombstoneCompaction.* keys are counted separately.
 			const nonTxnlogKeys = Object.keys(stats).filter(
-				(key) => !key.startsWith('txnlog.') && !key.startsWith('commitPipeline.')
+				(key) =>
+					!key.startsWith('txnlog.') &&
+					!key.startsWith('commitPipeline.') &&
+					!key.startsWith('verificationTable.') &&
+					!key.startsWith('blockCache.') &&
+					!key.startsWith('tombstoneCompaction.')
 			);
-			expect(nonTxnlogKeys.length).toBeLessThanOrEqual(25);
+			// 25 column family properties plus rocksdb.live-blob-file-garbage-size
+			// and rocksdb.estimate-table-readers-mem; the blob cache properties are
+			// left out without a blob cache.
+			expect(nonTxnlogKeys.length).toBeLessThanOrEqual(27);
+			expect(nonTxnlogKeys).not.toContain('rocksdb.blob-cache-capacity');
 
 			// internal stats
 			expect(stats['rocksdb.number.keys.written']).toBeUndefined();
@@ -181,6 +191,25 @@ describe('Statistics', () => {
 			}
 		));
 
+	it('should count async commits per commit pipeline mode', () =>
+		dbRunner(async ({ db }) => {
+			const before =
+				(db.getStat('commitPipeline.singleLaneCommits') as number) +
+				(db.getStat('commitPipeline.twoLaneCommits') as number);
+			for (let i = 0; i < 10; i++) {
+				await db.transaction(async (txn) => {
+					await txn.put(`key${i}`, 'value');
+				});
+			}
+			const stats = db.getStats();
+			expect(
+				stats['commitPipeline.singleLaneCommits'] + stats['commitPipeline.twoLaneCommits'] - before
+			).toBe(10);
+			expect(stats['commitPipeline.modeSwitches']).toBeTypeOf('number');
+			expect(stats['commitPipeline.logStageNs']).toBeTypeOf('number');
+			expect(stats['commitPipeline.commitStageNs']).toBeTypeOf('number');
+		}));
+
 	it('should get ticker stat from database', () =>
 		dbRunner({ dbOptions: [{ enableStats: true }] }, async ({ db }) => {
 			await db.put('key1', 'value1');
@@ -0,0 +1,102 @@
+import { RocksDatabase } from '../src/index.js';
+import { dbRunner } from './lib/util.js';
+import { describe, expect, it } from 'vitest';
+
+async function waitFor(fn: () => boolean, timeout = 5000): Promise<void> {
+	const deadline = Date.now() + timeout;
+	while (!fn()) {
+		if (Date.now() > deadline) {
+			throw new Error('Timed out');
+		}
+		await new Promise((resolve) => setTimeout(resolve, 10));
+	}
+}
+
+async function writeAndDelete(db: RocksDatabase, count: number): Promise<void> {
+	for (let i = 0; i < count; ++i) {
+		db.putSync(`key:${String(i).padStart(5, '0')}`, 'value');
+	}
+	await db.flush();
+	for (let i = 0; i < count; ++i) {
+		db.removeSync(`key:${String(i).padStart(5, '0')}`);
+	}
+}
+
+describe('Tombstone Compaction', () => {
+	it('should not report stats when disabled', () =>
+		dbRunner(async ({ db }) => {
+			await writeAndDelete(db, 100);
+			expect(Array.from(db.getRange({ start: 'key:', end: 'key;' }))).toEqual([]);
+			expect(db.getStat('tombstoneCompaction.skippedTombstones')).toBeUndefined();
+			expect(db.getStats()['tombstoneCompaction.compactedRanges']).toBeUndefined();
+		}));
+
+	it('should count the tombstones iterators skip', () =>
+		dbRunner({ dbOptions: [{ tombstoneCompaction: true }] }, async ({ db }) => {
+			await writeAndDelete(db, 100);
+			expect(Array.from(db.getRange({ start: 'key:', end: 'key;' }))).toEqual([]);
+			expect(db.getStat('tombstoneCompaction.skippedTombstones')).toBeGreaterThanOrEqual(100);
+			// below the default threshold
+			expect(db.getStat('tombstoneCompaction.compactedRanges')).toBe(0);
+		}));
+
+	it('should compact a range full of tombstones', () =>
+		dbRunner(
+			{ dbOptions: [{ tombstoneCompaction: true, tombstoneCompactionThreshold: 50 }] },
+			async ({ db }) => {
+				await writeAndDelete(db, 100);
+				expect(Array.from(db.getRange({ start: 'key:', end: 'key;' }))).toEqual([]);
+				await waitFor(() => db.getStat('tombstoneCompaction.compactedRanges') === 1);
+
+				// the compaction dropped the tombstones
+				const skipped = db.getStat('tombstoneCompaction.skippedTombstones');
+				expect(Array.from(db.getRange({ start: 'key:', end: 'key;' }))).toEqual([]);
+				expect(db.getStat('tombstoneCompaction.skippedTombstones')).toBe(skipped);
+			}
+		));
+
+	it('should compact a range when the iterator is returned early', () =>
+		dbRunner(
+			{ dbOptions: [{ tombstoneCompaction: true, tombstoneCompactionThreshold: 50 }] },
+			async ({ db }) => {
+				await writeAndDelete(db, 100);
+				await db.put('key:99999', 'live');
+				for (const { key } of db.getRange({ start: 'key:' })) {
+					expect(key).toBe('key:99999');
+					break;
+				}
+				await waitFor(() => db.getStat('tombstoneCompaction.compactedRanges') === 1);
+				expect(db.getSync('key:99999')).toBe('live');
+			}
+		));
+
+	it('should compact only around the tombstones an unbounded iterator skipped', () =>
+		dbRunner(
+			{ dbOptions: [{ tombstoneCompaction: true, tombstoneCompactionThreshold: 50 }] },
+			async ({ db }) => {
+				await db.put('a', 'live');
+				await writeAndDelete(db, 100);
+				await db.put('z', 'live');
+				await db.flush();
+				expect(Array.from(db.getRange()).map(({ key }) => key)).toEqual(['a', 'z']);
+				await waitFor(() => db.getStat('tombstoneCompaction.compactedRanges') === 1);
+
+				// the range between the live keys was compacted
+				const skipped = db.getStat('tombstoneCompaction.skippedTombstones');
+				expect(Array.from(db.getRange()).map(({ key }) => key)).toEqual(['a', 'z']);
+				expect(db.getStat('tombstoneCompaction.skippedTombstones')).toBe(skipped);
+			}
+		));
+
+	it('should not compact when an unbounded iterator found only tombstones', () =>
+		dbRunner(
+			{ dbOptions: [{ tombstoneCompaction: true, tombstoneCompactionThreshold: 50 }] },
+			async ({ db }) => {
+				await writeAndDelete(db, 100);
+				expect(Array.from(db.getRange())).toEqual([]);
+				expect(db.getStat('tombstoneCompaction.skippedTombstones')).toBeGreaterThanOrEqual(100);
+				expect(db.getStat('tombstoneCompaction.queuedRanges')).toBe(0);
+				expect(db.getStat('tombstoneCompaction.compactedRanges')).toBe(0);
+			}
+		));
+});
@@ -1,3 +1,4 @@
+import { RocksDatabase } from '../src/index.js';
 import { constants } from '../src/load-binding.js';
 import { dbRunner, generateDBPath } from './lib/util.js';
 import { join } from 'node:path';
@@ -67,6 +68,38 @@ describe('Transaction Log Stats', () => {
 				// the active write file is mapped at the full configured maxFileSize
 				// on POSIX, so mapped bytes are at least the on-disk content.
 				expect(stats.memory.mappedBytes).toBeGreaterThanOrEqual(stats.totalSizeBytes);
+				expect(stats.memory.residentBytes).toBeGreaterThanOrEqual(0);
+				expect(stats.memory.nonResidentPages).toBeGreaterThanOrEqual(0);
+				expect(stats.totals.readAheadBytes).toBe(0);
+			}));
+
+		it('should report read-ahead bytes when transactionLogReadAhead is enabled', () =>
+			dbRunner(async ({ db }) => {
+				RocksDatabase.config({ transactionLogReadAhead: true, transactionLogHugePages: true });
+				try {
+					const log = db.useLog('read-ahead');
+					const value = Buffer.alloc(4096, 'a');
+					for (let i = 0; i < 8; i++) {
+						await db.transaction(async (txn) => {
+							log.addEntry(value, txn.id);
+						});
+					}
+
+					expect(Array.from(log.query({ start: 0 })).length).toBe(8);
+
+					const stats = log.getStats();
+					if (process.platform === 'win32') {
+						expect(stats.totals.readAheadBytes).toBe(0);
+						expect(stats.memory.residentBytes).toBe(0);
+					} else {
+						// the scan covers several full pages of the file-backed region
+						expect(stats.totals.readAheadBytes).toBeGreaterThan(0);
+						expect(stats.memory.residentBytes).toBeGreaterThan(0);
+					}
+					expect(db.getStats()['txnlog.readAheadBytes']).toBe(stats.totals.readAheadBytes);
+				} finally {
+					RocksDatabase.config({ transactionLogReadAhead: false, transactionLogHugePages: false });
+				}
 			}));
 
 		it('should count rotations and aggregate across multiple files', () =>
@@ -1925,6 +1925,94 @@ describe('Transaction Log', () => {
 			}));
 	});
 
+	describe('replayLog()', () => {
+		it('should re-apply entries written after the last flush', () =>
+			dbRunner(async ({ db }) => {
+				const log = db.useLog('foo');
+
+				await db.transaction(async (txn) => {
+					log.addEntry(Buffer.from(JSON.stringify({ key: 'a', value: 'flushed' })), txn.id);
+					db.putSync('a', 'flushed', { transaction: txn });
+				});
+				db.flushSync();
+
+				for (const key of ['b', 'c', 'd']) {
+					await db.transaction(async (txn) => {
+						log.addEntry(Buffer.from(JSON.stringify({ key, value: `replayed-${key}` })), txn.id);
+					});
+				}
+				await db.transaction(async (txn) => {
+					log.addEntry(Buffer.from(JSON.stringify({ key: 'a' })), txn.id);
+				});
+
+				const progressUpdates: number[] = [];
+				const decoded: string[] = [];
+				const progress = db.replayLog('foo', {
+					entriesPerDecode: 2,
+					batchBytes: 1,
+					decodeBatch(entries) {
+						return entries.map(({ data, endTxn }) => {
+							expect(endTxn).toBe(true);
+							const op = JSON.parse(data.toString());
+							decoded.push(op.key);
+							return op;
+						});
+					},
+					onProgress({ bytesReplayed }) {
+						progressUpdates.push(bytesReplayed);
+					},
+				});
+
+				expect(decoded).toEqual(['b', 'c', 'd', 'a']);
+				expect(progress.entriesReplayed).toBe(4);
+				expect(progress.operationsWritten).toBe(4);
+				expect(progress.batchesWritten).toBe(2);
+				expect(progress.bytesReplayed).toBe(progress.totalBytes);
+				expect(progressUpdates).toHaveLength(2);
+				expect(progressUpdates[1]).toBe(progress.totalBytes);
+				expect(db.getSync('b')).toBe('replayed-b');
+				expect(db.getSync('d')).toBe('replayed-d');
+				expect(db.getSync('a')).toBeUndefined();
+			}));
+
+		it('should stop when onProgress returns false', () =>
+			dbRunner(async ({ db }) => {
+				const log = db.useLog('foo');
+				for (let i = 0; i < 4; i++) {
+					await db.transaction(async (txn) => {
+						log.addEntry(Buffer.from(`key${i}`), txn.id);
+					});
+				}
+
+				const progress = db.replayLog('foo', {
+					entriesPerDecode: 1,
+					batchBytes: 1,
+					decodeBatch: (entries) => entries.map(({ data }) => ({ key: data.toString(), value: 'x' })),
+					onProgress: () => false,
+				});
+
+				expect(progress.batchesWritten).toBe(1);
+				expect(db.getSync('key0')).toBe('x');
+				expect(db.getSync('key1')).toBeUndefined();
+			}));
+
+		it('should surface errors thrown by the decoder', () =>
+			dbRunner(async ({ db }) => {
+				const log = db.useLog('foo');
+				await db.transaction(async (txn) => {
+					log.addEntry(Buffer.from('bad'), txn.id);
+				});
+
+				expect(() =>
+					db.replayLog('foo', {
+						decodeBatch() {
+							throw new Error('cannot decode');
+						},
+					})
+				).toThrow('cannot decode');
+			}));
+	});
+
 	describe('coolTransactionLogs()', () => {
 		// MADV_COLD is Linux 5.4+; on macOS/Windows/older kernels adviseCold()
 		// no-ops and reports zero, so only assert it did work where supported.
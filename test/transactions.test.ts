@@ -684,3 +684,272 @@ describe('Optimistic and Pessimistic Instances', () => {
 			}
 		));
 });
+
+describe('Read-only transactions', () => {
+	for (const { name, options } of testOptions.slice(0, 2)) {
+		it(`${name} should read at a snapshot pinned on the first read`, () =>
+			dbRunner({ dbOptions: [options] }, async ({ db }) => {
+				await db.put('a', 'a1');
+				await db.put('b', 'b1');
+
+				await db.transaction(
+					async (txn: Transaction) => {
+						expect(await txn.get('a')).toBe('a1');
+
+						await db.put('a', 'a2');
+						await db.put('c', 'c1');
+
+						expect(await txn.get('a')).toBe('a1');
+						expect(txn.getSync('a')).toBe('a1');
+						expect(txn.getSync('c')).toBeUndefined();
+						expect(txn.getKeysCount()).toBe(2);
+						expect(Array.from(txn.getRange()).map(({ value }) => value)).toEqual(['a1', 'b1']);
+					},
+					{ readOnly: true }
+				);
+
+				expect(await db.get('a')).toBe('a2');
+			}));
+
+		it(`${name} should reject writes`, () =>
+			dbRunner({ dbOptions: [options] }, async ({ db }) => {
+				await db.put('foo', 'bar');
+
+				await expect(
+					db.transaction(
+						async (txn: Transaction) => {
+							txn.putSync('foo', 'baz');
+						},
+						{ readOnly: true }
+					)
+				).rejects.toThrow('Transaction is read-only');
+
+				expect(() =>
+					db.transactionSync(
+						(txn: Transaction) => {
+							txn.removeSync('foo');
+						},
+						{ readOnly: true }
+					)
+				).toThrow('Transaction is read-only');
+
+				expect(() =>
+					db.transactionSync(
+						(txn: Transaction) => {
+							txn.useLog('foo');
+						},
+						{ readOnly: true }
+					)
+				).toThrow('Transaction is read-only');
+
+				expect(await db.get('foo')).toBe('bar');
+			}));
+
+		it(`${name} should commit without emitting a committed event`, () =>
+			dbRunner({ dbOptions: [options] }, async ({ db }) => {
+				await db.put('foo', 'bar');
+				let committed = 0;
+				db.on('committed', () => committed++);
+
+				const value = db.transactionSync((txn: Transaction) => txn.getSync('foo'), {
+					readOnly: true,
+				});
+				expect(value).toBe('bar');
+				await expect(
+					db.transaction(async (txn: Transaction) => txn.get('foo'), { readOnly: true })
+				).resolves.toBe('bar');
+				expect(committed).toBe(0);
+			}));
+	}
+});
+
+describe('Transaction reuse', () => {
+	for (const { name, options } of testOptions.slice(0, 2)) {
+		it(`${name} should not carry writes or locks into a reused transaction`, () =>
+			dbRunner({ dbOptions: [options] }, async ({ db }) => {
+				await db.put('foo', 'bar');
+
+				for (let i = 0; i < 3; i++) {
+					await expect(
+						db.transaction(async (txn: Transaction) => {
+							txn.putSync('foo', `aborted-${i}`);
+							throw new Error('abort');
+						})
+					).rejects.toThrow('abort');
+				}
+
+				await db.transaction(async (txn: Transaction) => {
+					expect(txn.getSync('foo')).toBe('bar');
+					txn.putSync('baz', 'qux');
+				});
+				expect(await db.get('foo')).toBe('bar');
+				expect(await db.get('baz')).toBe('qux');
+
+				db.transactionSync((txn: Transaction) => {
+					txn.putSync('foo', 'updated');
+				});
+				expect(db.getSync('foo')).toBe('updated');
+			}));
+
+		it(`${name} should run transactions with the pool disabled`, () =>
+			dbRunner({ dbOptions: [{ ...options, transactionPoolSize: 0 }] }, async ({ db }) => {
+				for (let i = 0; i < 3; i++) {
+					db.transactionSync((txn: Transaction) => {
+						txn.putSync('foo', `value-${i}`);
+					});
+				}
+				expect(db.getSync('foo')).toBe('value-2');
+			}));
+	}
+});
+
+describe('Savepoints', () => {
+	for (const { name, options } of testOptions.slice(0, 2)) {
+		it(`${name} should undo writes made since the savepoint`, () =>
+			dbRunner({ dbOptions: [options] }, async ({ db }) => {
+				await db.put('removed', 'kept');
+
+				await db.transaction(async (txn: Transaction) => {
+					txn.putSync('a', 'a1');
+					txn.setSavepoint();
+					txn.putSync('a', 'a2');
+					txn.putSync('b', 'b1');
+					txn.removeSync('removed');
+					expect(txn.getSync('a')).toBe('a2');
+
+					txn.rollbackToSavepoint();
+					expect(txn.getSync('a')).toBe('a1');
+					expect(txn.getSync('b')).toBeUndefined();
+					expect(txn.getSync('removed')).toBe('kept');
+
+					txn.putSync('c', 'c1');
+				});
+
+				expect(await db.get('a')).toBe('a1');
+				expect(await db.get('b')).toBeUndefined();
+				expect(await db.get('c')).toBe('c1');
+				expect(await db.get('removed')).toBe('kept');
+			}));
+
+		it(`${name} should nest savepoints`, () =>
+			dbRunner({ dbOptions: [options] }, async ({ db }) => {
+				await db.transaction(async (txn: Transaction) => {
+					txn.setSavepoint();
+					txn.putSync('a', 'a1');
+					txn.setSavepoint();
+					txn.putSync('b', 'b1');
+					txn.setSavepoint();
+					txn.putSync('c', 'c1');
+
+					txn.popSavepoint();
+					txn.rollbackToSavepoint();
+					expect(txn.getSync('a')).toBe('a1');
+					expect(txn.getSync('b')).toBeUndefined();
+					expect(txn.getSync('c')).toBeUndefined();
+
+					txn.popSavepoint();
+					expect(() => txn.rollbackToSavepoint()).toThrow('No savepoint has been set');
+					expect(() => txn.popSavepoint()).toThrow('No savepoint has been set');
+				});
+
+				expect(await db.get('a')).toBe('a1');
+				expect(await db.get('b')).toBeUndefined();
+			}));
+
+		it(`${name} should undo transaction log entries added since the savepoint`, () =>
+			dbRunner({ dbOptions: [options] }, async ({ db }) => {
+				const log = db.useLog('savepoints');
+
+				await db.transaction(async (txn: Transaction) => {
+					log.addEntry(Buffer.from('kept'), txn.id);
+					txn.setSavepoint();
+					log.addEntry(Buffer.from('undone'), txn.id);
+					txn.rollbackToSavepoint();
+				});
+
+				await db.transaction(async (txn: Transaction) => {
+					txn.setSavepoint();
+					log.addEntry(Buffer.from('undone'), txn.id);
+					txn.rollbackToSavepoint();
+					txn.putSync('foo', 'bar');
+				});
+
+				const entries = Array.from(log.query({ start: 0 })).map(({ data }) =>
+					Buffer.from(data).toString()
+				);
+				expect(entries).toEqual(['kept']);
+				expect(await db.get('foo')).toBe('bar');
+			}));
+	}
+});
+
+describe('getMany()', () => {
+	for (const { name, options } of testOptions.slice(0, 2)) {
+		it(`${name} should get a batch of values at the transaction snapshot`, () =>
+			dbRunner({ dbOptions: [options] }, async ({ db }) => {
+				await db.put('a', 'a1');
+				await db.put('b', 'b1');
+
+				await db.transaction(async (txn: Transaction) => {
+					txn.putSync('c', 'c1');
+					expect(txn.getMany(['a', 'missing', 'b', 'c'])).toEqual([
+						'a1',
+						undefined,
+						'b1',
+						'c1',
+					]);
+
+					await db.put('a', 'a2');
+					expect(txn.getMany(['a', 'b'])).toEqual(['a1', 'b1']);
+					expect(txn.getMany([])).toEqual([]);
+
+					const [raw] = txn.getMany(['b'], { skipDecode: true });
+					expect(Buffer.isBuffer(raw)).toBe(true);
+				});
+			}));
+
+		it(`${name} should detect a write since the snapshot with forUpdate`, () =>
+			dbRunner({ dbOptions: [options] }, async ({ db }) => {
+				await db.put('a', 'a1');
+
+				const result = db.transaction(async (txn: Transaction) => {
+					expect(txn.getSync('b')).toBeUndefined();
+					await db.put('a', 'a2');
+
+					if (options?.pessimistic) {
+						// locking the key validates it against the snapshot
+						expect(() => txn.getMany(['a'], { forUpdate: true })).toThrow('Resource busy');
+					} else {
+						// the read is tracked and validated at commit
+						expect(txn.getMany(['a'], { forUpdate: true })).toEqual(['a1']);
+						txn.putSync('b', 'b1');
+					}
+				});
+
+				if (options?.pessimistic) {
+					await result;
+				} else {
+					await expect(result).rejects.toThrow('Resource busy');
+				}
+				expect(await db.get('a')).toBe('a2');
+				expect(await db.get('b')).toBeUndefined();
+			}));
+
+		it(`${name} should get a batch of values in a read-only transaction`, () =>
+			dbRunner({ dbOptions: [options] }, async ({ db }) => {
+				await db.put('a', 'a1');
+
+				await db.transaction(
+					async (txn: Transaction) => {
+						expect(txn.getMany(['a', 'b'])).toEqual(['a1', undefined]);
+						await db.put('b', 'b1');
+						expect(txn.getMany(['a', 'b'])).toEqual(['a1', undefined]);
+						expect(() => txn.getMany(['a'], { forUpdate: true })).toThrow(
+							'Transaction is read-only'
+						);
+					},
+					{ readOnly: true }
+				);
+			}));
+	}
+});
@@ -0,0 +1,110 @@
+import { dbRunner } from './lib/util.js';
+import { spawn } from 'node:child_process';
+import { join } from 'node:path';
+import { describe, expect, it } from 'vitest';
+
+function versioned(version: number, body: string): Buffer {
+	const value = Buffer.alloc(8 + body.length);
+	value.writeDoubleBE(version, 0);
+	value.write(body, 8);
+	return value;
+}
+
+const HOUR = 60 * 60 * 1000;
+
+describe('TTL', () => {
+	it('should error if database is not open', () =>
+		dbRunner({ skipOpen: true }, async ({ db }) => {
+			expect(() => db.setTtl({ ttl: HOUR })).toThrow('Database not open');
+		}));
+
+	it('should error with a negative ttl', () =>
+		dbRunner(async ({ db }) => {
+			expect(() => db.setTtl({ ttl: -1 })).toThrow('TTL must be a non-negative number');
+		}));
+
+	it('should drop expired records on compaction', () =>
+		dbRunner({ dbOptions: [{ encoding: false }] }, async ({ db }) => {
+			const now = Date.now();
+			await db.put('old', versioned(now - 2 * HOUR, 'old'));
+			await db.put('new', versioned(now, 'new'));
+			await db.put('short', Buffer.from('x'));
+
+			db.setTtl({ ttl: HOUR });
+			// expired records stay readable until a compaction rewrites them
+			expect(db.getBinarySync('old')).toEqual(versioned(now - 2 * HOUR, 'old'));
+
+			await db.compact();
+			expect(db.getBinarySync('old')).toBeUndefined();
+			expect(db.getBinarySync('new')).toEqual(versioned(now, 'new'));
+			expect(db.getBinarySync('short')).toEqual(Buffer.from('x'));
+		}));
+
+	it('should apply the ttl option on open', () =>
+		dbRunner({ dbOptions: [{ encoding: false, ttl: HOUR }] }, async ({ db }) => {
+			await db.put('old', versioned(Date.now() - 2 * HOUR, 'old'));
+			await db.compact();
+			expect(db.getBinarySync('old')).toBeUndefined();
+		}));
+
+	it('should drop records below a prefix expiry', () =>
+		dbRunner({ dbOptions: [{ encoding: false }] }, async ({ db }) => {
+			await db.put('session:a', versioned(100, 'a'));
+			await db.put('session:b', versioned(300, 'b'));
+			await db.put('user:a', versioned(100, 'a'));
+
+			db.setTtl({ prefixes: [{ prefix: 'session:', expiresBefore: 200 }] });
+			await db.compact();
+			expect(db.getBinarySync('session:a')).toBeUndefined();
+			expect(db.getBinarySync('session:b')).toEqual(versioned(300, 'b'));
+			expect(db.getBinarySync('user:a')).toEqual(versioned(100, 'a'));
+		}));
+
+	it('should stop expiring records once the rule is removed', () =>
+		dbRunner({ dbOptions: [{ encoding: false }] }, async ({ db }) => {
+			const value = versioned(Date.now() - 2 * HOUR, 'old');
+			await db.put('old', value);
+			db.setTtl({ ttl: HOUR });
+			db.setTtl();
+			await db.compact();
+			expect(db.getBinarySync('old')).toEqual(value);
+		}));
+
+	it('should invalidate the verification table for dropped keys', () =>
+		dbRunner({ dbOptions: [{ encoding: false, verificationTable: true }] }, async ({ db }) => {
+			const key = Buffer.from('old');
+			const version = Date.now() - 2 * HOUR;
+			await db.put(key, versioned(version, 'old'));
+			db.populateVersion(key, version);
+			expect(db.verifyVersion(key, version)).toBe(true);
+
+			db.setTtl({ ttl: HOUR });
+			await db.compact();
+			expect(db.getBinarySync(key)).toBeUndefined();
+			expect(db.verifyVersion(key, version)).toBe(false);
+		}));
+
+	it('should invalidate the verification table when the ttl option creates the rule', () =>
+		dbRunner({ skipOpen: true }, async ({ dbPath }) => {
+			// a fresh process, since the verification table is process-global
+			// and other tests may already have created it
+			await new Promise<void>((resolve, reject) => {
+				const fixture = join(__dirname, 'fixtures', 'fork-ttl-verification-table.mts');
+				const args =
+					process.versions.bun || process.versions.deno
+						? [fixture, dbPath]
+						: ['node_modules/tsx/dist/cli.mjs', fixture, dbPath];
+
+				const child = spawn(process.execPath, args, { stdio: 'inherit' });
+				child.on('close', (code) => {
+					try {
+						expect(code).toBe(0);
+						resolve();
+					} catch (error) {
+						reject(error);
+					}
+				});
+				child.on('error', reject);
+			});
+		}));
+});
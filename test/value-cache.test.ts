@@ -0,0 +1,88 @@
+import { RocksDatabase, valueCacheStats } from '../src/index.js';
+import { constants } from '../src/load-binding.js';
+import { dbRunner } from './lib/util.js';
+import { afterEach, describe, expect, it } from 'vitest';
+
+const { FRESH_VERSION_FLAG, POPULATE_VERSION_FLAG } = constants;
+
+function makeValue(version: number, payload: string): Buffer {
+	const value = Buffer.alloc(8 + payload.length);
+	value.writeDoubleBE(version, 0);
+	value.write(payload, 8);
+	return value;
+}
+
+describe('Value cache', () => {
+	afterEach(() => {
+		RocksDatabase.config({ valueCacheSize: 0 });
+	});
+
+	it('should reject a negative size', () => {
+		expect(() => RocksDatabase.config({ valueCacheSize: -1 })).toThrow(
+			new RangeError('Value cache size must be a positive integer or 0 to disable caching')
+		);
+	});
+
+	it('should serve a stale expected version from the shared cache', () => {
+		RocksDatabase.config({ valueCacheSize: 1024 * 1024 });
+		return dbRunner(
+			{ dbOptions: [{ encoding: false, verificationTable: true }] },
+			async ({ db }) => {
+				const key = Buffer.from('shared');
+				const version = 1.7e12;
+				await db.put(key, makeValue(version, 'current'));
+
+				// a cold read seeds the slot and the cache
+				const native = (db as any).store.db;
+				const before = valueCacheStats();
+				native.getSync(key, POPULATE_VERSION_FLAG, undefined, 1.6e12);
+				expect(valueCacheStats().inserts - before.inserts).toBe(1);
+
+				// a reader holding an older version gets the cached bytes
+				const value = db.getBinarySync(key, { expectedVersion: 1.5e12 });
+				expect(Buffer.from(value as Buffer).subarray(8).toString()).toBe('current');
+				expect(valueCacheStats().hits - before.hits).toBe(1);
+
+				// a reader holding the current version still gets the sentinel
+				expect(db.getBinarySync(key, { expectedVersion: version })).toBe(FRESH_VERSION_FLAG);
+			}
+		);
+	});
+
+	it('should stop serving a value once the key is rewritten', () => {
+		RocksDatabase.config({ valueCacheSize: 1024 * 1024 });
+		return dbRunner(
+			{ dbOptions: [{ encoding: false, verificationTable: true }] },
+			async ({ db }) => {
+				const key = Buffer.from('rewritten');
+				await db.put(key, makeValue(1.7e12, 'old'));
+				(db as any).store.db.getSync(key, POPULATE_VERSION_FLAG, undefined, 1.6e12);
+
+				await db.transaction(async (txn) => {
+					txn.putSync(key, makeValue(1.8e12, 'new'));
+				});
+
+				const hits = valueCacheStats().hits;
+				const value = db.getBinarySync(key, { expectedVersion: 1.5e12 });
+				expect(Buffer.from(value as Buffer).subarray(8).toString()).toBe('new');
+				expect(valueCacheStats().hits).toBe(hits);
+			}
+		);
+	});
+
+	it('should drop every entry when disabled', () => {
+		RocksDatabase.config({ valueCacheSize: 1024 * 1024 });
+		return dbRunner(
+			{ dbOptions: [{ encoding: false, verificationTable: true }] },
+			async ({ db }) => {
+				const key = Buffer.from('dropped');
+				await db.put(key, makeValue(1.7e12, 'value'));
+				(db as any).store.db.getSync(key, POPULATE_VERSION_FLAG, undefined, 1.6e12);
+				expect(valueCacheStats().entries).toBeGreaterThan(0);
+
+				RocksDatabase.config({ valueCacheSize: 0 });
+				expect(valueCacheStats()).toMatchObject({ capacity: 0, bytes: 0, entries: 0 });
+			}
+		);
+	});
+});
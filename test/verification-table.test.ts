@@ -87,6 +87,63 @@ describe('Verification Table', () => {
 		});
 	});
 
+	describe('verifyVersions()', () => {
+		const isFresh = (bitmap: Uint8Array, i: number) => (bitmap[i >> 3] & (1 << (i & 7))) !== 0;
+
+		it('matches verifyVersion() for every key in the page', () =>
+			dbRunner(async ({ db }) => {
+				const keys: string[] = [];
+				const versions: number[] = [];
+				for (let i = 0; i < 100; i++) {
+					keys.push(`page-key-${'x'.repeat(i % 13)}-${i}`);
+					versions.push(1.6e12 + i);
+					if (i % 3 !== 0) {
+						db.populateVersion(keys[i], versions[i]);
+					}
+				}
+				versions[4] = 0; // never fresh
+
+				const bitmap = db.verifyVersions(keys, versions);
+				expect(bitmap.length).toBe(13);
+				for (let i = 0; i < keys.length; i++) {
+					expect(isFresh(bitmap, i), `key ${i}`).toBe(db.verifyVersion(keys[i], versions[i]));
+				}
+				expect(isFresh(bitmap, 1)).toBe(true);
+				expect(isFresh(bitmap, 3)).toBe(false);
+				expect(isFresh(bitmap, 4)).toBe(false);
+			}));
+
+		it('reuses a caller-supplied bitmap and accepts a Float64Array', () =>
+			dbRunner(async ({ db }) => {
+				db.populateVersion('a', 1.1e12);
+				db.populateVersion('b', 2.2e12);
+				const bitmap = new Uint8Array(1).fill(0xff);
+				const result = db.verifyVersions(
+					['a', 'b', 'c'],
+					new Float64Array([1.1e12, 9e12, 3.3e12]),
+					bitmap
+				);
+				expect(result).toBe(bitmap);
+				expect(bitmap[0]).toBe(0b001);
+			}));
+
+		it('packs keys larger than the reusable buffer', () =>
+			dbRunner(async ({ db }) => {
+				const keys = Array.from({ length: 40 }, (_, i) => `${i}-${'k'.repeat(1000)}`);
+				const versions = keys.map((_, i) => 1.5e12 + i);
+				keys.forEach((key, i) => db.populateVersion(key, versions[i]));
+				const bitmap = db.verifyVersions(keys, versions);
+				expect(keys.every((_, i) => isFresh(bitmap, i))).toBe(true);
+			}));
+
+		it('rejects mismatched keys and versions', () =>
+			dbRunner(async ({ db }) => {
+				expect(() => db.verifyVersions(['a', 'b'], [1.1e12])).toThrow(
+					new RangeError('Expected one version per key')
+				);
+			}));
+	});
+
 	describe('getSync() with expectedVersion fast path', () => {
 		it('returns FRESH_VERSION_FLAG when slot matches', () =>
 			dbRunner(async ({ db }) => {
@@ -136,6 +193,147 @@ describe('Verification Table', () => {
 			}));
 	});
 
+	describe('verificationTable.* stats', () => {
+		const counter = (db: RocksDatabase, name: string) =>
+			db.getStat(`verificationTable.${name}`) as number;
+
+		it('counts fresh hits and misses', () =>
+			dbRunner(async ({ db }) => {
+				const hits = counter(db, 'freshHits');
+				const misses = counter(db, 'misses');
+				db.populateVersion('foo', 1.7e12);
+				db.verifyVersion('foo', 1.7e12);
+				db.verifyVersion('foo', 1.8e12);
+				db.verifyVersions(['foo', 'bar'], [1.7e12, 1.7e12]);
+				expect(counter(db, 'freshHits') - hits).toBe(2);
+				expect(counter(db, 'misses') - misses).toBe(2);
+			}));
+
+		it('counts a soft miss when the value still carries the expected version', () =>
+			dbRunner({ dbOptions: [{ encoding: false }] }, async ({ db }) => {
+				const key = 'soft-miss-key';
+				const value = Buffer.alloc(16);
+				value.writeDoubleBE(1.7e12, 0);
+				await db.put(key, value);
+
+				const softMisses = counter(db, 'softMisses');
+				const native = (db as any).store.db;
+				expect(native.getSync(Buffer.from(key), 0, undefined, 1.7e12)).toBe(FRESH_VERSION_FLAG);
+				expect(counter(db, 'softMisses') - softMisses).toBe(1);
+			}));
+
+		it('counts the checks and soft misses of an async get', () =>
+			dbRunner({ dbOptions: [{ encoding: false }] }, async ({ db }) => {
+				const key = 'async-soft-miss-key';
+				const value = Buffer.alloc(16);
+				value.writeDoubleBE(1.7e12, 0);
+				await db.put(key, value);
+				db.populateVersion('other-key', 1.7e12);
+
+				const hits = counter(db, 'freshHits');
+				const misses = counter(db, 'misses');
+				const softMisses = counter(db, 'softMisses');
+				const native = (db as any).store.db;
+				const get = () =>
+					new Promise((resolve, reject) =>
+						native.get(Buffer.from(key), resolve, reject, undefined, 1.7e12)
+					);
+
+				// the slot is cold, so the read finds the expected version
+				expect(await get()).toBe(FRESH_VERSION_FLAG);
+				expect(counter(db, 'misses') - misses).toBe(1);
+				expect(counter(db, 'softMisses') - softMisses).toBe(1);
+
+				// the soft miss populated the slot, so the next check hits
+				expect(await get()).toBe(FRESH_VERSION_FLAG);
+				expect(counter(db, 'freshHits') - hits).toBe(1);
+				expect(counter(db, 'softMisses') - softMisses).toBe(1);
+			}));
+
+		it('reports the table size, occupancy and a recommended size', () =>
+			dbRunner(async ({ db }) => {
+				db.populateVersion('foo', 1.7e12);
+				const stats = db.getStats();
+				expect(stats['verificationTable.slots']).toBeGreaterThan(0);
+				expect(stats['verificationTable.occupancy']).toBeGreaterThanOrEqual(0);
+				expect(stats['verificationTable.occupancy']).toBeLessThanOrEqual(1);
+				expect(stats['verificationTable.estimatedCollisionRate']).toBeGreaterThanOrEqual(0);
+				expect(stats['verificationTable.recommendedEntries']).toBeGreaterThanOrEqual(1024);
+				expect(db.getStat('verificationTable.unknown')).toBeUndefined();
+			}));
+	});
+
+	describe('get() with waitForWrite', () => {
+		const parkedReads = (db: RocksDatabase) =>
+			db.getStat('verificationTable.parkedReads') as number;
+
+		it('waits for an in-flight write and reads its value', () =>
+			dbRunner({ dbOptions: [{ verificationTable: true }] }, async ({ db }) => {
+				await db.put('parked', 'old');
+				const txn = new Transaction(db.store);
+				txn.putSync('parked', 'new');
+
+				const before = parkedReads(db);
+				const read = db.get('parked', { waitForWrite: 10000 });
+				expect(read).toBeInstanceOf(Promise);
+				expect(parkedReads(db) - before).toBe(1);
+
+				await txn.commit();
+				expect(await read).toBe('new');
+			}));
+
+		it('falls back to a read after the timeout', () =>
+			dbRunner({ dbOptions: [{ verificationTable: true }] }, async ({ db }) => {
+				await db.put('parked', 'old');
+				const txn = new Transaction(db.store);
+				txn.putSync('parked', 'new');
+				try {
+					expect(await db.get('parked', { waitForWrite: 20 })).toBe('old');
+				} finally {
+					txn.abort();
+				}
+			}));
+
+		it('reads right away when no write is in flight', () =>
+			dbRunner({ dbOptions: [{ verificationTable: true }] }, async ({ db }) => {
+				await db.put('idle', 'value');
+				const before = parkedReads(db);
+				expect(db.get('idle', { waitForWrite: 10000 })).toBe('value');
+				expect(parkedReads(db)).toBe(before);
+			}));
+
+		it('stops waiting on a write undone by rollbackToSavepoint()', () =>
+			dbRunner({ dbOptions: [{ verificationTable: true }] }, async ({ db }) => {
+				await db.put('kept', 'old');
+				await db.put('undone', 'old');
+				const txn = new Transaction(db.store);
+				try {
+					txn.putSync('kept', 'new');
+					txn.setSavepoint();
+					txn.putSync('undone', 'new');
+					txn.putSync('kept', 'newer');
+					txn.rollbackToSavepoint();
+
+					// the write before the savepoint still holds its intent on 'kept'
+					const before = parkedReads(db);
+					expect(db.get('undone', { waitForWrite: 10000 })).toBe('old');
+					expect(parkedReads(db)).toBe(before);
+					expect(await db.get('kept', { waitForWrite: 20 })).toBe('old');
+					expect(parkedReads(db) - before).toBe(1);
+				} finally {
+					txn.abort();
+				}
+			}));
+
+		it('does not wait on a write in its own transaction', () =>
+			dbRunner({ dbOptions: [{ verificationTable: true }] }, async ({ db }) => {
+				await db.transaction(async (txn) => {
+					txn.putSync('own', 'mine');
+					expect(await txn.get('own', { waitForWrite: 10000 })).toBe('mine');
+				});
+			}));
+	});
+
 	describe('config({ verificationTableEntries })', () => {
 		it('throws when set to a negative value', () => {
 			expect(() => RocksDatabase.config({ verificationTableEntries: -1 })).toThrowError(
@@ -183,6 +381,21 @@ describe('Verification Table', () => {
 				expect(db.verifyVersion(key, version)).toBe(true);
 			}));
 
+		it('a transactional getMany() seeds the VT for every key found', () =>
+			dbRunner({ dbOptions: [{ encoding: false, verificationTable: true }] }, async ({ db }) => {
+				const keys = [Buffer.from('many-1'), Buffer.from('many-2'), Buffer.from('many-missing')];
+				await db.put(keys[0], makeValue(1.7e12));
+				await db.put(keys[1], makeValue(1.7e12 + 1));
+
+				await db.transaction(async (txn: Transaction) => {
+					const values = txn.getMany(keys, { populateVersion: true });
+					expect(values[2]).toBeUndefined();
+				});
+
+				expect(db.verifyVersion(keys[0], 1.7e12)).toBe(true);
+				expect(db.verifyVersion(keys[1], 1.7e12 + 1)).toBe(true);
+			}));
+
 		it('suppresses seeding while a snapshot older than the latest version is open', () =>
 			dbRunner({ dbOptions: [{ encoding: false, verificationTable: true }] }, async ({ db }) => {
 				const key = Buffer.from('gated');
@@ -342,6 +555,34 @@ describe('Verification Table', () => {
 			}));
 	});
 
+	describe('VT invalidation is scoped to the cleared store', () => {
+		it('clearSync() keeps other column families cached', () =>
+			dbRunner(
+				{
+					dbOptions: [
+						{ name: 'cleared', encoding: false, verificationTable: true },
+						{ name: 'kept', encoding: false, verificationTable: true },
+					],
+				},
+				async ({ db }, { db: other }) => {
+					const cleared = Buffer.from('clear-me');
+					const kept = Buffer.from('keep-me');
+					const version = 1.76e12;
+					await db.put(cleared, makeValue(version));
+					await other.put(kept, makeValue(version));
+					(db as any).store.db.getSync(cleared, POPULATE_VERSION_FLAG, undefined, undefined);
+					(other as any).store.db.getSync(kept, POPULATE_VERSION_FLAG, undefined, undefined);
+					expect(db.verifyVersion(cleared, version)).toBe(true);
+					expect(other.verifyVersion(kept, version)).toBe(true);
+
+					db.clearSync();
+
+					expect(db.verifyVersion(cleared, version)).toBe(false);
+					expect(other.verifyVersion(kept, version)).toBe(true);
+				}
+			));
+	});
+
 	// Drop of a non-default column family bulk-deletes like clear() and must
 	// sweep the VT the same way (default-CF drop routes to clear(), covered above).
 	describe('VT invalidation on drop of a non-default column family', () => {